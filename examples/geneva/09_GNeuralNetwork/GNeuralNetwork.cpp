@@ -74,6 +74,7 @@ int main(int argc, char **argv){
 	std::size_t nDataSets = 2000;
 	std::string resultProgram = "trainedNetwork.hpp";
 	std::string visualizationFile = "visualization.C";
+	std::string binaryTrainingDataFile = "";
 
 	// Assemble command line options
 	boost::program_options::options_description user_options;
@@ -101,6 +102,10 @@ int main(int argc, char **argv){
 		"visualizationFile"
 		, po::value<std::string>(&visualizationFile)->default_value(visualizationFile)
 		, "The name of the visualization file"
+	)(
+		"binaryTrainingDataFile"
+		, po::value<std::string>(&binaryTrainingDataFile)->default_value(binaryTrainingDataFile)
+		, "Converts the trainingDataFile to the memory-mappable binary format, stores it under this name and leaves"
 	);
 
 	//---------------------------------------------------------------------------
@@ -112,6 +117,9 @@ int main(int argc, char **argv){
 	if(tdt != Gem::Geneva::trainingDataType::TDTNONE) {
 		GNeuralNetworkIndividual::createNetworkData(tdt, trainingDataFile, architecture, nDataSets);
 		return 0;
+	} else if(not binaryTrainingDataFile.empty()) {
+		networkData::convertToBinaryFile(trainingDataFile, binaryTrainingDataFile);
+		return 0;
 	} else { // Store the trainingDataFile in the global options, so they can be accessed by the individuals
 		GNeuralNetworkOptions->set("trainingDataFile", trainingDataFile);
 	}
@@ -38,6 +38,7 @@
 
 import argparse
 import os
+import struct
 import sys
 import xml.etree.ElementTree as ET
 
@@ -131,6 +132,40 @@ def evaluate(in_file, out_file):
     (iteration, it_id, result) = process_input(in_file)
     write_output(out_file, iteration, it_id, result)
 
+def serve():
+    """
+    Evaluate parameter sets sent by the optimizer over stdin, until stdin is closed.
+    Each message is preceded by its length as a little-endian uint32. Requests hold
+    the iteration, the evaluation id and the double-, int32- and boolean parameters;
+    each response holds the validity flag, the evaluation id and the results.
+    Diagnostic output must go to stderr, as stdout carries the responses.
+    """
+    stdin = sys.stdin.buffer if hasattr(sys.stdin, "buffer") else sys.stdin
+    stdout = sys.stdout.buffer if hasattr(sys.stdout, "buffer") else sys.stdout
+
+    while True:
+        header = stdin.read(4)
+        if len(header) < 4:
+            break # The optimizer has closed our input
+        (size,) = struct.unpack("<I", header)
+        request = stdin.read(size)
+
+        pos = 4 # Skip the iteration
+        (id_size,) = struct.unpack_from("<I", request, pos)
+        pos += 4
+        it_id = request[pos:pos + id_size]
+        pos += id_size
+        (n_doubles,) = struct.unpack_from("<I", request, pos)
+        pos += 4
+        values = struct.unpack_from("<" + str(n_doubles) + "d", request, pos)
+
+        # This is an example, we just calculate a 4D parabola...
+        result = sum(v**2 for v in values)
+
+        response = struct.pack("<BI", 1, len(it_id)) + it_id + struct.pack("<Id", 1, result)
+        stdout.write(struct.pack("<I", len(response)) + response)
+        stdout.flush()
+
 def archive(in_file):
     """
     Evaluate the result for the given input parameters, and
@@ -261,6 +296,8 @@ def main(argv):
                        action="store_true")
     group.add_argument("--evaluate", help="Evaluate the parameters from the input file",
                        action="store_true")
+    group.add_argument("--serve", help="Evaluate parameters received over stdin until it is closed",
+                       action="store_true")
     group.add_argument("--archive", help="Archive the results",
                        action="store_true")
 
@@ -290,6 +327,8 @@ def main(argv):
         setup(args.output, initial_values)
     elif args.evaluate:
         evaluate(args.input, args.output)
+    elif args.serve:
+        serve()
     elif args.archive:
         archive(args.input)
     else:
@@ -0,0 +1,134 @@
+/********************************************************************************
+ *
+ * This file is part of the Geneva library collection. The following license
+ * applies to this file:
+ *
+ * ------------------------------------------------------------------------------
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * ------------------------------------------------------------------------------
+ *
+ * Note that other files in the Geneva library collection may use a different
+ * license. Please see the licensing information in each file.
+ *
+ ********************************************************************************
+ *
+ * Geneva was started by Dr. Rüdiger Berlich and was later maintained together
+ * with Dr. Ariel Garcia under the auspices of Gemfony scientific. For further
+ * information on Gemfony scientific, see http://www.gemfomy.eu .
+ *
+ * The majority of files in Geneva was released under the Apache license v2.0
+ * in February 2020.
+ *
+ * See the NOTICE file in the top-level directory of the Geneva library
+ * collection for a list of contributors and copyright information.
+ *
+ ********************************************************************************/
+
+#pragma once
+
+// Global checks, defines and includes needed for all of Geneva
+#include "common/GGlobalDefines.hpp"
+
+// Standard header files go here
+#include <iostream>
+#include <functional>
+#include <future>
+#include <chrono>
+#include <exception>
+#include <memory>
+#include <vector>
+#include <string>
+#include <cstddef>
+
+// Boost header files go here
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+// Geneva header files go here
+#include "common/GExceptions.hpp"
+#include "common/GErrorStreamer.hpp"
+#include "common/GThreadPool.hpp"
+
+namespace Gem {
+namespace Common {
+
+/******************************************************************************/
+/** The default number of write jobs that may be pending before callers are blocked */
+const std::size_t DEFAULTMAXPENDINGWRITES = 16;
+
+/******************************************************************************/
+/**
+ * Writes data to a file that stays open as long as the writer is open. Output
+ * is submitted as function objects, which receive the stream. In asynchronous
+ * mode these are executed in submission order by a single background thread,
+ * so that formatting and file i/o do not stall the caller. At most a given
+ * number of jobs may be pending -- further submissions then wait for the oldest
+ * job to finish, so memory consumption stays bounded. Errors raised by a job are
+ * passed on with the next call to write(), flush() or close(). In synchronous
+ * mode, jobs are executed immediately in the caller's thread. The class is not
+ * copyable.
+ */
+class GAsyncFileWriter {
+public:
+	 /** @brief Initialization with the operating mode and the maximum number of pending jobs */
+	 explicit G_API_COMMON GAsyncFileWriter(
+		 bool async = true
+		 , std::size_t maxPendingWrites = DEFAULTMAXPENDINGWRITES
+	 );
+	 /** @brief The destructor; waits for all pending jobs */
+	 G_API_COMMON ~GAsyncFileWriter();
+
+	 /** @brief Opens the target file */
+	 G_API_COMMON void open(
+		 boost::filesystem::path const&
+		 , std::ios_base::openmode = std::ios_base::out | std::ios_base::app
+	 );
+	 /** @brief Checks whether a file is currently open */
+	 G_API_COMMON bool isOpen() const;
+	 /** @brief Retrieves the name of the file written to */
+	 G_API_COMMON boost::filesystem::path getPath() const;
+
+	 /** @brief Submits a job that writes to the file */
+	 G_API_COMMON void write(std::function<void(std::ostream&)>);
+	 /** @brief Waits for all pending jobs and flushes the file */
+	 G_API_COMMON void flush();
+	 /** @brief Waits for all pending jobs and closes the file */
+	 G_API_COMMON void close();
+
+	 /** @brief Checks whether jobs are executed in a background thread */
+	 G_API_COMMON bool isAsync() const;
+	 /** @brief Retrieves the maximum number of pending jobs */
+	 G_API_COMMON std::size_t getMaxPendingWrites() const;
+
+	 /***************************************************************************/
+	 // Some deleted functions and constructors
+	 G_API_COMMON GAsyncFileWriter(const GAsyncFileWriter&) = delete; // deleted copy constructor
+	 G_API_COMMON GAsyncFileWriter& operator=(const GAsyncFileWriter&) = delete; // deleted assignment operator
+
+private:
+	 /** @brief Waits for the oldest jobs until at most the given number remains pending */
+	 void waitForPendingWrites(std::size_t);
+
+	 bool m_async; ///< Whether jobs are executed in a background thread
+	 std::size_t m_maxPendingWrites; ///< The maximum number of jobs that may be pending
+
+	 boost::filesystem::path m_path; ///< The name of the file written to
+	 std::unique_ptr<boost::filesystem::ofstream> m_stream_ptr; ///< The stream written to; only accessed by jobs
+	 std::unique_ptr<GThreadPool> m_writer_ptr; ///< A single thread executing jobs in order
+	 std::vector<std::future<void>> m_futures_cnt; ///< Futures of pending jobs, oldest first
+};
+
+/******************************************************************************/
+
+} /* namespace Common */
+} /* namespace Gem */
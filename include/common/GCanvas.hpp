@@ -93,6 +93,7 @@
 #include "common/GCommonMathHelperFunctions.hpp"
 #include "common/GCommonMathHelperFunctionsT.hpp"
 #include "common/GTupleIO.hpp"
+#include "common/GThreadGroup.hpp"
 
 // aliases for ease of use
 namespace bf = boost::filesystem;
@@ -324,7 +325,105 @@ private:
 ////////////////////////////////////////////////////////////////////////////////
 /******************************************************************************/
 /**
- * A collection of pixels in a two-dimensional array
+ * The number of pixels processed side by side in GCanvas::diff(). The partial
+ * sums are independent of each other, so that the compiler may vectorize the loop.
+ */
+const std::size_t CANVASDIFFLANES = 8;
+
+/**
+ * The number of pixels after which the partial sums of GCanvas::diff() are
+ * transferred to a double precision sum
+ */
+const std::size_t CANVASDIFFBLOCKSIZE = 4096;
+
+/**
+ * The minimum number of pixels each thread should deal with in GCanvas::diff()
+ */
+const std::size_t CANVASMINPIXELSPERTHREAD = 16384;
+
+/******************************************************************************/
+/**
+ * Gives access to the color channels of a single pixel of a GCanvas. As the
+ * canvas stores each channel in a separate array, the pixel is represented
+ * by references to the three channels. float_type may be float or const float.
+ */
+template<typename float_type>
+struct GRgbRefT {
+	 float_type &r; ///< red
+	 float_type &g; ///< green
+	 float_type &b; ///< blue
+};
+
+/******************************************************************************/
+/**
+ * Gives access to a single column of a GCanvas, so that pixels may be addressed
+ * as canvas[i_x][i_y]. float_type may be float or const float.
+ */
+template<typename float_type>
+class GColumnViewT {
+public:
+	 /***************************************************************************/
+	 /**
+	  * Initialization with the start of the column in each channel
+	  */
+	 GColumnViewT(
+		 float_type *red
+		 , float_type *green
+		 , float_type *blue
+		 , std::size_t sz
+	 )
+		 : m_red(red)
+		 , m_green(green)
+		 , m_blue(blue)
+		 , m_size(sz)
+	 { /* nothing */ }
+
+	 /***************************************************************************/
+	 /**
+	  * Information about the size of this object
+	  */
+	 std::size_t size() const {
+		 return m_size;
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Unchecked access
+	  */
+	 GRgbRefT<float_type> operator[](std::size_t pos) const {
+		 return GRgbRefT<float_type>{m_red[pos], m_green[pos], m_blue[pos]};
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Checked access
+	  */
+	 GRgbRefT<float_type> at(std::size_t pos) const {
+		 if(pos >= m_size) {
+			 throw gemfony_exception(
+				 g_error_streamer(DO_LOG, time_and_place)
+					 << "In GColumnViewT<>::at(): Error!" << std::endl
+					 << "Invalid position " << pos << " / " << m_size << std::endl
+			 );
+		 }
+
+		 return (*this)[pos];
+	 }
+
+private:
+	 float_type *m_red = nullptr; ///< The start of this column in the red channel
+	 float_type *m_green = nullptr; ///< The start of this column in the green channel
+	 float_type *m_blue = nullptr; ///< The start of this column in the blue channel
+	 std::size_t m_size = 0; ///< The number of pixels in this column
+};
+
+/******************************************************************************/
+////////////////////////////////////////////////////////////////////////////////
+/******************************************************************************/
+/**
+ * A collection of pixels in a two-dimensional array. Each color channel is
+ * stored in a separate array (planar storage), column by column, so that
+ * operations on the entire canvas may be vectorized by the compiler.
  */
 template<std::size_t COLORDEPTH = 8>
 class GCanvas {
@@ -336,7 +435,9 @@ class GCanvas {
 		 using boost::serialization::make_nvp;
 
 		 ar
-		 & BOOST_SERIALIZATION_NVP(m_canvasData)
+		 & BOOST_SERIALIZATION_NVP(m_red)
+		 & BOOST_SERIALIZATION_NVP(m_green)
+		 & BOOST_SERIALIZATION_NVP(m_blue)
 		 & BOOST_SERIALIZATION_NVP(m_xDim)
 		 & BOOST_SERIALIZATION_NVP(m_yDim);
 	 }
@@ -459,61 +560,134 @@ public:
 	 /**
 	  * Unchecked access
 	  */
-	 GColumn &operator[](std::size_t pos) {
-		 return m_canvasData[pos];
+	 GColumnViewT<float> operator[](std::size_t pos) {
+		 std::size_t offset = pos * m_yDim;
+		 return GColumnViewT<float>(m_red.data() + offset, m_green.data() + offset, m_blue.data() + offset, m_yDim);
 	 }
 
 	 /***************************************************************************/
 	 /**
 	  * Checked access
 	  */
-	 GColumn &
+	 GColumnViewT<float>
 	 at(std::size_t pos) {
-		 return m_canvasData.at(pos);
+		 this->checkColumn(pos);
+		 return (*this)[pos];
 	 }
 
 	 /***************************************************************************/
 	 /**
 	  * Unchecked access
 	  */
-	 const GColumn &
+	 GColumnViewT<const float>
 	 operator[](std::size_t pos) const {
-		 return m_canvasData[pos];
+		 std::size_t offset = pos * m_yDim;
+		 return GColumnViewT<const float>(m_red.data() + offset, m_green.data() + offset, m_blue.data() + offset, m_yDim);
 	 }
 
 	 /***************************************************************************/
 	 /**
 	  * Checked access
 	  */
-	 const GColumn &
+	 GColumnViewT<const float>
 	 at(std::size_t pos) const {
-		 return m_canvasData.at(pos);
+		 this->checkColumn(pos);
+		 return (*this)[pos];
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Gives access to the red channel. Pixel (i_x, i_y) is stored at
+	  * position i_x*getYDim() + i_y.
+	  */
+	 const std::vector<float>&
+	 getRedChannel() const {
+		 return m_red;
 	 }
 
 	 /***************************************************************************/
 	 /**
-	  * Find out the deviation between this and another canvas
+	  * Gives access to the green channel
+	  */
+	 const std::vector<float>&
+	 getGreenChannel() const {
+		 return m_green;
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Gives access to the blue channel
+	  */
+	 const std::vector<float>&
+	 getBlueChannel() const {
+		 return m_blue;
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Find out the deviation between this and another canvas, i.e. the sum of
+	  * the euclidean distances of all pixels in color space. Pixels are processed
+	  * in independent lanes, so that the compiler may vectorize the calculation.
+	  * Large canvasses may optionally be split among several threads.
+	  *
+	  * @param cp The canvas to compare with
+	  * @param nThreads The maximum number of threads to be used for the calculation
+	  * @return The deviation between both canvasses
 	  */
 	 float
-	 diff(GCanvas<COLORDEPTH> const &cp) const {
-		 using namespace Gem::Common;
+	 diff(
+		 GCanvas<COLORDEPTH> const &cp
+		 , std::size_t nThreads = 1
+	 ) const {
+		 this->checkDimensions(cp, "diff");
+
+		 std::size_t nPixels = this->getNPixels();
+		 nThreads = (std::max)(std::size_t(1), (std::min)(nThreads, nPixels / CANVASMINPIXELSPERTHREAD));
+		 if (1 == nThreads) {
+			 return float(this->diffRange(cp, 0, nPixels));
+		 }
 
-		 if (cp.dimensions() != this->dimensions()) {
-			 throw gemfony_exception(
-				 g_error_streamer(DO_LOG, time_and_place)
-					 << "In GCanvas::diff(): Error!" << std::endl
-					 << "Dimensions differ: (" << std::get<0>(cp.dimensions()) << ", " << std::get<1>(cp.dimensions()) << ") / ("
-					 << std::get<0>(this->dimensions()) << ", " << std::get<1>(this->dimensions()) << ")" << std::endl
+		 std::vector<double> partialResults(nThreads, 0.);
+		 std::size_t nPixelsPerThread = nPixels / nThreads;
+
+		 Gem::Common::GThreadGroup tg;
+		 for (std::size_t t = 0; t < nThreads; t++) {
+			 std::size_t start = t * nPixelsPerThread;
+			 std::size_t end = (t + 1 == nThreads) ? nPixels : start + nPixelsPerThread;
+			 tg.create_thread(
+				 [this, &cp, &partialResults, t, start, end]() {
+					 partialResults[t] = this->diffRange(cp, start, end);
+				 }
 			 );
 		 }
+		 tg.join_all();
+
+		 double result = 0.;
+		 for (auto const &r: partialResults) {
+			 result += r;
+		 }
+		 return float(result);
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Find out the deviation between this and another canvas, pixel by pixel.
+	  * This is the reference implementation of diff() and is mainly meant for
+	  * tests and benchmarks.
+	  */
+	 float
+	 diffScalar(GCanvas<COLORDEPTH> const &cp) const {
+		 using namespace Gem::Common;
+
+		 this->checkDimensions(cp, "diffScalar");
 
 		 float result = 0.f;
 		 for (std::size_t i_x = 0; i_x < m_xDim; i_x++) {
 			 for (std::size_t i_y = 0; i_y < m_yDim; i_y++) {
 				 result += gsqrt(
-					 gpow((m_canvasData[i_x][i_y]).r - (cp[i_x][i_y]).r, 2.f)
-					 + gpow((m_canvasData[i_x][i_y]).g - (cp[i_x][i_y]).g, 2.f)
-					 + gpow((m_canvasData[i_x][i_y]).b - (cp[i_x][i_y]).b, 2.f)
+					 gpow(((*this)[i_x][i_y]).r - (cp[i_x][i_y]).r, 2.f)
+					 + gpow(((*this)[i_x][i_y]).g - (cp[i_x][i_y]).g, 2.f)
+					 + gpow(((*this)[i_x][i_y]).b - (cp[i_x][i_y]).b, 2.f)
 				 );
 			 }
 		 }
@@ -536,10 +710,11 @@ public:
 
 		 for (std::size_t i_y = 0; i_y < m_yDim; i_y++) {
 			 for (std::size_t i_x = 0; i_x < m_xDim; i_x++) {
+				 std::size_t pos = i_x * m_yDim + i_y;
 				 result
-					 << (std::size_t) (m_canvasData[i_x][i_y].r * float(MAXCOLOR)) << " "
-					 << (std::size_t) (m_canvasData[i_x][i_y].g * float(MAXCOLOR)) << " "
-					 << (std::size_t) (m_canvasData[i_x][i_y].b * float(MAXCOLOR)) << " ";
+					 << (std::size_t) (m_red[pos] * float(MAXCOLOR)) << " "
+					 << (std::size_t) (m_green[pos] * float(MAXCOLOR)) << " "
+					 << (std::size_t) (m_blue[pos] * float(MAXCOLOR)) << " ";
 			 }
 			 result << std::endl;
 		 }
@@ -709,10 +884,11 @@ public:
 		 for (std::size_t line_counter = 0; line_counter < m_yDim; line_counter++) {
 			 for (std::size_t pixel_counter = 0; pixel_counter < m_xDim; pixel_counter++) {
 				 offset = 3 * (line_counter * m_xDim + pixel_counter);
+				 std::size_t pos = pixel_counter * m_yDim + line_counter;
 
-				 (m_canvasData[pixel_counter][line_counter]).r = float(v[offset + std::size_t(0)]) / float(MAXCOLOR);
-				 (m_canvasData[pixel_counter][line_counter]).g = float(v[offset + std::size_t(1)]) / float(MAXCOLOR);
-				 (m_canvasData[pixel_counter][line_counter]).b = float(v[offset + std::size_t(2)]) / float(MAXCOLOR);
+				 m_red[pos] = float(v[offset + std::size_t(0)]) / float(MAXCOLOR);
+				 m_green[pos] = float(v[offset + std::size_t(1)]) / float(MAXCOLOR);
+				 m_blue[pos] = float(v[offset + std::size_t(2)]) / float(MAXCOLOR);
 			 }
 		 }
 	 }
@@ -768,7 +944,9 @@ public:
 	  */
 	 void
 	 clear() {
-		 m_canvasData.clear();
+		 m_red.clear();
+		 m_green.clear();
+		 m_blue.clear();
 
 		 m_xDim = std::size_t(0);
 		 m_yDim = std::size_t(0);
@@ -792,9 +970,9 @@ public:
 		 m_xDim = std::get<0>(dimension);
 		 m_yDim = std::get<1>(dimension);
 
-		 for (std::size_t i = 0; i < m_xDim; i++) {
-			 m_canvasData.push_back(GColumn(m_yDim, std::tuple<float, float, float>(red, green, blue)));
-		 }
+		 m_red.assign(m_xDim * m_yDim, red);
+		 m_green.assign(m_xDim * m_yDim, green);
+		 m_blue.assign(m_xDim * m_yDim, blue);
 	 }
 
 	 /***************************************************************************/
@@ -866,12 +1044,101 @@ public:
 
 	 /***************************************************************************/
 	 /**
-	  * Adds a triangle to the canvas, using a struct holding cartesic coordinates
+	  * Adds a triangle to the canvas, using a struct holding cartesic coordinates.
+	  * Only the columns and rows inside of the triangle's bounding box are visited.
+	  * Within a column, all pixels are treated alike: pixels outside of the triangle
+	  * are blended with an opacity of 0, which leaves them unchanged. The loop is
+	  * thus free of branches and may be vectorized by the compiler. The results
+	  * are identical to those of addTriangleScalar(), except for rounding
+	  * differences if the compiler contracts operations (e.g. to FMA instructions).
 	  */
 	 void
 	 addTriangle(t_cart const & t) {
 		 using namespace Gem::Common;
 
+		 if (0 == m_xDim || 0 == m_yDim) return;
+
+#ifdef DEBUG
+		 if(t.a < 0.f || t.a > 1.f) {
+			 throw gemfony_exception(
+				 g_error_streamer(DO_LOG,  time_and_place)
+					 << "In GCanvas<>::addTriangle(): Error!" << std::endl
+					 << "alpha should be in the range [0.f,1.f], but has value " << t.a << std::endl
+			 );
+		 }
+#endif
+
+		 float min_x = (std::min)({t.tr_one.x, t.tr_two.x, t.tr_three.x});
+		 float max_x = (std::max)({t.tr_one.x, t.tr_two.x, t.tr_three.x});
+		 float min_y = (std::min)({t.tr_one.y, t.tr_two.y, t.tr_three.y});
+		 float max_y = (std::max)({t.tr_one.y, t.tr_two.y, t.tr_three.y});
+
+		 // Also catches NaN coordinates, for which no pixel would be changed
+		 if (not (min_x <= max_x && min_y <= max_y)) return;
+
+		 float xDim_inv = 1.f / float(m_xDim);
+		 float yDim_inv = 1.f / float(m_yDim);
+
+		 // The index ranges are widened, as the pixel positions are subject to rounding.
+		 // The exact test against the bounding box happens for each pixel.
+		 std::size_t i_x_start = this->firstIndex(min_x, m_xDim);
+		 std::size_t i_x_end = this->endIndex(max_x, m_xDim);
+		 std::size_t i_y_start = this->firstIndex(min_y, m_yDim);
+		 std::size_t i_y_end = this->endIndex(max_y, m_yDim);
+
+		 // Quantities that do not depend on the pixel position
+		 coord2D diff31 = t.tr_three - t.tr_one;
+		 coord2D diff21 = t.tr_two - t.tr_one;
+
+		 float dot11 = diff31 * diff31;
+		 float dot12 = diff31 * diff21;
+		 float dot22 = diff21 * diff21;
+
+		 float denom_inv = 1.f / gmax(dot11 * dot22 - dot12 * dot12, 0.0000001f);
+
+		 for (std::size_t i_x = i_x_start; i_x < i_x_end; i_x++) {
+			 // Calculate the pixel x-position
+			 float pos_x = float(i_x + 1) * xDim_inv;
+			 if (pos_x < min_x || pos_x > max_x) continue;
+
+			 float diffp1_x = pos_x - t.tr_one.x;
+			 float dot1p_x = diff31.x * diffp1_x;
+			 float dot2p_x = diff21.x * diffp1_x;
+
+			 float * red = m_red.data() + i_x * m_yDim;
+			 float * green = m_green.data() + i_x * m_yDim;
+			 float * blue = m_blue.data() + i_x * m_yDim;
+
+			 for (std::size_t i_y = i_y_start; i_y < i_y_end; i_y++) {
+				 // Calculate the pixel y-position
+				 float pos_y = float(i_y + 1) * yDim_inv;
+				 float diffp1_y = pos_y - t.tr_one.y;
+
+				 float dot1p = dot1p_x + diff31.y * diffp1_y;
+				 float dot2p = dot2p_x + diff21.y * diffp1_y;
+
+				 float u = (dot22 * dot1p - dot12 * dot2p) * denom_inv;
+				 float v = (dot11 * dot2p - dot12 * dot1p) * denom_inv;
+
+				 bool inside = (pos_y >= min_y) & (pos_y <= max_y) & (u >= 0.f) & (v >= 0.f) & (u + v < 1.f);
+				 float alpha = inside ? t.a : 0.f;
+
+				 red[i_y] = red[i_y] * (1.f - alpha) + t.r * alpha;
+				 green[i_y] = green[i_y] * (1.f - alpha) + t.g * alpha;
+				 blue[i_y] = blue[i_y] * (1.f - alpha) + t.b * alpha;
+			 }
+		 }
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Adds a triangle to the canvas, pixel by pixel. This is the reference
+	  * implementation of addTriangle() and is mainly meant for tests and benchmarks.
+	  */
+	 void
+	 addTriangleScalar(t_cart const & t) {
+		 using namespace Gem::Common;
+
 		 float xDim_inv = 1.f / float(m_xDim);
 		 float yDim_inv = 1.f / float(m_yDim);
 		 float dot11, dot12, dot22, dot1p, dot2p, denom_inv, u, v;
@@ -933,9 +1200,10 @@ public:
 				 v = (dot11 * dot2p - dot12 * dot1p) * denom_inv;
 
 				 if ((u >= 0.f) && (v >= 0.f) && (u + v < 1.f)) {
-					 m_canvasData[i_x][i_y].r = gmix(m_canvasData[i_x][i_y].r, t.r, t.a);
-					 m_canvasData[i_x][i_y].g = gmix(m_canvasData[i_x][i_y].g, t.g, t.a);
-					 m_canvasData[i_x][i_y].b = gmix(m_canvasData[i_x][i_y].b, t.b, t.a);
+					 auto pixel = (*this)[i_x][i_y];
+					 pixel.r = gmix(pixel.r, t.r, t.a);
+					 pixel.g = gmix(pixel.g, t.g, t.a);
+					 pixel.b = gmix(pixel.b, t.b, t.a);
 				 }
 			 }
 		 }
@@ -951,12 +1219,10 @@ public:
 		 float averageGreen = 0.f;
 		 float averageBlue = 0.f;
 
-		 for (std::size_t i_x = 0; i_x < m_xDim; i_x++) {
-			 for (std::size_t i_y = 0; i_y < m_yDim; i_y++) {
-				 averageRed += m_canvasData[i_x][i_y].r;
-				 averageGreen += m_canvasData[i_x][i_y].g;
-				 averageBlue += m_canvasData[i_x][i_y].b;
-			 }
+		 for (std::size_t pos = 0; pos < m_xDim * m_yDim; pos++) {
+			 averageRed += m_red[pos];
+			 averageGreen += m_green[pos];
+			 averageBlue += m_blue[pos];
 		 }
 
 		 averageRed /= (float) (m_xDim * m_yDim);
@@ -967,16 +1233,119 @@ public:
 	 }
 
 	 /***************************************************************************/
-	 // Converts the three angles
-
-	 /***************************************************************************/
 
 protected:
 	 std::size_t m_xDim = 0, m_yDim = 0; ///< The dimensions of this canvas
-	 std::vector<GColumn> m_canvasData; ///< Holds this canvas' columns
+	 std::vector<float> m_red; ///< The red channel, stored column by column
+	 std::vector<float> m_green; ///< The green channel, stored column by column
+	 std::vector<float> m_blue; ///< The blue channel, stored column by column
 
 	 std::size_t NCOLORS = Gem::Common::PowSmallPosInt<2, COLORDEPTH>::result;
 	 std::size_t MAXCOLOR = NCOLORS - 1;
+
+private:
+	 /***************************************************************************/
+	 /**
+	  * Checks that a column exists
+	  */
+	 void
+	 checkColumn(std::size_t pos) const {
+		 if (pos >= m_xDim) {
+			 throw gemfony_exception(
+				 g_error_streamer(DO_LOG, time_and_place)
+					 << "In GCanvas::at(): Error!" << std::endl
+					 << "Invalid column " << pos << " / " << m_xDim << std::endl
+			 );
+		 }
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Checks that another canvas has the same dimensions as this one
+	  */
+	 void
+	 checkDimensions(GCanvas<COLORDEPTH> const &cp, std::string const &caller) const {
+		 if (cp.dimensions() != this->dimensions()) {
+			 throw gemfony_exception(
+				 g_error_streamer(DO_LOG, time_and_place)
+					 << "In GCanvas::" << caller << "(): Error!" << std::endl
+					 << "Dimensions differ: (" << std::get<0>(cp.dimensions()) << ", " << std::get<1>(cp.dimensions()) << ") / ("
+					 << std::get<0>(this->dimensions()) << ", " << std::get<1>(this->dimensions()) << ")" << std::endl
+			 );
+		 }
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Calculates the deviation between this and another canvas for a range of
+	  * pixels. Partial sums of CANVASDIFFLANES pixels are calculated side by side
+	  * and are transferred to a double precision sum every CANVASDIFFBLOCKSIZE pixels.
+	  */
+	 double
+	 diffRange(
+		 GCanvas<COLORDEPTH> const &cp
+		 , std::size_t start
+		 , std::size_t end
+	 ) const {
+		 const float *red1 = m_red.data(), *green1 = m_green.data(), *blue1 = m_blue.data();
+		 const float *red2 = cp.m_red.data(), *green2 = cp.m_green.data(), *blue2 = cp.m_blue.data();
+
+		 double result = 0.;
+		 std::size_t pos = start;
+		 while (pos + CANVASDIFFLANES <= end) {
+			 std::size_t blockEnd = (std::min)(end, pos + CANVASDIFFBLOCKSIZE);
+
+			 float lanes[CANVASDIFFLANES] = {0.f};
+			 for (; pos + CANVASDIFFLANES <= blockEnd; pos += CANVASDIFFLANES) {
+				 for (std::size_t l = 0; l < CANVASDIFFLANES; l++) {
+					 float dr = red1[pos + l] - red2[pos + l];
+					 float dg = green1[pos + l] - green2[pos + l];
+					 float db = blue1[pos + l] - blue2[pos + l];
+					 lanes[l] += std::sqrt(dr * dr + dg * dg + db * db);
+				 }
+			 }
+
+			 for (std::size_t l = 0; l < CANVASDIFFLANES; l++) {
+				 result += double(lanes[l]);
+			 }
+		 }
+
+		 // The remainder
+		 for (; pos < end; pos++) {
+			 float dr = red1[pos] - red2[pos];
+			 float dg = green1[pos] - green2[pos];
+			 float db = blue1[pos] - blue2[pos];
+			 result += double(std::sqrt(dr * dr + dg * dg + db * db));
+		 }
+
+		 return result;
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Calculates the first index of pixels whose position (i+1)/dim may be
+	  * larger than or equal to pos, including a safety margin
+	  */
+	 static std::size_t
+	 firstIndex(float pos, std::size_t dim) {
+		 double index = std::floor(double(pos) * double(dim)) - 2.;
+		 if (index <= 0.) return 0;
+		 if (index >= double(dim)) return dim;
+		 return std::size_t(index);
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Calculates the end of the index range of pixels whose position (i+1)/dim
+	  * may be smaller than or equal to pos, including a safety margin
+	  */
+	 static std::size_t
+	 endIndex(float pos, std::size_t dim) {
+		 double index = std::ceil(double(pos) * double(dim)) + 2.;
+		 if (index <= 0.) return 0;
+		 if (index >= double(dim)) return dim;
+		 return std::size_t(index);
+	 }
 };
 
 /******************************************************************************/
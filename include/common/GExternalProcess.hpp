@@ -0,0 +1,134 @@
+/********************************************************************************
+ *
+ * This file is part of the Geneva library collection. The following license
+ * applies to this file:
+ *
+ * ------------------------------------------------------------------------------
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * ------------------------------------------------------------------------------
+ *
+ * Note that other files in the Geneva library collection may use a different
+ * license. Please see the licensing information in each file.
+ *
+ ********************************************************************************
+ *
+ * Geneva was started by Dr. Rüdiger Berlich and was later maintained together
+ * with Dr. Ariel Garcia under the auspices of Gemfony scientific. For further
+ * information on Gemfony scientific, see http://www.gemfomy.eu .
+ *
+ * The majority of files in Geneva was released under the Apache license v2.0
+ * in February 2020.
+ *
+ * See the NOTICE file in the top-level directory of the Geneva library
+ * collection for a list of contributors and copyright information.
+ *
+ ********************************************************************************/
+
+#pragma once
+
+// Global checks, defines and includes needed for all of Geneva
+#include "common/GGlobalDefines.hpp"
+
+// Standard header files go here
+#include <iostream>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+// Boost header files go here
+
+// Geneva header files go here
+#include "common/GExceptions.hpp"
+#include "common/GErrorStreamer.hpp"
+
+namespace Gem {
+namespace Common {
+
+/******************************************************************************/
+/** The maximum size of a single message exchanged with an external process */
+const std::size_t DEFAULTMAXFRAMESIZE = 64*1024*1024;
+/** The time (in milliseconds) a process gets to exit after its input was closed, before it is killed */
+const std::size_t DEFAULTPROCESSEXITTIMEOUT = 2000;
+
+/******************************************************************************/
+/**
+ * A long-lived external process, started through the shell, which exchanges
+ * messages with the caller over its standard input and output. Each message
+ * ("frame") consists of a 4-byte unsigned length in little-endian byte order,
+ * followed by the given number of payload bytes. For every request frame the
+ * process is expected to write exactly one response frame, after reading the
+ * entire request (the caller only reads once it has sent the request). Its
+ * standard error is inherited, so diagnostic output should go there.
+ *
+ * The process is started upon the first exchange. If it dies or violates the
+ * protocol, exchange() returns false and the process is restarted with the next
+ * exchange. Closing the input of the process signals it to terminate. The class
+ * uses POSIX facilities, is meant to be used from a single thread at a time and
+ * is not copyable.
+ */
+class GExternalProcess {
+public:
+	 /** @brief Initialization with the command line to be executed */
+	 explicit G_API_COMMON GExternalProcess(
+		 std::string const&
+		 , std::size_t maxFrameSize = DEFAULTMAXFRAMESIZE
+	 );
+	 /** @brief The destructor; terminates the process */
+	 G_API_COMMON ~GExternalProcess();
+
+	 /** @brief Sends a request to the process and waits for its response */
+	 G_API_COMMON bool exchange(std::string const&, std::string&);
+	 /** @brief Terminates the process, if it is running */
+	 G_API_COMMON void terminate();
+
+	 /** @brief Checks whether the process is currently running */
+	 G_API_COMMON bool isRunning() const;
+	 /** @brief Retrieves the command line of the process */
+	 G_API_COMMON std::string getCommand() const;
+	 /** @brief Retrieves the number of times the process was started */
+	 G_API_COMMON std::size_t getNStarts() const;
+	 /** @brief Retrieves a description of the last failed exchange */
+	 G_API_COMMON std::string getLastError() const;
+
+	 /***************************************************************************/
+	 // Some deleted functions and constructors
+	 G_API_COMMON GExternalProcess() = delete; // deleted default constructor
+	 G_API_COMMON GExternalProcess(const GExternalProcess&) = delete; // deleted copy constructor
+	 G_API_COMMON GExternalProcess& operator=(const GExternalProcess&) = delete; // deleted assignment operator
+
+private:
+	 /** @brief Starts the process */
+	 void start();
+	 /** @brief Writes a buffer completely to the process */
+	 bool writeAll(const char *, std::size_t);
+	 /** @brief Reads the given number of bytes from the process */
+	 bool readAll(char *, std::size_t);
+	 /** @brief Terminates the process after a failed exchange and records the reason */
+	 bool fail(std::string const&);
+
+	 std::string m_command; ///< The command line of the process
+	 std::size_t m_maxFrameSize; ///< The maximum allowed size of a response
+
+	 int m_pid; ///< The id of the running process or -1
+	 int m_toProcess; ///< The write end of the pipe to the standard input of the process
+	 int m_fromProcess; ///< The read end of the pipe from the standard output of the process
+	 int m_exitStatus; ///< The wait status of the last terminated process
+
+	 std::size_t m_nStarts; ///< The number of times the process was started
+	 std::string m_lastError; ///< A description of the last failed exchange
+};
+
+/******************************************************************************/
+
+} /* namespace Common */
+} /* namespace Gem */
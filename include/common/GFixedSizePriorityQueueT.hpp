@@ -43,6 +43,8 @@
 #include <deque>
 #include <algorithm>
 #include <functional>
+#include <string>
+#include <unordered_set>
 
 // Boost headers go here
 #include <boost/archive/xml_oarchive.hpp>
@@ -82,6 +84,11 @@ namespace Common {
  * It is also required that T can be compared using operator== and operator!= .
  * A maxSize_ of 0 stands for an unlimited size of the data vector.
  *
+ * While items are being added, the data is kept as a binary heap with the
+ * worst item on top, so that insertion into a full queue costs O(log n).
+ * Duplicates are detected through a hash set of the items' ids. The data
+ * is sorted (best item first) lazily, when it is accessed.
+ *
  * IMPORTANT: This class assumes that T has a member function clone<T>()
  * which returns a std::shared_ptr<T> as a copy of the T object.
  */
@@ -96,10 +103,16 @@ class GFixedSizePriorityQueueT
 	 void serialize(Archive &ar, const unsigned int) {
 		 using boost::serialization::make_nvp;
 
+		 // Items are always stored in sorted order
+		 this->sortData();
+
 		 ar
 		 & BOOST_SERIALIZATION_NVP(m_data_deq)
 		 & BOOST_SERIALIZATION_NVP(m_maxSize)
 		 & BOOST_SERIALIZATION_NVP(m_sortOrder);
+
+		 // The ids need to be recalculated after loading
+		 m_ids_valid = false;
 	 }
 	 ///////////////////////////////////////////////////////////////////////
 
@@ -136,6 +149,7 @@ public:
 	 GFixedSizePriorityQueueT(GFixedSizePriorityQueueT<T> const &cp)
 		 : m_maxSize(cp.m_maxSize)
 		 , m_sortOrder(cp.m_sortOrder)
+		 , m_is_heap(cp.m_is_heap)
 	 {
          Gem::Common::copyCloneableSmartPointerContainer(cp.m_data_deq, m_data_deq);
 	 }
@@ -153,6 +167,11 @@ public:
 
 	 	m_sortOrder = cp.m_sortOrder;
 	 	cp.m_sortOrder = Gem::Common::sortOrder::LOWERISBETTER;
+
+	 	m_is_heap = cp.m_is_heap;
+	 	cp.m_is_heap = false;
+	 	cp.m_ids_set.clear();
+	 	cp.m_ids_valid = false;
 	 }
 
 	 /***************************************************************************/
@@ -170,6 +189,8 @@ public:
 		 m_sortOrder = cp.m_sortOrder;
 
          Gem::Common::copyCloneableSmartPointerContainer(cp.m_data_deq, m_data_deq);
+		 m_is_heap = cp.m_is_heap;
+		 m_ids_valid = false;
 
 		 return *this;
 	 }
@@ -188,6 +209,12 @@ public:
 		m_data_deq = std::move(cp.m_data_deq);
 		cp.m_data_deq.clear();
 
+		m_is_heap = cp.m_is_heap;
+		cp.m_is_heap = false;
+		m_ids_valid = false;
+		cp.m_ids_set.clear();
+		cp.m_ids_valid = false;
+
 		return *this;
 	 }
 
@@ -204,6 +231,7 @@ public:
 					 << "Priority queue is empty." << std::endl
 			 );
 		 } else {
+			 this->sortData();
 			 return m_data_deq.front();
 		 }
 	 }
@@ -221,7 +249,8 @@ public:
 					 << "Priority queue is empty." << std::endl
 			 );
 		 } else {
-			 return m_data_deq.back();
+			 // In heap mode, the worst item is on top
+			 return m_is_heap ? m_data_deq.front() : m_data_deq.back();
 		 }
 	 }
 
@@ -245,10 +274,10 @@ public:
 
 	 /***************************************************************************/
 	 /**
-	  * Add an item to the queue. Note that the comparator used in this function
-	  * should sort the data in descending order (assuming that higher
-	  * values are better) or ascending order (if lower values are better),
-	  * so that the worst items are always at the end of the queue.
+	  * Add an item to the queue. The item is only accepted (and cloned, if
+	  * requested) if the queue is unlimited or not yet full, or if it is better
+	  * than the worst item in the queue. Items whose id is already present in
+	  * the queue are rejected.
 	  *
 	  * @param item The item to be added to the queue
 	  * @param do_clone If set to true, work items will be cloned. Otherwise only the smart pointer will be added
@@ -257,66 +286,14 @@ public:
 		 std::shared_ptr<T> const & item
 		 , bool do_clone
 	 ) BASE {
-		 // Add the work item to the queue
-		 // - If the queue is unlimited
-		 // - If the queue isn't full yet
-		 // - If the item is better than the worst one contained in the queue
-		 if (0 == m_maxSize || m_data_deq.size() < m_maxSize ||
-			  isBetter(this->evaluation(item), this->evaluation(this->worst()))) {
-			 if (do_clone) {
-				 m_data_deq.push_back(item->template clone<T>());
-			 } else {
-				 m_data_deq.push_back(item);
-			 }
-		 }
-
-		 // Sort the data according to their ids, so we may remove duplicates
-		 std::sort(
-			 m_data_deq.begin()
-			 , m_data_deq.end()
-			 , [this](std::shared_ptr<T> const & x_ptr, std::shared_ptr<T> const & y_ptr) -> bool {
-				 return (this->id(x_ptr) < this->id(y_ptr));
-			 }
-		 );
-
-		 // Remove duplicate items
-		 m_data_deq.erase(
-			 std::unique(
-				 m_data_deq.begin()
-				 , m_data_deq.end()
-				 , [this](std::shared_ptr<T> const & x_ptr, std::shared_ptr <T> const & y_ptr) -> bool {
-					 return (this->id(x_ptr) == this->id(y_ptr));
-				 }
-			 ), m_data_deq.end()
-		 );
-
-		 // Sort the data according to the evaluation
-		 std::sort(
-			 m_data_deq.begin()
-			 , m_data_deq.end()
-			 , [this](std::shared_ptr<T> const & x_ptr, std::shared_ptr<T> const & y_ptr) -> bool {
-				 if (this->getSortOrder() == Gem::Common::sortOrder::LOWERISBETTER) { // higher is better
-					 return this->evaluation(x_ptr) < this->evaluation(y_ptr);
-				 } else { // HIGHERISBETTER
-					 return this->evaluation(x_ptr) > this->evaluation(y_ptr);
-				 }
-			 }
-		 );
-
-		 // Remove surplus work items, if the queue has reached the corresponding size
-		 // As the worst items are not at the end of the queue, they will be removed, if
-		 // they are beyond the allowed size. This will only have an effect if m_maxSize is != 0 .
-		 if (m_maxSize && m_data_deq.size() > m_maxSize) {
-			 m_data_deq.resize(m_maxSize);
-		 }
+		 this->makeHeap();
+		 this->addToHeap(item, do_clone);
 	 }
 
 	 /***************************************************************************/
 	 /**
-	  * Add a set of items to the queue. Note that the comparator used in this
-	  * function should sort the data in descending order (assuming that higher
-	  * values are better) or ascending order (if lower values are better),
-	  * so that the worst items are always at the end of the queue.
+	  * Add a set of items to the queue. Each item is treated as in the single-item
+	  * version of this function.
 	  *
 	  * @param items The items to be added to the queue
 	  * @param do_clone If set to true, work items will be cloned. Otherwise only the smart pointer will be added
@@ -327,67 +304,13 @@ public:
 		 , bool do_clone
 		 , bool replace
 	 ) BASE {
-		 double worstKnownEvaluation = Gem::Common::getWorstCase<double>(m_sortOrder);
-		 if (replace || m_data_deq.empty()) {
-			 m_data_deq.clear();
-		 } else {
-			 // Data already exists, we know better than the worst known valid
-			 worstKnownEvaluation = this->evaluation(this->worst());
+		 if (replace) {
+			 this->clear();
 		 }
 
-		 // At this point, worstKnownEvaluation will be
-		 // - the worst case, if the queue is empty or all entries in the queue will be replaced
-		 // - the evaluation of the worst entry in the queue if we only add items (regardless of whether they will be cloned or not)
+		 this->makeHeap();
 		 for(auto const & item_ptr: items) {
-			 // Add the work item to the queue
-			 // - If the queue is unlimited
-			 // - If the queue isn't full yet
-			 // - If the item is better than the worst one already contained in the queue
-			 if (0 == m_maxSize || m_data_deq.size() < m_maxSize || isBetter(this->evaluation(item_ptr), worstKnownEvaluation)) {
-				 if (do_clone) {
-					 m_data_deq.push_back(item_ptr->template clone<T>());
-				 } else {
-					 m_data_deq.push_back(item_ptr);
-				 }
-			 }
-		 }
-
-		 // Sort the data according to their ids, so we may remove duplicates
-		 std::sort(
-			 m_data_deq.begin()
-			 , m_data_deq.end()
-			 , [this](std::shared_ptr<T> const & x_ptr, std::shared_ptr<T> const & y_ptr) -> bool {
-				 return (this->id(x_ptr) < this->id(y_ptr));
-			 }
-		 );
-
-		 // Remove duplicate items
-		 m_data_deq.erase(
-			 std::unique(
-				 m_data_deq.begin()
-				 , m_data_deq.end()
-				 , [this](std::shared_ptr<T> const & x_ptr, std::shared_ptr<T> const & y_ptr) -> bool {
-					 return (this->id(x_ptr) == this->id(y_ptr));
-				 }
-			 ), m_data_deq.end()
-		 );
-
-		 std::sort(
-			 m_data_deq.begin()
-			 , m_data_deq.end()
-			 , [this](std::shared_ptr<T> const & x_ptr, std::shared_ptr<T> const & y_ptr) -> bool {
-				 if (this->getSortOrder() == Gem::Common::sortOrder::LOWERISBETTER) {
-					 return this->evaluation(x_ptr) < this->evaluation(y_ptr);
-				 } else {
-					 return this->evaluation(x_ptr) > this->evaluation(y_ptr);
-				 }
-			 }
-		 );
-
-		 // Remove surplus work items, if the queue has reached the corresponding size
-		 // This will only have an effect if m_maxSize is != 0
-		 if (m_maxSize && m_data_deq.size() > m_maxSize) {
-			 m_data_deq.resize(m_maxSize);
+			 this->addToHeap(item_ptr, do_clone);
 		 }
 	 }
 
@@ -404,8 +327,10 @@ public:
 					 << "Priority queue is empty." << std::endl
 			 );
 		 } else {
+			 this->sortData();
 			 auto item_ptr = m_data_deq.front();
 			 m_data_deq.pop_front();
+			 if (m_ids_valid) m_ids_set.erase(this->id(item_ptr));
 			 return item_ptr;
 		 }
 	 }
@@ -415,6 +340,8 @@ public:
 	  * Converts the local deque to a std::vector and returns it
 	  */
 	 std::vector<std::shared_ptr<T>> toVector() const {
+		 this->sortData();
+
 		 std::vector<std::shared_ptr<T>> result;
 
 		 for(auto const & item_ptr: m_data_deq) {
@@ -446,6 +373,9 @@ public:
 	  */
 	 void clear() {
 		 m_data_deq.clear();
+		 m_ids_set.clear();
+		 m_ids_valid = true;
+		 m_is_heap = false;
 	 }
 
 	 /***************************************************************************/
@@ -455,7 +385,9 @@ public:
 	 void setMaxSize(std::size_t maxSize) {
 		 // Make sure the current size of m_data complies with maxSize
 		 if (m_data_deq.size() > maxSize) {
+			 this->sortData();
 			 m_data_deq.resize(maxSize);
+			 m_ids_valid = false;
 		 }
 
 		 m_maxSize = maxSize;
@@ -483,6 +415,8 @@ protected:
 		 Gem::Common::copyCloneableSmartPointerContainer(p_load->m_data_deq, m_data_deq);
 		 m_maxSize = p_load->m_maxSize;
 		 m_sortOrder = p_load->m_sortOrder;
+		 m_is_heap = p_load->m_is_heap;
+		 m_ids_valid = false;
 	 }
 
 	/***************************************************************************/
@@ -515,6 +449,10 @@ protected:
 
 		GToken token("GFixedSizePriorityQueueT<T>", e);
 
+		// Identical contents may be arranged differently in heap mode
+		this->sortData();
+		p_load->sortData();
+
 		// Compare our parent data ...
 		Gem::Common::compare_base_t<GCommonInterfaceT<GFixedSizePriorityQueueT<T>>>(*this, *p_load, token);
 
@@ -574,6 +512,29 @@ protected:
 	        : (new_item_val > old_item_val);
 	 }
 
+	 /***************************************************************************/
+	 /**
+	  * Returns a comparator that considers better items to be "smaller", so that
+	  * the worst item ends up on top of a heap and sorting puts the best item first
+	  */
+	 auto heapComparator() const {
+		 return [this](std::shared_ptr<T> const & x_ptr, std::shared_ptr<T> const & y_ptr) -> bool {
+			 return this->isBetter(x_ptr, y_ptr);
+		 };
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Sorts the data so that the best item comes first, if it is currently
+	  * arranged as a heap. This is called lazily whenever positions matter.
+	  */
+	 void sortData() const {
+		 if (m_is_heap) {
+			 std::sort_heap(m_data_deq.begin(), m_data_deq.end(), this->heapComparator());
+			 m_is_heap = false;
+		 }
+	 }
+
 	 /***************************************************************************/
 	 /** @brief Evaluates a single work item, so that it can be sorted */
 	 virtual G_API_COMMON double evaluation(const std::shared_ptr<T>&) const BASE = 0;
@@ -605,12 +566,65 @@ protected:
 
 	/***************************************************************************/
 
-	 std::deque<std::shared_ptr<T>> m_data_deq; ///< Holds the actual data
+	 mutable std::deque<std::shared_ptr<T>> m_data_deq; ///< Holds the actual data; either sorted or a heap, see m_is_heap
 
 	 std::size_t m_maxSize = 10; ///< The maximum number of work-items
 	 Gem::Common::sortOrder m_sortOrder = Gem::Common::sortOrder::LOWERISBETTER; ///< Indicates whether higher evaluations of items indicate a higher priority
 
 private:
+	 /***************************************************************************/
+	 /**
+	  * Arranges the data as a heap with the worst item on top, if it is currently
+	  * sorted, and makes sure the ids of all items are known
+	  */
+	 void makeHeap() {
+		 if (not m_is_heap) {
+			 std::make_heap(m_data_deq.begin(), m_data_deq.end(), this->heapComparator());
+			 m_is_heap = true;
+		 }
+
+		 if (not m_ids_valid) {
+			 m_ids_set.clear();
+			 for(auto const & item_ptr: m_data_deq) {
+				 m_ids_set.insert(this->id(item_ptr));
+			 }
+			 m_ids_valid = true;
+		 }
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Adds an item to the heap, if it is not a duplicate and if there is room for
+	  * it or it is better than the worst item. In the latter case the worst item
+	  * is removed. Items are only cloned once they have been accepted.
+	  */
+	 void addToHeap(
+		 std::shared_ptr<T> const & item_ptr
+		 , bool do_clone
+	 ) {
+		 std::string item_id = this->id(item_ptr);
+		 if (m_ids_set.count(item_id)) return; // Duplicate
+
+		 if (m_maxSize && m_data_deq.size() >= m_maxSize) {
+			 if (not this->isBetter(item_ptr, m_data_deq.front())) return;
+
+			 // Remove the worst item
+			 std::pop_heap(m_data_deq.begin(), m_data_deq.end(), this->heapComparator());
+			 m_ids_set.erase(this->id(m_data_deq.back()));
+			 m_data_deq.pop_back();
+		 }
+
+		 m_data_deq.push_back(do_clone ? item_ptr->template clone<T>() : item_ptr);
+		 std::push_heap(m_data_deq.begin(), m_data_deq.end(), this->heapComparator());
+		 m_ids_set.insert(item_id);
+	 }
+
+	 /***************************************************************************/
+
+	 mutable bool m_is_heap = false; ///< Indicates whether m_data_deq is currently arranged as a heap rather than sorted
+	 std::unordered_set<std::string> m_ids_set; ///< The ids of all items in the queue, used to reject duplicates
+	 bool m_ids_valid = false; ///< Indicates whether m_ids_set reflects the contents of m_data_deq
+
 	 /***************************************************************************/
 	 /**
 	  * Returns the name of this class
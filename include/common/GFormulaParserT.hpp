@@ -54,6 +54,8 @@
 #include <map>
 #include <cmath>
 #include <type_traits>
+#include <vector>
+#include <algorithm>
 
 // Boost headers go here
 
@@ -71,6 +73,7 @@
 #include <boost/spirit/include/phoenix_bind.hpp>
 #include <boost/math/constants/constants.hpp>
 #include <boost/optional.hpp>
+#include <boost/lexical_cast.hpp>
 #include <boost/xpressive/xpressive.hpp>
 #include <boost/variant.hpp>
 #include <boost/utility.hpp>
@@ -291,11 +294,19 @@ struct unary_function_;
 struct binary_function_;
 struct ast_expression;
 
+/** @brief Refers to a slot in the variable table of a pre-compiled formula */
+struct variable_ {
+	std::size_t slot_ = 0;
+
+	void swap(variable_ &);
+};
+
 using operand =
 boost::variant<
 	nil
 	, float
 	, double
+	, variable_
 	, boost::recursive_wrapper<signed_>
 	, boost::recursive_wrapper<unary_function_>
 	, boost::recursive_wrapper<binary_function_>
@@ -348,6 +359,12 @@ inline std::ostream &operator<<(std::ostream &out, nil) {
 	return out;
 }
 
+/** @brief print function for debugging */
+inline std::ostream &operator<<(std::ostream &out, variable_ const& v) {
+	out << "var[" << v.slot_ << "]";
+	return out;
+}
+
 } /* namespace Common */
 } /* namespace Gem */
 
@@ -447,10 +464,11 @@ public:
 		op_min = 25,     // Calculates the min value of the two top-most stack-entries
 		op_max = 26,     // Calculates the max value of the two top-most stack-entries
 		op_fp = 27,     // Pushes a fp_type onto the stack
+		op_var = 28,     // Pushes the value of a variable slot onto the stack
 	};
 
 	using result_type = void; // Needed for the operator() and apply_visitor
-	using codeEntry = boost::variant<byte_code, fp_type>;
+	using codeEntry = boost::variant<byte_code, fp_type, std::size_t>;
 	using parameter_map = std::map<std::string, std::vector<fp_type>>;
 	using constants_map = std::map<std::string, fp_type>;
 
@@ -529,6 +547,7 @@ public:
 			| (char_('+') > factor_rule_)
 			| unary_function_rule_
 			| binary_function_rule_
+			| variables_
 			| constants_;
 
 		//---------------------------------------------------------------------------
@@ -619,7 +638,7 @@ public:
 
 		if (r && iter == end) {
 			this->compile(ast);
-			this->execute();
+			this->execute(code_);
 		} else {
 			std::string rest(iter, end);
 
@@ -633,6 +652,41 @@ public:
 		return stack_.at(0);
 	}
 
+	/***************************************************************************/
+	/**
+	 * Evaluates the formula through byte code that is only compiled once, upon
+	 * the first call. Place holders are not replaced textually but are turned
+	 * into variable slots, so that later calls only need to fill in the values
+	 * and run the stack machine. The results are the same as for evaluate(),
+	 * except that values are not rounded through their string representation.
+	 */
+	fp_type evaluateCompiled(const parameter_map &vm = parameter_map()) const {
+		if (not compiled_) this->precompile();
+
+		// Fill the variable slots with values taken from the map
+		for (std::size_t slot = 0; slot < var_names_.size(); slot++) {
+			typename parameter_map::const_iterator cit = vm.find(var_names_[slot]);
+			if (
+				cit == vm.end()
+				|| (var_indexed_[slot] && (cit->second.size() < 2 || var_indices_[slot] >= cit->second.size()))
+				|| (not var_indexed_[slot] && 1 != cit->second.size())
+			) {
+				throw gemfony_exception(
+					g_error_streamer(DO_LOG, time_and_place)
+						<< "In GFormulaParserT<>::evaluateCompiled(): Error!" << std::endl
+						<< "No suitable value found for place holder " << var_placeholders_[slot] << std::endl
+						<< "in formula " << raw_formula_ << std::endl
+				);
+			}
+
+			var_values_[slot] = cit->second[var_indices_[slot]];
+		}
+
+		this->execute(compiled_code_);
+
+		return stack_.at(0);
+	}
+
 	/*****************************************************************************/
 	/**
 	 * Ease of access to the evaluate function
@@ -650,6 +704,11 @@ public:
 		code_.push_back(codeEntry(fp_val));
 	}
 
+	void operator()(const variable_ &v) const {
+		code_.push_back(codeEntry(byte_code::op_var));
+		code_.push_back(codeEntry(v.slot_));
+	}
+
 	void operator()(const operation &x) const {
 		boost::apply_visitor(*this, x.operand_);
 
@@ -758,6 +817,54 @@ private:
 		return formula;
 	}
 
+	/***************************************************************************/
+	/**
+	 * Registers all place holders of the raw formula as variables, then parses
+	 * and compiles the formula once. The resulting code is stored separately
+	 * from the code used by evaluate().
+	 */
+	void precompile() const {
+		// Each distinct place holder, such as {{x}} or {{x[2]}}, gets its own slot
+		boost::xpressive::sregex re = boost::xpressive::sregex::compile("\\{\\{([^\\{\\}\\[\\]]+)(\\[([0-9]+)\\])?\\}\\}");
+		boost::xpressive::sregex_iterator it(raw_formula_.begin(), raw_formula_.end(), re), end_it;
+		for (; it != end_it; ++it) {
+			std::string placeHolder = (*it)[0].str();
+			if (std::find(var_placeholders_.begin(), var_placeholders_.end(), placeHolder) != var_placeholders_.end()) continue;
+
+			variable_ v;
+			v.slot_ = var_placeholders_.size();
+			variables_.add(placeHolder, v);
+
+			var_placeholders_.push_back(placeHolder);
+			var_names_.push_back((*it)[1].str());
+			var_indexed_.push_back((*it)[2].matched);
+			var_indices_.push_back((*it)[2].matched ? boost::lexical_cast<std::size_t>((*it)[3].str()) : std::size_t(0));
+		}
+		var_values_.resize(var_placeholders_.size());
+
+		ast_expression ast; ///< The abstract syntax tree
+
+		std::string::const_iterator iter = raw_formula_.begin();
+		std::string::const_iterator end = raw_formula_.end();
+		boost::spirit::ascii::space_type space;
+		bool r = boost::spirit::qi::phrase_parse(iter, end, *this, space, ast);
+
+		if (r && iter == end) {
+			code_.clear();
+			this->compile(ast);
+			compiled_code_.swap(code_);
+			compiled_ = true;
+		} else {
+			std::string rest(iter, end);
+
+			throw gemfony_exception(
+				g_error_streamer(DO_LOG, time_and_place)
+					<< "In GFormulaParserT<>::precompile(): Error!" << std::endl
+					<< "Parsing of formula " << raw_formula_ << " failed at " << rest << std::endl
+			);
+		}
+	}
+
 	/***************************************************************************/
 	/**
 	 * Compiles the AST into byte code
@@ -770,15 +877,15 @@ private:
 	/**
 	 * The actual calculations
 	 */
-	void execute() const {
+	void execute(const std::vector<codeEntry>& code) const {
 		// Position pointers for stack and code
-		typename std::vector<codeEntry>::const_iterator code_ptr = code_.begin();
+		typename std::vector<codeEntry>::const_iterator code_ptr = code.begin();
 		stack_ptr_ = stack_.begin();
 
 		// When requested by the user, print a copy of the code-vector
-		if (printCode_) printCode();
+		if (printCode_) printCode(code);
 
-		while (code_ptr != code_.end()) {
+		while (code_ptr != code.end()) {
 			// Note: *code_ptr is a boost::variabt, boost::get has nothing to do with a boost::tuple here
 			switch (boost::get<byte_code>(*code_ptr++)) { // Read out code_ptr, then switch it to the next position
 				case byte_code::op_trap: {
@@ -932,6 +1039,10 @@ private:
 					*stack_ptr_++ = boost::get<fp_type>(*code_ptr++);
 					break;
 
+				case byte_code::op_var:
+					*stack_ptr_++ = var_values_[boost::get<std::size_t>(*code_ptr++)];
+					break;
+
 				default: {
 					throw gemfony_exception(
 						g_error_streamer(DO_LOG, time_and_place)
@@ -969,14 +1080,14 @@ private:
 	/**
 	 * Prints the code
 	 */
-	void printCode() const {
-		if (code_.empty()) {
+	void printCode(const std::vector<codeEntry>& code) const {
+		if (code.empty()) {
 			std::cout << "Code is empty!" << std::endl;
 			return;
 		}
 
 		std::cout << "Code: ";
-		for (auto it: code_) {
+		for (auto it: code) {
 			std::cout << static_cast<std::size_t>(boost::get<byte_code>(it)) << " " << std::flush;
 		}
 		std::cout << std::endl;
@@ -996,12 +1107,21 @@ private:
 	boost::spirit::qi::real_parser<fp_type, boost::spirit::qi::real_policies<fp_type>> real;
 
 	boost::spirit::qi::symbols<std::iterator_traits<std::string::const_iterator>::value_type, fp_type> constants_; ///< Holds mathematical- and user-defined constants
+	mutable boost::spirit::qi::symbols<std::iterator_traits<std::string::const_iterator>::value_type, variable_> variables_; ///< Maps place holders to variable slots of the pre-compiled code
 
 	mutable std::vector<fp_type> stack_; ///< Holds the data needed as input for each operation
 	mutable std::vector<codeEntry> code_; ///< Holds the "compiled" code
 
 	mutable typename std::vector<fp_type>::iterator stack_ptr_;
 
+	mutable bool compiled_ = false; ///< Indicates whether compiled_code_ holds the pre-compiled formula
+	mutable std::vector<codeEntry> compiled_code_; ///< Holds the code compiled once by precompile()
+	mutable std::vector<std::string> var_placeholders_; ///< The place holder text of each variable slot
+	mutable std::vector<std::string> var_names_; ///< The parameter name of each variable slot
+	mutable std::vector<bool> var_indexed_; ///< Whether a slot refers to an indexed place holder such as {{x[2]}}
+	mutable std::vector<std::size_t> var_indices_; ///< The position inside of the parameter vector for each slot
+	mutable std::vector<fp_type> var_values_; ///< The current values of all variable slots
+
 	bool printCode_; ///< When set, the code will be printed prior to the evaluation
 };
 
@@ -1015,6 +1135,7 @@ namespace boost {
 namespace spirit {
 
 G_API_COMMON void swap(Gem::Common::nil &, Gem::Common::nil &);
+G_API_COMMON void swap(Gem::Common::variable_ &, Gem::Common::variable_ &);
 G_API_COMMON void swap(Gem::Common::signed_ &, Gem::Common::signed_ &);
 G_API_COMMON void swap(Gem::Common::operation &, Gem::Common::operation &);
 G_API_COMMON void swap(Gem::Common::unary_function_ &, Gem::Common::unary_function_ &);
@@ -53,7 +53,11 @@
 #include <vector>
 #include <memory>
 #include <tuple>
+#include <deque>
 #include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <atomic>
 #include <cstdlib>
 #include <cmath>
 #include <chrono>
@@ -180,6 +184,10 @@ private:
 
 /******************************************************************************/
 ////////////////////////////////////////////////////////////////////////////////
+/******************************************************************************/
+/** The default maximum number of log messages waiting for output in asynchronous mode */
+const std::size_t DEFAULTLOGQUEUESIZE = 10000;
+
 /******************************************************************************/
 /**
  * This class serves as the front end of the logging infrastructure. An object of
@@ -187,6 +195,14 @@ private:
  * Upon invocation of the streaming operator it produces an object which is supposed
  * to handle the rest of the work, either using the log targets stored in the
  * GLogger object or letting manipulators output the work.
+ *
+ * By default, messages are passed to the log targets in the calling thread. In
+ * asynchronous mode (see setAsync()), calling threads only append messages to a
+ * bounded queue, which is drained by a single writer thread. The queue lock is
+ * only held for the insertion, so I/O does not serialize the callers. Consecutive
+ * identical messages are coalesced, and messages arriving while the queue is full
+ * are dropped and counted. Pending messages are output upon flush(), when
+ * switching back to synchronous mode, before termination and upon destruction.
  */
 template<class S> // "S" means "streamer"
 class GLogger
@@ -199,7 +215,14 @@ public:
 	 GLogger() = default;
 	 GLogger(GLogger<S> const&) = delete;
 	 GLogger(GLogger<S> &&) noexcept(false) = default;
-	 ~GLogger() = default;
+
+	 /***************************************************************************/
+	 /**
+	  * The destructor. Makes sure all pending messages have been output.
+	  */
+	 ~GLogger() {
+		 this->stopWriter();
+	 }
 
 	 GLogger<S>& operator=(GLogger<S> const&) = delete;
 	 GLogger<S>& operator=(GLogger<S> &&) noexcept(false) = default;
@@ -315,31 +338,84 @@ public:
 		 m_log_cnt.clear();
 	 }
 
+	 /***************************************************************************/
+	 /**
+	  * Switches between synchronous and asynchronous output of log messages.
+	  * Switching back to synchronous mode outputs all pending messages first.
+	  *
+	  * @param async Whether messages should be output by a background thread
+	  * @param maxQueueSize The maximum number of messages waiting for output
+	  */
+	 void setAsync(bool async, std::size_t maxQueueSize = DEFAULTLOGQUEUESIZE) {
+		 if(0 == maxQueueSize) {
+			 raiseException(
+				 "In GLogger::setAsync(): Error!" << std::endl
+				 << "The maximum queue size must be at least 1" << std::endl
+			 );
+		 }
+
+		 this->stopWriter();
+
+		 {
+			 std::unique_lock<std::mutex> q_lk(m_queue_mutex);
+			 m_max_queue_size = maxQueueSize;
+		 }
+
+		 if(async) {
+			 std::unique_lock<std::mutex> q_lk(m_queue_mutex);
+			 m_stop_writer = false;
+			 m_writer_thread = std::thread([this]() { this->drainQueue(); });
+			 m_async = true;
+		 }
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Checks whether messages are output by a background thread
+	  */
+	 bool isAsync() const {
+		 return m_async.load();
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Retrieves the maximum number of messages waiting for output in asynchronous mode
+	  */
+	 std::size_t getMaxQueueSize() const {
+		 std::unique_lock<std::mutex> q_lk(m_queue_mutex);
+		 return m_max_queue_size;
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Retrieves the total number of messages dropped because the queue was full
+	  */
+	 std::size_t getNDroppedMessages() const {
+		 return m_n_dropped_total.load();
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Blocks until all messages submitted so far have been output. Does nothing
+	  * in synchronous mode.
+	  */
+	 void flush() const {
+		 std::unique_lock<std::mutex> q_lk(m_queue_mutex);
+		 m_flush_cv.wait(q_lk, [this]() {
+			 return not m_async.load() || (m_queue.empty() && not m_writing && 0 == m_n_dropped_pending);
+		 });
+	 }
+
 	 /***************************************************************************/
 	 /**
 		 * Allows S-objects to submit strings to the log targets. Note that this
 		 * function is thread-safe and thus may be called from different threads.
 		 * Note that this function throws if no logging targets have been registered.
+		 * In asynchronous mode, the message is only queued for output.
 		 */
 	 void log(std::string const& message) const {
-		 // Make sure only one entity outputs data
-		 std::unique_lock<std::mutex> lk(m_logger_mutex);
-
-		 if (not m_log_cnt.empty()) {
-			 // Do the actual logging
-			 for(auto const& cit: m_log_cnt) {
-				 cit->log(message);
-			 }
-		 } else {
-			 if (m_default_logger) {
-				 m_default_logger->log(message);
-			 } else {
-				 raiseException(
-					 "In GLogger::log(): Error!" << std::endl
-														  << "No loggers found" << std::endl
-				 );
-			 }
-		 }
+		 if(m_async.load() && this->enqueue(message, std::string())) return;
+		 this->dispatch(message, std::string());
 	 }
 
 	 /***************************************************************************/
@@ -347,26 +423,11 @@ public:
 		 * Allows S-objects to submit strings to the log targets. Note that this
 		 * function is thread-safe and thus may be called from different threads.
 		 * Note that this function throws if no logging targets have been registered.
+		 * In asynchronous mode, the message is only queued for output.
 		 */
 	 void logWithSource(std::string const& message, std::string const& extension) const {
-		 // Make sure only one entity outputs data
-		 std::unique_lock<std::mutex> lk(m_logger_mutex);
-
-		 if (not m_log_cnt.empty()) {
-			 // Do the actual logging
-			 for(auto cit: m_log_cnt) { // std::shared_ptr max be copied
-				 cit->logWithSource(message, extension);
-			 }
-		 } else {
-			 if (m_default_logger) {
-				 m_default_logger->logWithSource(message, extension);
-			 } else {
-				 raiseException(
-					 "In GLogger::logWithSource(): Error!" << std::endl
-																		<< "No loggers found" << std::endl
-				 );
-			 }
-		 }
+		 if(m_async.load() && this->enqueue(message, extension)) return;
+		 this->dispatch(message, extension);
 	 }
 
 	 /***************************************************************************/
@@ -386,6 +447,9 @@ public:
 		 * Initiates the termination sequence
 		 */
 	 void terminateApplication(std::string const& error) {
+		 // Output any pending messages first
+		 this->flush();
+
 		 // Make sure only one entity outputs data
 		 std::unique_lock<std::mutex> lk(m_logger_mutex);
 
@@ -416,12 +480,173 @@ public:
 	 }
 
 private:
+	 /***************************************************************************/
+	 /**
+	  * A message waiting for output in asynchronous mode
+	  */
+	 struct queued_message {
+		 std::string message; ///< The message itself
+		 std::string extension; ///< The source of the message; empty if none was given
+		 std::size_t n_repeats; ///< How often the message was repeated after its submission
+	 };
+
+	 /***************************************************************************/
+	 /**
+	  * Passes a message to the log targets
+	  */
+	 void dispatch(std::string const& message, std::string const& extension) const {
+		 // Make sure only one entity outputs data
+		 std::unique_lock<std::mutex> lk(m_logger_mutex);
+
+		 if (not m_log_cnt.empty()) {
+			 // Do the actual logging
+			 for(auto const& cit: m_log_cnt) {
+				 if(extension.empty()) {
+					 cit->log(message);
+				 } else {
+					 cit->logWithSource(message, extension);
+				 }
+			 }
+		 } else {
+			 if (m_default_logger) {
+				 if(extension.empty()) {
+					 m_default_logger->log(message);
+				 } else {
+					 m_default_logger->logWithSource(message, extension);
+				 }
+			 } else {
+				 raiseException(
+					 "In GLogger::dispatch(): Error!" << std::endl
+					 << "No loggers found" << std::endl
+				 );
+			 }
+		 }
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Appends a message to the queue. A message identical to the last queued one
+	  * only increments its repetition counter. Messages are dropped if the queue
+	  * is full. Returns false if the writer thread is not running (anymore), so
+	  * that the caller needs to output the message itself.
+	  */
+	 bool enqueue(std::string const& message, std::string const& extension) const {
+		 std::unique_lock<std::mutex> q_lk(m_queue_mutex);
+		 if(not m_async.load() || m_stop_writer) return false;
+
+		 if(not m_queue.empty() && m_queue.back().message == message && m_queue.back().extension == extension) {
+			 m_queue.back().n_repeats++;
+		 } else if(m_queue.size() < m_max_queue_size) {
+			 m_queue.push_back(queued_message{message, extension, 0});
+		 } else {
+			 m_n_dropped_pending++;
+			 m_n_dropped_total++;
+			 return true;
+		 }
+
+		 q_lk.unlock();
+		 m_queue_cv.notify_one();
+		 return true;
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Executed by the writer thread: Outputs queued messages in batches until
+	  * the writer is stopped and the queue has run empty
+	  */
+	 void drainQueue() const {
+		 std::unique_lock<std::mutex> q_lk(m_queue_mutex);
+		 while(true) {
+			 m_queue_cv.wait(q_lk, [this]() {
+				 return m_stop_writer || not m_queue.empty() || m_n_dropped_pending > 0;
+			 });
+			 if(m_stop_writer && m_queue.empty() && 0 == m_n_dropped_pending) break;
+
+			 std::deque<queued_message> batch;
+			 batch.swap(m_queue);
+			 std::size_t nDropped = m_n_dropped_pending;
+			 m_n_dropped_pending = 0;
+			 m_writing = true;
+			 q_lk.unlock();
+
+			 // Output happens without holding the queue lock, so callers may continue to submit messages
+			 for(auto const& m: batch) {
+				 this->dispatchFromWriter(m.message, m.extension);
+				 if(m.n_repeats > 0) {
+					 this->dispatchFromWriter(
+						 "(The last message was repeated " + std::to_string(m.n_repeats) + " more times)\n"
+						 , m.extension
+					 );
+				 }
+			 }
+			 if(nDropped > 0) {
+				 this->dispatchFromWriter(
+					 "(" + std::to_string(nDropped) + " log messages were dropped, as the log queue was full)\n"
+					 , std::string()
+				 );
+			 }
+
+			 q_lk.lock();
+			 m_writing = false;
+			 m_flush_cv.notify_all();
+		 }
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Passes a message to the log targets from within the writer thread. Errors
+	  * cannot be passed on to the submitting thread, so they are only reported.
+	  */
+	 void dispatchFromWriter(std::string const& message, std::string const& extension) const {
+		 try {
+			 this->dispatch(message, extension);
+		 } catch(std::exception& e) {
+			 std::cerr
+				 << "In GLogger::dispatchFromWriter(): Error!" << std::endl
+				 << "Could not output log message: " << e.what() << std::endl;
+		 } catch(...) {
+			 std::cerr
+				 << "In GLogger::dispatchFromWriter(): Error!" << std::endl
+				 << "Could not output log message" << std::endl;
+		 }
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Outputs all pending messages and terminates the writer thread
+	  */
+	 void stopWriter() {
+		 {
+			 std::unique_lock<std::mutex> q_lk(m_queue_mutex);
+			 if(not m_writer_thread.joinable()) return;
+			 m_stop_writer = true;
+		 }
+		 m_queue_cv.notify_one();
+		 m_writer_thread.join();
+
+		 std::unique_lock<std::mutex> q_lk(m_queue_mutex);
+		 m_async = false;
+		 m_flush_cv.notify_all();
+	 }
+
 	 /***************************************************************************/
 
 	 std::vector<std::shared_ptr<GBaseLogTarget>> m_log_cnt; ///< Contains the log targets
 	 mutable std::mutex m_logger_mutex; ///< Needed for concurrent access to the log targets
 
 	 std::shared_ptr<GBaseLogTarget> m_default_logger = std::make_shared<GConsoleLogger>(); ///< The default log target
+
+	 std::atomic<bool> m_async{false}; ///< Whether messages are output by the writer thread
+	 std::thread m_writer_thread; ///< Outputs queued messages in asynchronous mode
+	 mutable std::mutex m_queue_mutex; ///< Protects the queue and the writer state
+	 mutable std::condition_variable m_queue_cv; ///< Wakes up the writer thread
+	 mutable std::condition_variable m_flush_cv; ///< Signals that a batch of messages has been output
+	 mutable std::deque<queued_message> m_queue; ///< Messages waiting for output
+	 std::size_t m_max_queue_size = DEFAULTLOGQUEUESIZE; ///< The maximum number of messages waiting for output
+	 mutable std::size_t m_n_dropped_pending = 0; ///< Dropped messages not yet reported to the log targets
+	 mutable std::atomic<std::size_t> m_n_dropped_total{0}; ///< All messages dropped so far
+	 mutable bool m_writing = false; ///< Whether the writer thread is outputting a batch
+	 bool m_stop_writer = false; ///< Asks the writer thread to terminate once the queue is empty
 };
 
 /******************************************************************************/
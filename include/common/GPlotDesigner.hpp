@@ -49,6 +49,9 @@
 #include <tuple>
 #include <algorithm>
 #include <type_traits>
+#include <random>
+#include <cmath>
+#include <limits>
 
 // Boost headers go here
 #include <boost/filesystem.hpp>
@@ -205,6 +208,30 @@ G_API_COMMON std::ostream &operator<<(std::ostream &, tddropt const &);
 /** @brief Reads a tddropt item from a stream. Needed also for boost::lexical_cast<> */
 G_API_COMMON std::istream &operator>>(std::istream &, tddropt &);
 
+/******************************************************************************/
+////////////////////////////////////////////////////////////////////////////////
+/******************************************************************************/
+/**
+ * Determines how data collectors limit the number of stored data points.
+ * NONE stores every point. RESERVOIR keeps a uniform random sample of all
+ * points seen so far (in arrival order). DECIMATION keeps every n-th point,
+ * doubling n whenever the limit is exceeded, so that the overall shape of a
+ * curve is retained.
+ */
+enum class dataReductionMode :
+    ENUMBASETYPE
+{
+    NONE = 0
+    , RESERVOIR = 1
+    , DECIMATION = 2
+};
+
+/** @brief Puts a dataReductionMode into a stream. Needed also for boost::lexical_cast<> */
+G_API_COMMON std::ostream &operator<<(std::ostream &, dataReductionMode const &);
+
+/** @brief Reads a dataReductionMode item from a stream. Needed also for boost::lexical_cast<> */
+G_API_COMMON std::istream &operator>>(std::istream &, dataReductionMode &);
+
 /******************************************************************************/
 ////////////////////////////////////////////////////////////////////////////////
 /******************************************************************************/
@@ -226,6 +253,10 @@ const graphPlotMode DEFPLOTMODE = graphPlotMode::CURVE;
 const double DEFMINMARKERSIZE = 0.001;
 const double DEFMAXMARKERSIZE = 1.;
 
+const dataReductionMode DEFDATAREDUCTIONMODE = dataReductionMode::NONE;
+const std::size_t DEFMAXNDATAPOINTS = 10000;
+const std::size_t DEFNHISTWARMUPPOINTS = 100; // Raw points kept by streaming histograms until an automatic range is known
+
 // Easier access to the header-, body- and footer-data
 using plotData = std::tuple<std::string, std::string, std::string>;
 
@@ -1386,7 +1417,11 @@ class GBasePlotter
         & BOOST_SERIALIZATION_NVP(m_plot_label)
         & BOOST_SERIALIZATION_NVP(m_dsMarker)
         & BOOST_SERIALIZATION_NVP(m_secondaryPlotter)
-        & BOOST_SERIALIZATION_NVP(m_id);
+        & BOOST_SERIALIZATION_NVP(m_id)
+        & BOOST_SERIALIZATION_NVP(m_reductionMode)
+        & BOOST_SERIALIZATION_NVP(m_maxNDataPoints)
+        & BOOST_SERIALIZATION_NVP(m_nDataPointsSeen)
+        & BOOST_SERIALIZATION_NVP(m_decimationStride);
     }
     ///////////////////////////////////////////////////////////////////////
 
@@ -1441,6 +1476,15 @@ public:
     /** @brief Sets the id of the object */
     G_API_COMMON void setId(const std::size_t &);
 
+    /** @brief Limits the number of data points stored by data collectors */
+    G_API_COMMON void setDataReduction(dataReductionMode, std::size_t = DEFMAXNDATAPOINTS);
+    /** @brief Retrieves the current data reduction mode */
+    G_API_COMMON dataReductionMode getDataReductionMode() const;
+    /** @brief Retrieves the maximum number of stored data points in reduction modes */
+    G_API_COMMON std::size_t getMaxNDataPoints() const;
+    /** @brief Retrieves the number of data points offered to this object so far */
+    G_API_COMMON std::size_t getNDataPointsSeen() const;
+
     /** @brief Retrieves a unique name for this plotter */
     virtual G_API_COMMON std::string getPlotterName() const BASE = 0;
 
@@ -1495,6 +1539,61 @@ protected:
     /** @brief calculate a suffix from id and parent ids */
     G_API_COMMON std::string suffix(bool, std::size_t) const;
 
+    /***************************************************************************/
+    /**
+     * Adds a data point to a collection, honouring the data reduction settings.
+     * In RESERVOIR mode a new point replaces a randomly chosen stored point with
+     * probability m_maxNDataPoints/n (Algorithm R). The replaced point is erased
+     * and the new one appended, so the collection stays in arrival order. In
+     * DECIMATION mode only every m_decimationStride-th point is stored. When the
+     * limit is exceeded, every second stored point is dropped and the stride is
+     * doubled.
+     *
+     * @param data The collection the point should be added to
+     * @param point The point to be added
+     */
+    template<typename point_type>
+    void addReduced_(
+        std::vector<point_type> &data
+        , point_type const &point
+    ) {
+        switch (m_reductionMode) {
+            case dataReductionMode::NONE:
+                data.push_back(point);
+                break;
+
+            case dataReductionMode::RESERVOIR: {
+                if (data.size() < m_maxNDataPoints) {
+                    data.push_back(point);
+                } else {
+                    std::uniform_int_distribution<std::size_t> uniform(0, m_nDataPointsSeen);
+                    std::size_t pos = uniform(m_reservoir_rng);
+                    if (pos < data.size()) {
+                        data.erase(data.begin() + pos);
+                        data.push_back(point);
+                    }
+                }
+            } break;
+
+            case dataReductionMode::DECIMATION: {
+                if (0 == m_nDataPointsSeen % m_decimationStride) {
+                    data.push_back(point);
+
+                    if (data.size() > m_maxNDataPoints) {
+                        std::size_t nKept = 0;
+                        for (std::size_t pos = 0; pos < data.size(); pos += 2) {
+                            data[nKept++] = data[pos];
+                        }
+                        data.erase(data.begin() + nKept, data.end());
+                        m_decimationStride *= 2;
+                    }
+                }
+            } break;
+        }
+
+        m_nDataPointsSeen++;
+    }
+
     /** @brief Applies modifications to this object. This is needed for testing purposes */
     G_API_GENEVA bool modify_GUnitTests_() override { return false; }
     /** @brief Performs self tests that are expected to succeed. This is needed for testing purposes */
@@ -1527,6 +1626,12 @@ private:
     std::vector<std::shared_ptr<GBasePlotter>> m_secondaryPlotter = std::vector<std::shared_ptr<GBasePlotter>>();
 
     std::size_t m_id = 0; ///< The id of this object
+
+    dataReductionMode m_reductionMode = DEFDATAREDUCTIONMODE; ///< How data collectors limit the number of stored points
+    std::size_t m_maxNDataPoints = DEFMAXNDATAPOINTS; ///< The maximum number of stored points in reduction modes
+    std::size_t m_nDataPointsSeen = 0; ///< The number of data points offered so far
+    std::size_t m_decimationStride = 1; ///< Only every m_decimationStride-th point is stored in DECIMATION mode
+    std::mt19937 m_reservoir_rng; ///< Chooses the points replaced in RESERVOIR mode; not serialized
 };
 
 /******************************************************************************/
@@ -1618,7 +1723,7 @@ public:
         }
 
         // Add the converted data to our collection
-        m_data.push_back(x);
+        this->addDataPoint_(x);
     }
 
     /***************************************************************************/
@@ -1629,7 +1734,7 @@ public:
 	  */
     void operator&(const x_type &x) {
         // Add the data item to our collection
-        m_data.push_back(x);
+        this->addDataPoint_(x);
     }
 
     /***************************************************************************/
@@ -1665,7 +1770,7 @@ public:
             }
 
             // Add the converted data to our collection
-            m_data.push_back(x);
+            this->addDataPoint_(x);
         }
     }
 
@@ -1679,7 +1784,7 @@ public:
         typename std::vector<x_type>::const_iterator cit;
         for (cit = x_cnt.begin(); cit != x_cnt.end(); ++cit) {
             // Add the data item to our collection
-            m_data.push_back(*cit);
+            this->addDataPoint_(*cit);
         }
     }
 
@@ -1765,6 +1870,20 @@ protected:
 
     /***************************************************************************/
 
+    /***************************************************************************/
+    /**
+	  * Adds a single data point to the collection. All operator& overloads end
+	  * up here, so derived classes may override this function to process data
+	  * points differently, e.g. streaming histograms.
+	  *
+	  * @param point The data point to be added
+	  */
+    virtual void addDataPoint_(const x_type &point) {
+        this->addReduced_(m_data, point);
+    }
+
+    /***************************************************************************/
+
     std::vector<x_type> m_data; ///< Holds the actual data
 
 private:
@@ -1803,7 +1922,11 @@ class GHistogram1D : public GDataCollector1T<double>
             , boost::serialization::base_object<GDataCollector1T<double>>(*this))
         & BOOST_SERIALIZATION_NVP(nBinsX_)
         & BOOST_SERIALIZATION_NVP(minX_)
-        & BOOST_SERIALIZATION_NVP(maxX_);
+        & BOOST_SERIALIZATION_NVP(maxX_)
+        & BOOST_SERIALIZATION_NVP(m_streaming)
+        & BOOST_SERIALIZATION_NVP(m_adaptiveX)
+        & BOOST_SERIALIZATION_NVP(m_binContents)
+        & BOOST_SERIALIZATION_NVP(m_nEntries);
     }
     ///////////////////////////////////////////////////////////////////////
 
@@ -1847,6 +1970,15 @@ public:
     /** @brief Retrieve the upper boundary of the plot */
     G_API_COMMON double getMaxX() const;
 
+    /** @brief Switches between storing raw data points and filling bins directly */
+    G_API_COMMON void setStreaming(bool);
+    /** @brief Checks whether data points are filled into bins directly */
+    G_API_COMMON bool isStreaming() const;
+    /** @brief Retrieves the content of a bin in streaming mode, using ROOT's bin numbering */
+    G_API_COMMON double getBinContent(std::size_t) const;
+    /** @brief Retrieves the number of entries filled into the bins in streaming mode */
+    G_API_COMMON std::size_t getNEntries() const;
+
     /** @brief Retrieves a unique name for this plotter */
     G_API_COMMON std::string getPlotterName() const override;
 
@@ -1863,6 +1995,9 @@ protected:
     /** @brief Retrieve the current drawing arguments */
     std::string drawingArguments(bool) const override;
 
+    /** @brief Adds a data point, filling it into the bins directly in streaming mode */
+    G_API_COMMON void addDataPoint_(const double &) override;
+
     /** @brief Loads the data of another object */
     G_API_COMMON void load_(const GBasePlotter *) override;
 
@@ -1889,10 +2024,20 @@ private:
 
     G_API_COMMON GHistogram1D() = default; ///< The default constructor -- intentionally private as it is only needed for (de-)serialization
 
+    /** @brief Fixes the range from the buffered points and moves them into the bins */
+    void binBufferedData_();
+    /** @brief Fills a single value into the bins */
+    void fillBin_(double);
+
     std::size_t nBinsX_ = 10; ///< The number of bins in the histogram
 
     double minX_ = 0; ///< The lower boundary of the histogram
     double maxX_ = minX_; ///< The upper boundary of the histogram
+
+    bool m_streaming = false; ///< Whether data points are filled into bins instead of being stored
+    bool m_adaptiveX = false; ///< Whether the range is determined from the data and widened as needed in streaming mode
+    std::vector<double> m_binContents; ///< Bin contents in streaming mode, including under- and overflow bins
+    std::size_t m_nEntries = 0; ///< The number of entries filled into m_binContents
 };
 
 /******************************************************************************/
@@ -2139,7 +2284,7 @@ public:
             );
         }
 
-        m_data.push_back(
+        this->addDataPoint_(
             std::tuple<x_type, y_type>(
                 x
                 , y
@@ -2155,7 +2300,7 @@ public:
 	  */
     void operator&(const std::tuple<x_type, y_type> &point) {
         // Add the data item to the collection
-        m_data.push_back(point);
+        this->addDataPoint_(point);
     }
 
     /***************************************************************************/
@@ -2193,7 +2338,7 @@ public:
                 );
             }
 
-            m_data.push_back(
+            this->addDataPoint_(
                 std::tuple<x_type, y_type>(
                     x
                     , y
@@ -2213,7 +2358,7 @@ public:
         typename std::vector<std::tuple<x_type, y_type>>::const_iterator cit;
         for (cit = point_cnt.begin(); cit != point_cnt.end(); ++cit) {
             // Add the data item to the collection
-            m_data.push_back(*cit);
+            this->addDataPoint_(*cit);
         }
     }
 
@@ -2333,6 +2478,20 @@ protected:
 
     /***************************************************************************/
 
+    /***************************************************************************/
+    /**
+	  * Adds a single data point to the collection. All operator& overloads end
+	  * up here, so derived classes may override this function to process data
+	  * points differently, e.g. streaming histograms.
+	  *
+	  * @param point The data point to be added
+	  */
+    virtual void addDataPoint_(const std::tuple<x_type, y_type> &point) {
+        this->addReduced_(m_data, point);
+    }
+
+    /***************************************************************************/
+
     std::vector<std::tuple<x_type, y_type>> m_data; ///< Holds the actual data
 
 private:
@@ -2515,7 +2674,7 @@ public:
             );
         }
 
-        m_data.push_back(
+        this->addDataPoint_(
             std::tuple<x_type, x_type, y_type, y_type>(
                 x
                 , ex
@@ -2533,7 +2692,7 @@ public:
 	  */
     void operator&(const std::tuple<x_type, x_type, y_type, y_type> &point) {
         // Add the data item to the collection
-        m_data.push_back(point);
+        this->addDataPoint_(point);
     }
 
     /***************************************************************************/
@@ -2578,7 +2737,7 @@ public:
                 );
             }
 
-            m_data.push_back(
+            this->addDataPoint_(
                 std::tuple<x_type, x_type, y_type, y_type>(
                     x
                     , ex
@@ -2600,7 +2759,7 @@ public:
         typename std::vector<std::tuple<x_type, x_type, y_type, y_type>>::const_iterator cit;
         for (cit = point_cnt.begin(); cit != point_cnt.end(); ++cit) {
             // Add the data item to the collection
-            m_data.push_back(*cit);
+            this->addDataPoint_(*cit);
         }
     }
 
@@ -2700,6 +2859,20 @@ protected:
 
     /***************************************************************************/
 
+    /***************************************************************************/
+    /**
+	  * Adds a single data point to the collection. All operator& overloads end
+	  * up here, so derived classes may override this function to process data
+	  * points differently, e.g. streaming histograms.
+	  *
+	  * @param point The data point to be added
+	  */
+    virtual void addDataPoint_(const std::tuple<x_type, x_type, y_type, y_type> &point) {
+        this->addReduced_(m_data, point);
+    }
+
+    /***************************************************************************/
+
     std::vector<std::tuple<x_type, x_type, y_type, y_type>> m_data; ///< Holds the actual data
 
 private:
@@ -2742,7 +2915,12 @@ class GHistogram2D
         & BOOST_SERIALIZATION_NVP(maxX_)
         & BOOST_SERIALIZATION_NVP(minY_)
         & BOOST_SERIALIZATION_NVP(maxY_)
-        & BOOST_SERIALIZATION_NVP(dropt_);
+        & BOOST_SERIALIZATION_NVP(dropt_)
+        & BOOST_SERIALIZATION_NVP(m_streaming)
+        & BOOST_SERIALIZATION_NVP(m_adaptiveX)
+        & BOOST_SERIALIZATION_NVP(m_adaptiveY)
+        & BOOST_SERIALIZATION_NVP(m_binContents)
+        & BOOST_SERIALIZATION_NVP(m_nEntries);
     }
     ///////////////////////////////////////////////////////////////////////
 
@@ -2805,7 +2983,19 @@ public:
     /** @brief Allows to retrieve 2d-drawing options */
     G_API_COMMON tddropt get2DOpt() const;
 
+    /** @brief Switches between storing raw data points and filling bins directly */
+    G_API_COMMON void setStreaming(bool);
+    /** @brief Checks whether data points are filled into bins directly */
+    G_API_COMMON bool isStreaming() const;
+    /** @brief Retrieves the content of a bin in streaming mode, using ROOT's bin numbering */
+    G_API_COMMON double getBinContent(std::size_t, std::size_t) const;
+    /** @brief Retrieves the number of entries filled into the bins in streaming mode */
+    G_API_COMMON std::size_t getNEntries() const;
+
 protected:
+    /** @brief Adds a data point, filling it into the bins directly in streaming mode */
+    G_API_COMMON void addDataPoint_(const std::tuple<double, double> &) override;
+
     /** @brief Retrieve specific header settings for this plot */
     std::string headerData_(bool, std::size_t, const std::string &) const override;
 
@@ -2843,6 +3033,11 @@ private:
 
     G_API_COMMON GHistogram2D() = default; ///< The default constructor -- intentionally private, as it is only needed for (de-)serialization
 
+    /** @brief Fixes the ranges from the buffered points and moves them into the bins */
+    void binBufferedData_();
+    /** @brief Fills a single point into the bins */
+    void fillBin_(double, double);
+
     std::size_t nBinsX_ = 0; ///< The number of bins in the x-direction of the histogram
     std::size_t nBinsY_ = 0; ///< The number of bins in the y-direction of the histogram
 
@@ -2852,6 +3047,12 @@ private:
     double maxY_ = 0.; ///< The upper boundary of the histogram in y-direction
 
     tddropt dropt_ = tddropt::BOX; ///< The drawing options for 2-d histograms
+
+    bool m_streaming = false; ///< Whether data points are filled into bins instead of being stored
+    bool m_adaptiveX = false; ///< Whether the x-range is determined from the data and widened as needed in streaming mode
+    bool m_adaptiveY = false; ///< Whether the y-range is determined from the data and widened as needed in streaming mode
+    std::vector<double> m_binContents; ///< Bin contents in streaming mode, (nBinsX_+2)*(nBinsY_+2) entries including under- and overflow bins
+    std::size_t m_nEntries = 0; ///< The number of entries filled into m_binContents
 };
 
 /******************************************************************************/
@@ -3179,7 +3380,7 @@ public:
             );
         }
 
-        m_data.push_back(
+        this->addDataPoint_(
             std::tuple<x_type, y_type, z_type>(
                 x
                 , y
@@ -3196,7 +3397,7 @@ public:
 	  */
     void operator&(const std::tuple<x_type, y_type, z_type> &point) {
         // Add the data item to the collection
-        m_data.push_back(point);
+        this->addDataPoint_(point);
     }
 
     /***************************************************************************/
@@ -3236,7 +3437,7 @@ public:
                 );
             }
 
-            m_data.push_back(
+            this->addDataPoint_(
                 std::tuple<x_type, y_type, z_type>(
                     x
                     , y
@@ -3257,7 +3458,7 @@ public:
         typename std::vector<std::tuple<x_type, y_type, z_type>>::const_iterator cit;
         for (cit = point_cnt.begin(); cit != point_cnt.end(); ++cit) {
             // Add the data item to the collection
-            m_data.push_back(*cit);
+            this->addDataPoint_(*cit);
         }
     }
 
@@ -3329,6 +3530,20 @@ protected:
 
     /***************************************************************************/
 
+    /***************************************************************************/
+    /**
+	  * Adds a single data point to the collection. All operator& overloads end
+	  * up here, so derived classes may override this function to process data
+	  * points differently, e.g. streaming histograms.
+	  *
+	  * @param point The data point to be added
+	  */
+    virtual void addDataPoint_(const std::tuple<x_type, y_type, z_type> &point) {
+        this->addReduced_(m_data, point);
+    }
+
+    /***************************************************************************/
+
     std::vector<std::tuple<x_type, y_type, z_type>> m_data; ///< Holds the actual data
 
 private:
@@ -3743,7 +3958,7 @@ public:
             );
         }
 
-        m_data.push_back(
+        this->addDataPoint_(
             std::tuple<x_type, y_type, z_type, w_type>(
                 x
                 , y
@@ -3761,7 +3976,7 @@ public:
 	  */
     void operator&(const std::tuple<x_type, y_type, z_type, w_type> &point) {
         // Add the data item to the collection
-        m_data.push_back(point);
+        this->addDataPoint_(point);
     }
 
     /***************************************************************************/
@@ -3808,7 +4023,7 @@ public:
                 );
             }
 
-            m_data.push_back(
+            this->addDataPoint_(
                 std::tuple<x_type, y_type, z_type, w_type>(
                     x
                     , y
@@ -3830,7 +4045,7 @@ public:
         typename std::vector<std::tuple<x_type, y_type, z_type, w_type>>::const_iterator cit;
         for (cit = point_cnt.begin(); cit != point_cnt.end(); ++cit) {
             // Add the data item to the collection
-            m_data.push_back(*cit);
+            this->addDataPoint_(*cit);
         }
     }
 
@@ -3902,6 +4117,20 @@ protected:
 
     /***************************************************************************/
 
+    /***************************************************************************/
+    /**
+	  * Adds a single data point to the collection. All operator& overloads end
+	  * up here, so derived classes may override this function to process data
+	  * points differently, e.g. streaming histograms.
+	  *
+	  * @param point The data point to be added
+	  */
+    virtual void addDataPoint_(const std::tuple<x_type, y_type, z_type, w_type> &point) {
+        this->addReduced_(m_data, point);
+    }
+
+    /***************************************************************************/
+
     std::vector<std::tuple<x_type, y_type, z_type, w_type>> m_data; ///< Holds the actual data
 
 private:
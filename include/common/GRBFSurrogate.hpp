@@ -0,0 +1,130 @@
+/********************************************************************************
+ *
+ * This file is part of the Geneva library collection. The following license
+ * applies to this file:
+ *
+ * ------------------------------------------------------------------------------
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * ------------------------------------------------------------------------------
+ *
+ * Note that other files in the Geneva library collection may use a different
+ * license. Please see the licensing information in each file.
+ *
+ ********************************************************************************
+ *
+ * Geneva was started by Dr. Rüdiger Berlich and was later maintained together
+ * with Dr. Ariel Garcia under the auspices of Gemfony scientific. For further
+ * information on Gemfony scientific, see http://www.gemfomy.eu .
+ *
+ * The majority of files in Geneva was released under the Apache license v2.0
+ * in February 2020.
+ *
+ * See the NOTICE file in the top-level directory of the Geneva library
+ * collection for a list of contributors and copyright information.
+ *
+ ********************************************************************************/
+
+#pragma once
+
+// Global checks, defines and includes needed for all of Geneva
+#include "common/GGlobalDefines.hpp"
+
+// Standard header files go here
+#include <vector>
+#include <cstddef>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+// Boost header files go here
+
+// Geneva header files go here
+#include "common/GExceptions.hpp"
+#include "common/GErrorStreamer.hpp"
+
+namespace Gem {
+namespace Common {
+
+/******************************************************************************/
+// Default settings for the surrogate model
+const std::size_t DEFAULTRBFNNEIGHBORS = 10;
+const std::size_t DEFAULTRBFMAXARCHIVESIZE = 500;
+const double DEFAULTRBFREGULARIZATION = 1e-8;
+
+/******************************************************************************/
+/**
+ * A cheap surrogate model of an evaluation function, meant to pre-screen
+ * candidate solutions before they are submitted for (expensive) evaluation.
+ * Samples are stored in a bounded, contiguous archive, the oldest sample being
+ * overwritten once the archive is full. Predictions use a Gaussian radial basis function
+ * interpolation over the k nearest neighbours of the query point, so that the
+ * cost per prediction only depends linearly on the archive size. Coordinates
+ * are normalized per dimension, based on the ranges seen at the time of the
+ * last call to update(). If the local interpolation system cannot be solved,
+ * the model falls back to inverse-distance weighting.
+ */
+class GRBFSurrogate {
+public:
+	 /** @brief Initialization with the number of neighbours and the archive size */
+	 explicit G_API_COMMON GRBFSurrogate(
+		 std::size_t nNeighbors = DEFAULTRBFNNEIGHBORS
+		 , std::size_t maxArchiveSize = DEFAULTRBFMAXARCHIVESIZE
+	 );
+	 /** @brief The copy constructor */
+	 G_API_COMMON GRBFSurrogate(const GRBFSurrogate&) = default;
+	 /** @brief The destructor */
+	 G_API_COMMON ~GRBFSurrogate() = default;
+	 /** @brief The assignment operator */
+	 G_API_COMMON GRBFSurrogate& operator=(const GRBFSurrogate&) = default;
+
+	 /** @brief Adds a sample to the archive */
+	 G_API_COMMON void addSample(const std::vector<double>&, double);
+	 /** @brief Recalculates the normalization of the model from the current archive */
+	 G_API_COMMON void update();
+	 /** @brief Predicts the value of the modelled function at a given position */
+	 G_API_COMMON double predict(const std::vector<double>&) const;
+
+	 /** @brief Removes all samples from the archive */
+	 G_API_COMMON void clear();
+	 /** @brief Retrieves the number of samples currently stored in the archive */
+	 G_API_COMMON std::size_t size() const;
+	 /** @brief Retrieves the number of dimensions of the model (0 if no samples were added yet) */
+	 G_API_COMMON std::size_t getNDimensions() const;
+	 /** @brief Checks whether the model has enough information to make predictions */
+	 G_API_COMMON bool isReady() const;
+
+	 /** @brief Retrieves the number of neighbours used for each prediction */
+	 G_API_COMMON std::size_t getNNeighbors() const;
+	 /** @brief Retrieves the maximum number of samples held in the archive */
+	 G_API_COMMON std::size_t getMaxArchiveSize() const;
+
+private:
+	 /** @brief Solves a symmetric positive definite system in place; returns false if it is not positive definite */
+	 static bool choleskySolve(std::vector<double>&, std::vector<double>&, std::size_t);
+
+	 std::size_t m_nNeighbors; ///< The number of nearest neighbours taking part in a prediction
+	 std::size_t m_maxArchiveSize; ///< The maximum number of samples kept in the archive
+	 std::size_t m_nDims = 0; ///< The dimension of the samples
+
+	 std::vector<double> m_positions; ///< Flat, row-major storage of the sample positions
+	 std::vector<double> m_values; ///< The function values belonging to each sample
+	 std::size_t m_oldest = 0; ///< The slot to be overwritten next once the archive is full
+
+	 std::vector<double> m_scale; ///< Per-dimension inverse ranges used for normalization
+	 bool m_updated = false; ///< Indicates whether update() was called since the first sample was added
+};
+
+/******************************************************************************/
+
+} /* namespace Common */
+} /* namespace Gem */
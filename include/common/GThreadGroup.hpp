@@ -54,6 +54,7 @@
 
 // Standard headers go here
 #include <vector>
+#include <memory>
 #include <mutex>
 #include <thread>
 
@@ -0,0 +1,146 @@
+/**
+ * @file GAsyncFileWriter_tests.hpp
+ *
+ * Tests of the GAsyncFileWriter class
+ */
+
+// Standard headers go here
+#include <string>
+#include <sstream>
+#include <stdexcept>
+
+// Boost headers go here
+#include <boost/test/unit_test.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+
+// Geneva headers go here
+#include "common/GAsyncFileWriter.hpp"
+
+namespace Gem {
+namespace Common {
+namespace Tests {
+
+/******************************************************************************/
+/**
+ * Tests of the file writer with optional background thread
+ */
+class GAsyncFileWriter_tests
+{
+public:
+	 /*************************************************************************/
+	 /**
+	  * Test of features that are expected to work
+	  */
+	 void no_failure_expected() {
+		 //----------------------------------------------------------------------
+
+		 { // Asynchronous and synchronous output are identical and keep the submission order
+			 boost::filesystem::path asyncFile("./GAsyncFileWriter_async.txt");
+			 boost::filesystem::path syncFile("./GAsyncFileWriter_sync.txt");
+
+			 GAsyncFileWriter asyncWriter(true, 3);
+			 GAsyncFileWriter syncWriter(false);
+			 asyncWriter.open(asyncFile, std::ios_base::out | std::ios_base::trunc);
+			 syncWriter.open(syncFile, std::ios_base::out | std::ios_base::trunc);
+			 BOOST_CHECK(asyncWriter.isOpen());
+			 BOOST_CHECK(asyncWriter.isAsync());
+			 BOOST_CHECK(not syncWriter.isAsync());
+
+			 for(std::size_t i=0; i<100; i++) {
+				 auto job = [i](std::ostream& out) { out << i << " " << i*i << std::endl; };
+				 BOOST_CHECK_NO_THROW(asyncWriter.write(job));
+				 BOOST_CHECK_NO_THROW(syncWriter.write(job));
+			 }
+
+			 // All data is visible after a flush, while the file remains open
+			 BOOST_CHECK_NO_THROW(asyncWriter.flush());
+			 BOOST_CHECK(asyncWriter.isOpen());
+			 BOOST_CHECK_NO_THROW(asyncWriter.close());
+			 BOOST_CHECK_NO_THROW(syncWriter.close());
+			 BOOST_CHECK(not asyncWriter.isOpen());
+
+			 std::string asyncContent = readFile(asyncFile);
+			 BOOST_CHECK(not asyncContent.empty());
+			 BOOST_CHECK(asyncContent == readFile(syncFile));
+			 BOOST_CHECK(0 == asyncContent.find("0 0\n1 1\n2 4\n"));
+
+			 boost::filesystem::remove(asyncFile);
+			 boost::filesystem::remove(syncFile);
+		 }
+
+		 //----------------------------------------------------------------------
+
+		 { // Data is appended when a file is reopened
+			 boost::filesystem::path appendFile("./GAsyncFileWriter_append.txt");
+
+			 GAsyncFileWriter writer;
+			 writer.open(appendFile, std::ios_base::out | std::ios_base::trunc);
+			 writer.write([](std::ostream& out) { out << "a"; });
+			 writer.open(appendFile);
+			 writer.write([](std::ostream& out) { out << "b"; });
+			 writer.close();
+
+			 BOOST_CHECK(readFile(appendFile) == "ab");
+			 boost::filesystem::remove(appendFile);
+		 }
+
+		 //----------------------------------------------------------------------
+	 }
+
+	 /*************************************************************************/
+	 /**
+	  * Test features that are expected to fail
+	  */
+	 void failures_expected() {
+		 //----------------------------------------------------------------------
+
+		 { // At least one write must be allowed to be pending
+			 BOOST_CHECK_THROW(GAsyncFileWriter writer(true, 0), gemfony_exception);
+		 }
+
+		 //----------------------------------------------------------------------
+
+		 { // Writing requires an open file
+			 GAsyncFileWriter writer;
+			 BOOST_CHECK_THROW(writer.write([](std::ostream& out) { out << "a"; }), gemfony_exception);
+		 }
+
+		 //----------------------------------------------------------------------
+
+		 { // Errors in background jobs are passed on, and the file is still closed
+			 boost::filesystem::path errorFile("./GAsyncFileWriter_error.txt");
+
+			 GAsyncFileWriter writer;
+			 writer.open(errorFile, std::ios_base::out | std::ios_base::trunc);
+			 writer.write([](std::ostream&) { throw std::runtime_error("write error"); });
+			 writer.write([](std::ostream& out) { out << "a"; });
+			 BOOST_CHECK_THROW(writer.close(), std::runtime_error);
+			 BOOST_CHECK(not writer.isOpen());
+
+			 // Subsequent jobs were still executed
+			 BOOST_CHECK(readFile(errorFile) == "a");
+			 boost::filesystem::remove(errorFile);
+		 }
+
+		 //----------------------------------------------------------------------
+	 }
+
+private:
+	 /*************************************************************************/
+	 /**
+	  * Reads the entire content of a file
+	  */
+	 static std::string readFile(boost::filesystem::path const& p) {
+		 boost::filesystem::ifstream in(p);
+		 std::ostringstream content;
+		 content << in.rdbuf();
+		 return content.str();
+	 }
+};
+
+/******************************************************************************/
+
+} /* namespace Tests */
+} /* namespace Common */
+} /* namespace Gem */
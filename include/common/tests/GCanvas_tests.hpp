@@ -0,0 +1,204 @@
+/**
+ * @file GCanvas_tests.hpp
+ *
+ * Tests of the planar storage, rasterization and difference of GCanvas
+ */
+
+// Standard headers go here
+#include <vector>
+#include <tuple>
+#include <random>
+#include <cmath>
+
+// Boost headers go here
+#include <boost/test/unit_test.hpp>
+
+// Geneva headers go here
+#include "common/GCanvas.hpp"
+#include "common/GExceptions.hpp"
+
+namespace Gem {
+namespace Common {
+namespace Tests {
+
+/******************************************************************************/
+/**
+ * Tests of the vectorized canvas operations against their scalar reference implementations
+ */
+class GCanvas_tests
+{
+public:
+	 /*************************************************************************/
+	 /**
+	  * Test of features that are expected to work
+	  */
+	 void no_failure_expected() {
+		 //----------------------------------------------------------------------
+
+		 { // Pixels may be addressed column by column, and end up in the channels
+			 GCanvas8 canvas(std::make_tuple(std::size_t(5), std::size_t(3)), std::make_tuple(0.1f, 0.2f, 0.3f));
+			 BOOST_CHECK(15 == canvas.getNPixels());
+			 BOOST_CHECK(3 == canvas[4].size());
+
+			 canvas[4][1].r = 0.5f;
+			 canvas.at(2).at(2).b = 0.75f;
+
+			 BOOST_CHECK(0.5f == canvas.getRedChannel()[4*3 + 1]);
+			 BOOST_CHECK(0.75f == canvas.getBlueChannel()[2*3 + 2]);
+			 BOOST_CHECK(0.2f == canvas.getGreenChannel()[4*3 + 1]);
+
+			 const GCanvas8& c_canvas = canvas;
+			 BOOST_CHECK(0.5f == c_canvas[4][1].r);
+		 }
+
+		 //----------------------------------------------------------------------
+
+		 { // The rasterization of triangles matches the scalar implementation
+			 std::mt19937 rng(42);
+			 std::uniform_real_distribution<float> pos(-0.2f, 1.2f);
+			 std::uniform_real_distribution<float> col(0.f, 1.f);
+
+			 // Odd dimensions, so that columns do not fill entire vector registers
+			 auto dim = std::make_tuple(std::size_t(97), std::size_t(61));
+			 GCanvas8 canvas(dim, std::make_tuple(0.f, 0.f, 0.f));
+			 GCanvas8 reference(dim, std::make_tuple(0.f, 0.f, 0.f));
+
+			 for(std::size_t i=0; i<300; i++) {
+				 t_cart t;
+				 t.tr_one = coord2D(pos(rng), pos(rng));
+				 t.tr_two = coord2D(pos(rng), pos(rng));
+				 t.tr_three = coord2D(pos(rng), pos(rng));
+				 t.r = col(rng);
+				 t.g = col(rng);
+				 t.b = col(rng);
+				 t.a = col(rng);
+
+				 canvas.addTriangle(t);
+				 reference.addTriangleScalar(t);
+			 }
+
+			 // Allow for rounding differences at the edges of triangles, should the compiler contract operations
+			 std::size_t nDeviations = 0;
+			 for(std::size_t pos=0; pos<canvas.getNPixels(); pos++) {
+				 if(
+					 std::fabs(canvas.getRedChannel()[pos] - reference.getRedChannel()[pos]) > 1e-5f
+					 || std::fabs(canvas.getGreenChannel()[pos] - reference.getGreenChannel()[pos]) > 1e-5f
+					 || std::fabs(canvas.getBlueChannel()[pos] - reference.getBlueChannel()[pos]) > 1e-5f
+				 ) {
+					 nDeviations++;
+				 }
+			 }
+			 BOOST_CHECK(nDeviations <= canvas.getNPixels()/1000);
+
+			 // Something was actually drawn
+			 BOOST_CHECK(canvas.diffScalar(GCanvas8(dim, std::make_tuple(0.f, 0.f, 0.f))) > 0.f);
+		 }
+
+		 //----------------------------------------------------------------------
+
+		 { // Triangles defined through circles are drawn like their cartesic counterparts
+			 auto dim = std::make_tuple(std::size_t(64), std::size_t(48));
+			 GCanvas16 canvas(dim, std::make_tuple(1.f, 1.f, 1.f));
+			 GCanvas16 reference(dim, std::make_tuple(1.f, 1.f, 1.f));
+
+			 t_circle t_c;
+			 t_c.middle = coord2D(0.5f, 0.5f);
+			 t_c.radius = 0.3f;
+			 t_c.angle1 = 0.1f;
+			 t_c.angle2 = 0.4f;
+			 t_c.angle3 = 0.7f;
+			 t_c.r = 1.f;
+			 t_c.a = 0.5f;
+
+			 t_cart t;
+			 const float pi = boost::math::constants::pi<float>();
+			 t.tr_one = coord2D(0.5f + 0.3f*gcos(0.1f*2.0f*pi), 0.5f + 0.3f*gsin(0.1f*2.0f*pi));
+			 t.tr_two = coord2D(0.5f + 0.3f*gcos(0.4f*2.0f*pi), 0.5f + 0.3f*gsin(0.4f*2.0f*pi));
+			 t.tr_three = coord2D(0.5f + 0.3f*gcos(0.7f*2.0f*pi), 0.5f + 0.3f*gsin(0.7f*2.0f*pi));
+			 t.r = 1.f;
+			 t.a = 0.5f;
+
+			 canvas.addTriangles(std::vector<t_circle>{t_c});
+			 reference.addTriangleScalar(t);
+			 BOOST_CHECK(canvas.diffScalar(reference) < 1e-3f);
+			 BOOST_CHECK(canvas.diffScalar(GCanvas16(dim, std::make_tuple(1.f, 1.f, 1.f))) > 0.f);
+		 }
+
+		 //----------------------------------------------------------------------
+
+		 { // The canvas difference matches the scalar implementation, with and without threads
+			 std::mt19937 rng(4711);
+			 std::uniform_real_distribution<float> col(0.f, 1.f);
+
+			 auto dim = std::make_tuple(std::size_t(301), std::size_t(203));
+			 GCanvas24 c1(dim, std::make_tuple(0.f, 0.f, 0.f));
+			 GCanvas24 c2(dim, std::make_tuple(0.f, 0.f, 0.f));
+			 for(std::size_t i_x=0; i_x<301; i_x++) {
+				 for(std::size_t i_y=0; i_y<203; i_y++) {
+					 c1[i_x][i_y].r = col(rng); c1[i_x][i_y].g = col(rng); c1[i_x][i_y].b = col(rng);
+					 c2[i_x][i_y].r = col(rng); c2[i_x][i_y].g = col(rng); c2[i_x][i_y].b = col(rng);
+				 }
+			 }
+
+			 float scalar = c1.diffScalar(c2);
+			 float planar = c1.diff(c2);
+			 float threaded = c1.diff(c2, 4);
+
+			 BOOST_CHECK(scalar > 0.f);
+			 BOOST_CHECK(std::fabs(planar - scalar) <= 1e-4f*scalar);
+			 BOOST_CHECK(std::fabs(threaded - planar) <= 1e-5f*planar);
+			 BOOST_CHECK(planar == (c1 - c2));
+			 BOOST_CHECK(0.f == c1.diff(c1, 4));
+		 }
+
+		 //----------------------------------------------------------------------
+
+		 { // PPM export and import preserve the image
+			 GCanvas8 canvas(std::make_tuple(std::size_t(7), std::size_t(5)), std::make_tuple(0.f, 0.f, 0.f));
+			 for(std::size_t i_x=0; i_x<7; i_x++) {
+				 for(std::size_t i_y=0; i_y<5; i_y++) {
+					 canvas[i_x][i_y].r = float(i_x)/255.f;
+					 canvas[i_x][i_y].g = float(i_y)/255.f;
+					 canvas[i_x][i_y].b = float(i_x*i_y)/255.f;
+				 }
+			 }
+
+			 GCanvas8 loaded(canvas.toPPM());
+			 BOOST_CHECK(loaded.dimensions() == canvas.dimensions());
+			 BOOST_CHECK(loaded.diff(canvas) < 1e-4f);
+		 }
+
+		 //----------------------------------------------------------------------
+	 }
+
+	 /*************************************************************************/
+	 /**
+	  * Test of features that are expected to fail
+	  */
+	 void failures_expected() {
+		 //----------------------------------------------------------------------
+
+		 { // Checked access outside of the canvas
+			 GCanvas8 canvas(std::make_tuple(std::size_t(5), std::size_t(3)), std::make_tuple(0.f, 0.f, 0.f));
+			 BOOST_CHECK_THROW(canvas.at(5), gemfony_exception);
+			 BOOST_CHECK_THROW(canvas.at(4).at(3), gemfony_exception);
+		 }
+
+		 //----------------------------------------------------------------------
+
+		 { // Canvasses of different size may not be compared
+			 GCanvas8 c1(std::make_tuple(std::size_t(5), std::size_t(3)), std::make_tuple(0.f, 0.f, 0.f));
+			 GCanvas8 c2(std::make_tuple(std::size_t(3), std::size_t(5)), std::make_tuple(0.f, 0.f, 0.f));
+			 BOOST_CHECK_THROW(c1.diff(c2), gemfony_exception);
+			 BOOST_CHECK_THROW(c1.diffScalar(c2), gemfony_exception);
+		 }
+
+		 //----------------------------------------------------------------------
+	 }
+};
+
+/******************************************************************************/
+
+} /* namespace Tests */
+} /* namespace Common */
+} /* namespace Gem */
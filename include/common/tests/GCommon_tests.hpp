@@ -56,7 +56,14 @@
 // Boost header files go here
 
 // Geneva header files go here
+#include "common/tests/GAsyncFileWriter_tests.hpp"
 #include "common/tests/GBoundedBufferT_tests.hpp"
+#include "common/tests/GCanvas_tests.hpp"
+#include "common/tests/GExternalProcess_tests.hpp"
+#include "common/tests/GFormulaParserT_tests.hpp"
+#include "common/tests/GLogger_tests.hpp"
+#include "common/tests/GPlotDesigner_tests.hpp"
+#include "common/tests/GRBFSurrogate_tests.hpp"
 
 using namespace Gem::Common;
 using namespace Gem::Common::Tests;
@@ -83,6 +90,76 @@ public:
 
 		 add(GBoundedBufferT_no_failure_expected_test_case);
 		 add(GBoundedBufferT_failures_expected_test_case);
+
+		 boost::shared_ptr<GFormulaParserT_tests> fp_instance(new GFormulaParserT_tests());
+
+		 test_case* GFormulaParserT_no_failure_expected_test_case
+			 = BOOST_CLASS_TEST_CASE(&GFormulaParserT_tests::no_failure_expected, fp_instance);
+		 test_case* GFormulaParserT_failures_expected_test_case
+			 = BOOST_CLASS_TEST_CASE(&GFormulaParserT_tests::failures_expected, fp_instance);
+
+		 add(GFormulaParserT_no_failure_expected_test_case);
+		 add(GFormulaParserT_failures_expected_test_case);
+
+		 boost::shared_ptr<GRBFSurrogate_tests> rbf_instance(new GRBFSurrogate_tests());
+
+		 test_case* GRBFSurrogate_no_failure_expected_test_case
+			 = BOOST_CLASS_TEST_CASE(&GRBFSurrogate_tests::no_failure_expected, rbf_instance);
+		 test_case* GRBFSurrogate_failures_expected_test_case
+			 = BOOST_CLASS_TEST_CASE(&GRBFSurrogate_tests::failures_expected, rbf_instance);
+
+		 add(GRBFSurrogate_no_failure_expected_test_case);
+		 add(GRBFSurrogate_failures_expected_test_case);
+
+		 boost::shared_ptr<GAsyncFileWriter_tests> afw_instance(new GAsyncFileWriter_tests());
+
+		 test_case* GAsyncFileWriter_no_failure_expected_test_case
+			 = BOOST_CLASS_TEST_CASE(&GAsyncFileWriter_tests::no_failure_expected, afw_instance);
+		 test_case* GAsyncFileWriter_failures_expected_test_case
+			 = BOOST_CLASS_TEST_CASE(&GAsyncFileWriter_tests::failures_expected, afw_instance);
+
+		 add(GAsyncFileWriter_no_failure_expected_test_case);
+		 add(GAsyncFileWriter_failures_expected_test_case);
+
+		 boost::shared_ptr<GLogger_tests> logger_instance(new GLogger_tests());
+
+		 test_case* GLogger_no_failure_expected_test_case
+			 = BOOST_CLASS_TEST_CASE(&GLogger_tests::no_failure_expected, logger_instance);
+		 test_case* GLogger_failures_expected_test_case
+			 = BOOST_CLASS_TEST_CASE(&GLogger_tests::failures_expected, logger_instance);
+
+		 add(GLogger_no_failure_expected_test_case);
+		 add(GLogger_failures_expected_test_case);
+
+		 boost::shared_ptr<GPlotDesigner_tests> gpd_instance(new GPlotDesigner_tests());
+
+		 test_case* GPlotDesigner_no_failure_expected_test_case
+			 = BOOST_CLASS_TEST_CASE(&GPlotDesigner_tests::no_failure_expected, gpd_instance);
+		 test_case* GPlotDesigner_failures_expected_test_case
+			 = BOOST_CLASS_TEST_CASE(&GPlotDesigner_tests::failures_expected, gpd_instance);
+
+		 add(GPlotDesigner_no_failure_expected_test_case);
+		 add(GPlotDesigner_failures_expected_test_case);
+
+		 boost::shared_ptr<GCanvas_tests> canvas_instance(new GCanvas_tests());
+
+		 test_case* GCanvas_no_failure_expected_test_case
+			 = BOOST_CLASS_TEST_CASE(&GCanvas_tests::no_failure_expected, canvas_instance);
+		 test_case* GCanvas_failures_expected_test_case
+			 = BOOST_CLASS_TEST_CASE(&GCanvas_tests::failures_expected, canvas_instance);
+
+		 add(GCanvas_no_failure_expected_test_case);
+		 add(GCanvas_failures_expected_test_case);
+
+		 boost::shared_ptr<GExternalProcess_tests> process_instance(new GExternalProcess_tests());
+
+		 test_case* GExternalProcess_no_failure_expected_test_case
+			 = BOOST_CLASS_TEST_CASE(&GExternalProcess_tests::no_failure_expected, process_instance);
+		 test_case* GExternalProcess_failures_expected_test_case
+			 = BOOST_CLASS_TEST_CASE(&GExternalProcess_tests::failures_expected, process_instance);
+
+		 add(GExternalProcess_no_failure_expected_test_case);
+		 add(GExternalProcess_failures_expected_test_case);
 	 }
 };
 
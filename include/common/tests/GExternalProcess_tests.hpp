@@ -0,0 +1,136 @@
+/**
+ * @file GExternalProcess_tests.hpp
+ *
+ * Tests of the message exchange with persistent external processes
+ */
+
+// Standard headers go here
+#include <string>
+
+// Boost headers go here
+#include <boost/test/unit_test.hpp>
+
+// Geneva headers go here
+#include "common/GExternalProcess.hpp"
+#include "common/GExceptions.hpp"
+
+namespace Gem {
+namespace Common {
+namespace Tests {
+
+/******************************************************************************/
+/**
+ * Tests of frame exchange and automatic restarts, using standard shell tools
+ * as external processes
+ */
+class GExternalProcess_tests
+{
+public:
+	 /*************************************************************************/
+	 /**
+	  * Test of features that are expected to work
+	  */
+	 void no_failure_expected() {
+		 //----------------------------------------------------------------------
+
+		 { // cat returns every frame unchanged, so requests come back as responses from a single process
+			 GExternalProcess process("cat");
+			 BOOST_CHECK(not process.isRunning());
+
+			 std::string response;
+			 for(std::size_t i=0; i<100; i++) {
+				 std::string request(i*97, char(i));
+				 BOOST_CHECK(process.exchange(request, response));
+				 BOOST_CHECK(request == response);
+			 }
+
+			 // Binary data, including zeros, and empty frames
+			 std::string binary("a\0b\nc", 5);
+			 BOOST_CHECK(process.exchange(binary, response));
+			 BOOST_CHECK(binary == response);
+			 BOOST_CHECK(process.exchange(std::string(), response));
+			 BOOST_CHECK(response.empty());
+
+			 // A frame requiring several reads and writes. As cat answers while the request is
+			 // still being sent, the frame must fit into the pipe buffer
+			 std::string large(8*1024, 'x');
+			 BOOST_CHECK(process.exchange(large, response));
+			 BOOST_CHECK(large == response);
+
+			 BOOST_CHECK(process.isRunning());
+			 BOOST_CHECK(1 == process.getNStarts());
+
+			 process.terminate();
+			 BOOST_CHECK(not process.isRunning());
+		 }
+
+		 //----------------------------------------------------------------------
+
+		 { // A process answering a single 3-byte request and exiting afterwards is restarted after each failure
+			 GExternalProcess process("head -c 7");
+
+			 std::string response;
+			 BOOST_CHECK(process.exchange("abc", response));
+			 BOOST_CHECK("abc" == response);
+
+			 BOOST_CHECK(not process.exchange("abc", response));
+			 BOOST_CHECK(not process.isRunning());
+			 BOOST_CHECK(not process.getLastError().empty());
+
+			 BOOST_CHECK(process.exchange("abc", response));
+			 BOOST_CHECK("abc" == response);
+			 BOOST_CHECK(2 == process.getNStarts());
+		 }
+
+		 //----------------------------------------------------------------------
+
+		 { // A crashing process results in failed exchanges rather than the termination of the caller
+			 GExternalProcess process("kill -SEGV $$");
+
+			 std::string response;
+			 BOOST_CHECK(not process.exchange(std::string(1024*1024, 'x'), response));
+			 BOOST_CHECK(not process.getLastError().empty());
+			 BOOST_CHECK(not process.exchange("abc", response));
+			 BOOST_CHECK(2 == process.getNStarts());
+		 }
+
+		 //----------------------------------------------------------------------
+
+		 { // Responses exceeding the allowed size are rejected
+			 GExternalProcess process("cat", 16);
+
+			 std::string response;
+			 BOOST_CHECK(process.exchange(std::string(16, 'x'), response));
+			 BOOST_CHECK(not process.exchange(std::string(17, 'x'), response));
+			 BOOST_CHECK(not process.isRunning());
+		 }
+
+		 //----------------------------------------------------------------------
+	 }
+
+	 /*************************************************************************/
+	 /**
+	  * Test of features that are expected to fail
+	  */
+	 void failures_expected() {
+		 //----------------------------------------------------------------------
+
+		 { // An empty command line is rejected
+			 BOOST_CHECK_THROW(GExternalProcess process(""), gemfony_exception);
+		 }
+
+		 //----------------------------------------------------------------------
+
+		 { // The maximum frame size must be positive
+			 BOOST_CHECK_THROW(GExternalProcess process("cat", 0), gemfony_exception);
+		 }
+
+		 //----------------------------------------------------------------------
+	 }
+};
+
+/******************************************************************************/
+
+} /* namespace Tests */
+} /* namespace Common */
+} /* namespace Gem */
@@ -0,0 +1,112 @@
+/**
+ * @file GFormulaParserT_tests.hpp
+ *
+ * Tests of the GFormulaParserT class
+ */
+
+// Standard headers go here
+#include <vector>
+#include <string>
+#include <map>
+#include <cmath>
+
+// Boost headers go here
+#include <boost/test/unit_test.hpp>
+
+// Geneva headers go here
+#include "common/GFormulaParserT.hpp"
+
+namespace Gem {
+namespace Common {
+namespace Tests {
+
+/******************************************************************************/
+/**
+ * Tests of the formula parser, in particular of the pre-compiled evaluation path
+ */
+class GFormulaParserT_tests
+{
+public:
+	 /*************************************************************************/
+	 /**
+	  * Test of features that are expected to work
+	  */
+	 void no_failure_expected() {
+		 //----------------------------------------------------------------------
+
+		 { // Check that the pre-compiled path yields the same results as evaluate()
+			 std::vector<std::string> formulas {
+				 "pow(sin({{x}})*sqrt(fabs({{y[1]}})) - ({{y[0]}}*pi), 2)"
+				 , "pow({{x}}, 2) + hypot({{y[0]}}, {{y[1]}}) - min({{x}}, max({{y[0]}}, e))"
+				 , "exp(-{{x}}*{{x}}) / (1 + {{y[1]}}*{{y[1]}}) + cos({{x}}) * tanh({{y[0]}})"
+				 , "3.5 * (2 - 1) + floor(2.7) - ceil(-1.3)"
+			 };
+
+			 for(auto const& formula: formulas) {
+				 GFormulaParserT<double> reference(formula);
+				 GFormulaParserT<double> compiled(formula);
+
+				 for(std::size_t i=0; i<50; i++) {
+					 std::map<std::string, std::vector<double>> vm;
+					 vm["x"] = std::vector<double>{-2.5 + 0.1*double(i)};
+					 vm["y"] = std::vector<double>{0.3*double(i) - 4., 1. + 0.05*double(i)};
+
+					 double expected = reference.evaluate(vm);
+					 double actual = compiled.evaluateCompiled(vm);
+
+					 // evaluate() passes values through their string representation
+					 BOOST_CHECK_MESSAGE(
+						 std::fabs(expected - actual) <= 1e-6*(1. + std::fabs(expected))
+						 , "Formula " << formula << ": " << expected << " / " << actual
+					 );
+				 }
+			 }
+		 }
+
+		 //----------------------------------------------------------------------
+
+		 { // Check that evaluate() still works after the code was pre-compiled
+			 GFormulaParserT<double> f("{{x}} * 2");
+			 std::map<std::string, std::vector<double>> vm;
+			 vm["x"] = std::vector<double>{1.5};
+			 BOOST_CHECK(f.evaluateCompiled(vm) == 3.);
+			 BOOST_CHECK(f.evaluate(vm) == 3.);
+			 vm["x"] = std::vector<double>{4.};
+			 BOOST_CHECK(f.evaluateCompiled(vm) == 8.);
+		 }
+
+		 //----------------------------------------------------------------------
+	 }
+
+	 /*************************************************************************/
+	 /**
+	  * Test features that are expected to fail
+	  */
+	 void failures_expected() {
+		 //----------------------------------------------------------------------
+
+		 { // Missing values for place holders should be reported
+			 GFormulaParserT<double> f("{{x}} + {{z}}");
+			 std::map<std::string, std::vector<double>> vm;
+			 vm["x"] = std::vector<double>{1.};
+			 BOOST_CHECK_THROW(f.evaluateCompiled(vm), gemfony_exception);
+		 }
+
+		 //----------------------------------------------------------------------
+
+		 { // Math errors are detected in the pre-compiled code as well
+			 GFormulaParserT<double> f("1/{{x}}");
+			 std::map<std::string, std::vector<double>> vm;
+			 vm["x"] = std::vector<double>{0.};
+			 BOOST_CHECK_THROW(f.evaluateCompiled(vm), math_logic_error);
+		 }
+
+		 //----------------------------------------------------------------------
+	 }
+};
+
+/******************************************************************************/
+
+} /* namespace Tests */
+} /* namespace Common */
+} /* namespace Gem */
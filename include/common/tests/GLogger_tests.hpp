@@ -0,0 +1,193 @@
+/**
+ * @file GLogger_tests.hpp
+ *
+ * Tests of the asynchronous mode of the GLogger class
+ */
+
+// Standard headers go here
+#include <string>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <future>
+#include <memory>
+
+// Boost headers go here
+#include <boost/test/unit_test.hpp>
+
+// Geneva headers go here
+#include "common/GLogger.hpp"
+
+namespace Gem {
+namespace Common {
+namespace Tests {
+
+/******************************************************************************/
+/**
+ * A log target that records all messages. Output may be blocked, so that
+ * messages pile up in the logger's queue.
+ */
+class GRecordingLogTarget : public GBaseLogTarget {
+public:
+	 void log(std::string const& msg) const override {
+		 {
+			 std::unique_lock<std::mutex> lk(m_mutex);
+			 m_messages.push_back(msg);
+			 if(m_entered_ptr) {
+				 m_entered_ptr->set_value();
+				 m_entered_ptr.reset();
+			 }
+		 }
+		 m_release.wait();
+	 }
+
+	 void logWithSource(std::string const& msg, std::string const& extension) const override {
+		 this->log(extension + ": " + msg);
+	 }
+
+	 /** Blocks output of the next message until release() is called */
+	 std::future<void> block() {
+		 std::unique_lock<std::mutex> lk(m_mutex);
+		 m_entered_ptr = std::make_shared<std::promise<void>>();
+		 m_release_promise = std::promise<void>();
+		 m_release = m_release_promise.get_future().share();
+		 return m_entered_ptr->get_future();
+	 }
+
+	 void release() {
+		 m_release_promise.set_value();
+	 }
+
+	 std::vector<std::string> messages() const {
+		 std::unique_lock<std::mutex> lk(m_mutex);
+		 return m_messages;
+	 }
+
+private:
+	 mutable std::mutex m_mutex;
+	 mutable std::vector<std::string> m_messages;
+	 mutable std::shared_ptr<std::promise<void>> m_entered_ptr;
+	 std::promise<void> m_release_promise;
+	 std::shared_future<void> m_release = GRecordingLogTarget::released();
+
+	 static std::shared_future<void> released() {
+		 std::promise<void> p;
+		 p.set_value();
+		 return p.get_future().share();
+	 }
+};
+
+/******************************************************************************/
+/**
+ * Tests of the asynchronous log queue
+ */
+class GLogger_tests
+{
+public:
+	 /*************************************************************************/
+	 /**
+	  * Test of features that are expected to work
+	  */
+	 void no_failure_expected() {
+		 //----------------------------------------------------------------------
+
+		 { // All messages submitted from several threads are output
+			 GLogger<GLogStreamer> logger;
+			 auto target_ptr = std::make_shared<GRecordingLogTarget>();
+			 logger.addLogTarget(target_ptr);
+			 logger.setAsync(true);
+			 BOOST_CHECK(logger.isAsync());
+
+			 const std::size_t NTHREADS = 4, NMESSAGES = 250;
+			 std::vector<std::thread> threads;
+			 for(std::size_t t=0; t<NTHREADS; t++) {
+				 threads.emplace_back([&logger, t]() {
+					 for(std::size_t m=0; m<NMESSAGES; m++) {
+						 logger.log(std::to_string(t) + "/" + std::to_string(m) + "\n");
+					 }
+				 });
+			 }
+			 for(auto& t: threads) t.join();
+			 logger.flush();
+
+			 BOOST_CHECK(target_ptr->messages().size() == NTHREADS*NMESSAGES);
+			 BOOST_CHECK(0 == logger.getNDroppedMessages());
+
+			 // Switching back outputs messages immediately
+			 logger.setAsync(false);
+			 BOOST_CHECK(not logger.isAsync());
+			 logger.log("sync\n");
+			 BOOST_CHECK(target_ptr->messages().back() == "sync\n");
+		 }
+
+		 //----------------------------------------------------------------------
+
+		 { // Repeated messages are coalesced and messages are dropped when the queue is full
+			 GLogger<GLogStreamer> logger;
+			 auto target_ptr = std::make_shared<GRecordingLogTarget>();
+			 logger.addLogTarget(target_ptr);
+			 logger.setAsync(true, 4);
+			 BOOST_CHECK(logger.getMaxQueueSize() == 4);
+
+			 // Keep the writer busy with the first message
+			 std::future<void> entered = target_ptr->block();
+			 logger.log("first\n");
+			 entered.wait();
+
+			 for(std::size_t i=0; i<5; i++) logger.log("repeated\n");
+			 for(std::size_t i=0; i<6; i++) logger.logWithSource("distinct " + std::to_string(i) + "\n", "src");
+
+			 target_ptr->release();
+			 logger.flush();
+
+			 // first, repeated + notice, 3 distinct messages and the drop notice
+			 std::vector<std::string> messages = target_ptr->messages();
+			 BOOST_REQUIRE(messages.size() == 7);
+			 BOOST_CHECK(messages[0] == "first\n");
+			 BOOST_CHECK(messages[1] == "repeated\n");
+			 BOOST_CHECK(messages[2].find("repeated 4 more times") != std::string::npos);
+			 BOOST_CHECK(messages[3] == "src: distinct 0\n");
+			 BOOST_CHECK(messages[5] == "src: distinct 2\n");
+			 BOOST_CHECK(messages[6].find("3 log messages were dropped") != std::string::npos);
+			 BOOST_CHECK(3 == logger.getNDroppedMessages());
+		 }
+
+		 //----------------------------------------------------------------------
+
+		 { // Pending messages are output upon destruction
+			 auto target_ptr = std::make_shared<GRecordingLogTarget>();
+			 {
+				 GLogger<GLogStreamer> logger;
+				 logger.addLogTarget(target_ptr);
+				 logger.setAsync(true);
+				 for(std::size_t i=0; i<100; i++) logger.log(std::to_string(i) + "\n");
+			 }
+			 BOOST_CHECK(target_ptr->messages().size() == 100);
+			 BOOST_CHECK(target_ptr->messages().back() == "99\n");
+		 }
+
+		 //----------------------------------------------------------------------
+	 }
+
+	 /*************************************************************************/
+	 /**
+	  * Test features that are expected to fail
+	  */
+	 void failures_expected() {
+		 //----------------------------------------------------------------------
+
+		 { // The queue must be able to hold at least one message
+			 GLogger<GLogStreamer> logger;
+			 BOOST_CHECK_THROW(logger.setAsync(true, 0), gemfony_exception);
+			 BOOST_CHECK(not logger.isAsync());
+		 }
+
+		 //----------------------------------------------------------------------
+	 }
+};
+
+/******************************************************************************/
+
+} /* namespace Tests */
+} /* namespace Common */
+} /* namespace Gem */
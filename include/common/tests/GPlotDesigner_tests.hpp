@@ -0,0 +1,234 @@
+/**
+ * @file GPlotDesigner_tests.hpp
+ *
+ * Tests of the bounded-memory data collection of the GPlotDesigner classes
+ */
+
+// Standard headers go here
+#include <vector>
+#include <tuple>
+#include <random>
+#include <stdexcept>
+
+// Boost headers go here
+#include <boost/test/unit_test.hpp>
+
+// Geneva headers go here
+#include "common/GPlotDesigner.hpp"
+#include "common/GExceptions.hpp"
+
+namespace Gem {
+namespace Common {
+namespace Tests {
+
+/******************************************************************************/
+/**
+ * Tests of data reduction and streaming histograms
+ */
+class GPlotDesigner_tests
+{
+public:
+	 /*************************************************************************/
+	 /**
+	  * Test of features that are expected to work
+	  */
+	 void no_failure_expected() {
+		 //----------------------------------------------------------------------
+
+		 { // Reservoir sampling keeps a bounded number of points from the entire stream
+			 GGraph2D graph;
+			 graph.setDataReduction(dataReductionMode::RESERVOIR, 100);
+
+			 for(std::size_t i=0; i<10000; i++) {
+				 graph.add(double(i), double(i));
+			 }
+
+			 BOOST_CHECK(100 == graph.currentSize());
+			 BOOST_CHECK(10000 == graph.getNDataPointsSeen());
+
+			 // The sample should reach far into the stream rather than keep the first points only
+			 BOOST_CHECK(std::get<1>(graph.getMinMaxElements()) > 5000.);
+		 }
+
+		 //----------------------------------------------------------------------
+
+		 { // Decimation keeps every n-th point, starting with the first one
+			 GGraph2D graph;
+			 graph.setDataReduction(dataReductionMode::DECIMATION, 100);
+
+			 for(std::size_t i=0; i<10000; i++) {
+				 graph.add(double(i), double(i));
+			 }
+
+			 // Stride 128 after halving the stored points seven times
+			 BOOST_CHECK(graph.currentSize() <= 100);
+			 BOOST_CHECK(graph.currentSize() > 50);
+			 auto minmax = graph.getMinMaxElements();
+			 BOOST_CHECK(0. == std::get<0>(minmax));
+			 BOOST_CHECK(double(128*(9999/128)) == std::get<1>(minmax));
+
+			 // A sorted set of points remains sorted
+			 GGraph2D sorted(graph);
+			 sorted.sortX();
+			 BOOST_CHECK(sorted.bodyData("") == graph.bodyData(""));
+		 }
+
+		 //----------------------------------------------------------------------
+
+		 { // Without data reduction all points are stored
+			 GGraph2D graph;
+			 for(std::size_t i=0; i<1000; i++) {
+				 graph.add(double(i), 0.);
+			 }
+			 BOOST_CHECK(1000 == graph.currentSize());
+		 }
+
+		 //----------------------------------------------------------------------
+
+		 { // Streaming histograms with a fixed range count like a direct count, including under- and overflow
+			 GHistogram1D hist(10, 0., 10.);
+			 hist.add(-1.); // Stored raw data is moved into the bins
+			 hist.setStreaming(true);
+			 BOOST_CHECK(hist.isStreaming());
+
+			 std::vector<double> expected(12, 0.);
+			 expected[0] = 1.;
+			 for(std::size_t i=0; i<1000; i++) {
+				 double x = 0.25 + 0.5*double(i%20); // Never on a bin boundary
+				 hist.add(x);
+				 expected[std::size_t(x) + 1] += 1.;
+			 }
+			 hist.add(10.);
+			 expected[11] += 1.;
+
+			 BOOST_CHECK(0 == hist.currentSize());
+			 BOOST_CHECK(1002 == hist.getNEntries());
+			 for(std::size_t bin=0; bin<12; bin++) {
+				 BOOST_CHECK(expected[bin] == hist.getBinContent(bin));
+			 }
+		 }
+
+		 //----------------------------------------------------------------------
+
+		 { // Streaming histograms with automatic range widen their range without losing entries
+			 const std::size_t nBins = 8;
+			 GHistogram1D hist(nBins);
+			 hist.setStreaming(true);
+
+			 std::vector<double> values;
+			 for(std::size_t i=0; i<DEFNHISTWARMUPPOINTS; i++) {
+				 values.push_back(double(i%9)); // Range [0,8]
+			 }
+			 for(std::size_t i=0; i<1000; i++) {
+				 values.push_back(0.5 + double(i%60));
+			 }
+			 values.push_back(-0.5);
+
+			 for(std::size_t i=0; i<values.size(); i++) {
+				 hist.add(values[i]);
+				 if(i+1 < DEFNHISTWARMUPPOINTS) {
+					 BOOST_CHECK(i+1 == hist.currentSize()); // Still buffering
+				 }
+			 }
+
+			 BOOST_CHECK(0 == hist.currentSize());
+			 BOOST_CHECK(values.size() == hist.getNEntries());
+			 BOOST_CHECK(hist.getMinX() <= -0.5);
+			 BOOST_CHECK(hist.getMaxX() > 59.5);
+
+			 // Compare with a direct count in the final range
+			 std::vector<double> expected(nBins+2, 0.);
+			 for(auto x: values) {
+				 auto bin = std::size_t((x - hist.getMinX()) / (hist.getMaxX() - hist.getMinX()) * double(nBins));
+				 expected[std::min(bin, nBins-1) + 1] += 1.;
+			 }
+			 for(std::size_t bin=0; bin<nBins+2; bin++) {
+				 BOOST_CHECK(expected[bin] == hist.getBinContent(bin));
+			 }
+		 }
+
+		 //----------------------------------------------------------------------
+
+		 { // 2D streaming histograms with automatic ranges keep all entries in the bins
+			 GHistogram2D hist(10, 5);
+			 hist.setStreaming(true);
+
+			 std::mt19937 rng;
+			 std::uniform_real_distribution<double> uniform(0., 1.);
+			 const std::size_t nEntries = 5000;
+			 for(std::size_t i=0; i<nEntries; i++) {
+				 hist.add(double(i/50), uniform(rng)*double(1 + i/1000));
+			 }
+
+			 BOOST_CHECK(0 == hist.currentSize());
+			 BOOST_CHECK(nEntries == hist.getNEntries());
+			 BOOST_CHECK(hist.getMaxX() > 99.);
+
+			 double sum = 0.;
+			 for(std::size_t binX=0; binX<12; binX++) {
+				 for(std::size_t binY=0; binY<7; binY++) {
+					 double content = hist.getBinContent(binX, binY);
+					 if(0==binX || 11==binX || 0==binY || 6==binY) {
+						 BOOST_CHECK(0. == content); // Adaptive ranges leave under- and overflow bins empty
+					 }
+					 sum += content;
+				 }
+			 }
+			 BOOST_CHECK(double(nEntries) == sum);
+
+			 // Streaming state survives copying
+			 GHistogram2D copy(hist);
+			 BOOST_CHECK(copy.getBinContent(1, 1) == hist.getBinContent(1, 1));
+			 BOOST_CHECK(copy.bodyData("") == hist.bodyData(""));
+		 }
+
+		 //----------------------------------------------------------------------
+	 }
+
+	 /*************************************************************************/
+	 /**
+	  * Test of features that are expected to fail
+	  */
+	 void failures_expected() {
+		 //----------------------------------------------------------------------
+
+		 { // The reduction mode may not be changed once data was added
+			 GGraph2D graph;
+			 graph.add(1., 1.);
+			 BOOST_CHECK_THROW(graph.setDataReduction(dataReductionMode::RESERVOIR, 10), gemfony_exception);
+		 }
+
+		 //----------------------------------------------------------------------
+
+		 { // At least two points must be retained
+			 GGraph2D graph;
+			 BOOST_CHECK_THROW(graph.setDataReduction(dataReductionMode::DECIMATION, 1), gemfony_exception);
+		 }
+
+		 //----------------------------------------------------------------------
+
+		 { // Streaming mode cannot be left once the raw data is gone
+			 GHistogram1D hist(10, 0., 1.);
+			 hist.setStreaming(true);
+			 hist.add(0.5);
+			 BOOST_CHECK_THROW(hist.setStreaming(false), gemfony_exception);
+		 }
+
+		 //----------------------------------------------------------------------
+
+		 { // Bin contents are only available in streaming mode
+			 GHistogram1D hist(10, 0., 1.);
+			 BOOST_CHECK_THROW(hist.getBinContent(1), gemfony_exception);
+			 hist.setStreaming(true);
+			 BOOST_CHECK_THROW(hist.getBinContent(12), gemfony_exception);
+		 }
+
+		 //----------------------------------------------------------------------
+	 }
+};
+
+/******************************************************************************/
+
+} /* namespace Tests */
+} /* namespace Common */
+} /* namespace Gem */
@@ -0,0 +1,151 @@
+/**
+ * @file GRBFSurrogate_tests.hpp
+ *
+ * Tests of the GRBFSurrogate class
+ */
+
+// Standard headers go here
+#include <vector>
+#include <random>
+#include <cmath>
+
+// Boost headers go here
+#include <boost/test/unit_test.hpp>
+
+// Geneva headers go here
+#include "common/GRBFSurrogate.hpp"
+
+namespace Gem {
+namespace Common {
+namespace Tests {
+
+/******************************************************************************/
+/**
+ * Tests of the radial basis function surrogate model
+ */
+class GRBFSurrogate_tests
+{
+public:
+	 /*************************************************************************/
+	 /**
+	  * Test of features that are expected to work
+	  */
+	 void no_failure_expected() {
+		 auto sphere = [](const std::vector<double>& x) { return x[0]*x[0] + x[1]*x[1]; };
+
+		 std::mt19937 gen(42);
+		 std::uniform_real_distribution<double> uniform(-1., 1.);
+
+		 //----------------------------------------------------------------------
+
+		 { // Predictions at training points reproduce the training values
+			 GRBFSurrogate s(5, 100);
+			 std::vector<std::vector<double>> positions;
+			 for(std::size_t i=0; i<50; i++) {
+				 std::vector<double> x {uniform(gen), uniform(gen)};
+				 positions.push_back(x);
+				 s.addSample(x, sphere(x));
+			 }
+			 s.update();
+			 BOOST_CHECK(s.isReady());
+			 BOOST_CHECK(s.getNDimensions() == 2);
+
+			 for(auto const& x: positions) {
+				 BOOST_CHECK_MESSAGE(
+					 sphere(x) == s.predict(x)
+					 , "Got " << s.predict(x) << " instead of " << sphere(x) << "\n"
+				 );
+			 }
+		 }
+
+		 //----------------------------------------------------------------------
+
+		 { // Predictions approximate the function and mostly rank candidates correctly
+			 GRBFSurrogate s;
+			 for(std::size_t i=0; i<200; i++) {
+				 std::vector<double> x {uniform(gen), uniform(gen)};
+				 s.addSample(x, sphere(x));
+			 }
+			 s.update();
+
+			 std::vector<double> expected, predicted;
+			 double absError = 0.;
+			 for(std::size_t i=0; i<50; i++) {
+				 std::vector<double> x {0.9*uniform(gen), 0.9*uniform(gen)};
+				 expected.push_back(sphere(x));
+				 predicted.push_back(s.predict(x));
+				 absError += std::fabs(expected.back() - predicted.back());
+			 }
+			 absError /= double(expected.size());
+			 BOOST_CHECK_MESSAGE(absError < 0.02, "Mean absolute error " << absError << " is too large\n");
+
+			 std::size_t concordant = 0, pairs = 0;
+			 for(std::size_t i=0; i<expected.size(); i++) {
+				 for(std::size_t j=i+1; j<expected.size(); j++) {
+					 pairs++;
+					 if((expected[i] < expected[j]) == (predicted[i] < predicted[j])) concordant++;
+				 }
+			 }
+			 BOOST_CHECK_MESSAGE(
+				 double(concordant) > 0.9*double(pairs)
+				 , "Only " << concordant << " of " << pairs << " pairs were ranked correctly\n"
+			 );
+		 }
+
+		 //----------------------------------------------------------------------
+
+		 { // The archive is bounded and clear() resets the model
+			 GRBFSurrogate s(3, 20);
+			 for(std::size_t i=0; i<50; i++) {
+				 s.addSample(std::vector<double>{double(i)}, double(i));
+			 }
+			 BOOST_CHECK(s.size() == 20);
+			 s.update();
+			 // The most recent samples have replaced the oldest ones
+			 BOOST_CHECK(s.predict(std::vector<double>{49.}) == 49.);
+
+			 s.clear();
+			 BOOST_CHECK(s.size() == 0);
+			 BOOST_CHECK(not s.isReady());
+			 BOOST_CHECK_NO_THROW(s.addSample(std::vector<double>{1., 2., 3.}, 1.));
+		 }
+
+		 //----------------------------------------------------------------------
+	 }
+
+	 /*************************************************************************/
+	 /**
+	  * Test features that are expected to fail
+	  */
+	 void failures_expected() {
+		 //----------------------------------------------------------------------
+
+		 { // Predictions require samples
+			 GRBFSurrogate s;
+			 BOOST_CHECK_THROW(s.predict(std::vector<double>{1.}), gemfony_exception);
+		 }
+
+		 //----------------------------------------------------------------------
+
+		 { // Samples and queries must have matching dimensions
+			 GRBFSurrogate s;
+			 s.addSample(std::vector<double>{1., 2.}, 1.);
+			 BOOST_CHECK_THROW(s.addSample(std::vector<double>{1.}, 1.), gemfony_exception);
+			 BOOST_CHECK_THROW(s.predict(std::vector<double>{1., 2., 3.}), gemfony_exception);
+		 }
+
+		 //----------------------------------------------------------------------
+
+		 { // At least one neighbour is needed
+			 BOOST_CHECK_THROW(GRBFSurrogate s(0, 10), gemfony_exception);
+		 }
+
+		 //----------------------------------------------------------------------
+	 }
+};
+
+/******************************************************************************/
+
+} /* namespace Tests */
+} /* namespace Common */
+} /* namespace Gem */
@@ -1092,8 +1092,12 @@ private:
 	 std::shared_ptr<processable_type> getPayloadItem() {
 		 std::shared_ptr<processable_type> p;
 
-		 // Try to retrieve a work item from the broker
-		 m_broker_ptr->get(p, m_timeout);
+		 // Try to retrieve a work item from the broker. Items whose cancellation was
+		 // requested while they were waiting are sent back right away instead of
+		 // occupying a client.
+		 while(m_broker_ptr->get(p, m_timeout) && p->cancel_if_requested()) {
+			 this->putPayloadItem(p);
+		 }
 
 		 // May be empty, if we ran into a timeout
 		 return p;
@@ -136,6 +136,7 @@ enum class processingStatus : Gem::Common::ENUMBASETYPE {
 	 , PROCESSED = 2 // Set when processing has taken place. Object value is well defined.
 	 , EXCEPTION_CAUGHT = 3 // Set by GProcessingContainerT when an exception was caught. No defined object value.
 	 , ERROR_FLAGGED = 4 // Set by an external entity when errors have occurred during processing. No defined object value.
+	 , CANCELLED = 5 // Set when processing was cancelled on request. No defined object value.
 };
 
 /******************************************************************************/
@@ -269,6 +269,10 @@ public:
 			 );
 		 }
 
+		 //------------------------------------------------------------------------------------------
+		 // Cancellation requests only refer to the current call
+		 m_cancellation_requested.store(false);
+
 		 //------------------------------------------------------------------------------------------
 		 // Assign an external iteration id to the iteration counter, if requested by the user
 		 bool useExternalId = std::get<1>(externalIterationCounter);
@@ -352,6 +356,35 @@ public:
 		 return status;
 	 }
 
+	 /***************************************************************************/
+	 /**
+	  * Requests cancellation of all items of the currently running workOn() call
+	  * that have not yet returned. This function may be called from any thread.
+	  * Items that have not been started are not processed at all, running items
+	  * are stopped if the user code polls cancellationRequested(). Cancelled
+	  * items return with the CANCELLED status and count as erroneous items.
+	  * Items that are already being processed by remote clients run to completion,
+	  * unless they cancel themselves through their cancellation bound.
+	  */
+	 void requestCancellation() noexcept {
+		 m_cancellation_requested.store(true);
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Registers a function that is consulted whenever items have returned. If it
+	  * returns true, the outcome of the current submission is considered decided
+	  * (e.g. because enough items have beaten a given threshold), and all items
+	  * that have not yet returned are cancelled.
+	  *
+	  * @param check A function telling whether the remaining items of a submission are still needed
+	  */
+	 void registerCancellationCheck(
+		 std::function<bool(const std::vector<std::shared_ptr<processable_type>>&)> check
+	 ) {
+		 m_cancellation_check = check;
+	 }
+
 	/***************************************************************************/
 	/**
      * Code to be executed before the start of an iteration (i.e. a call to workOn)
@@ -645,6 +678,7 @@ protected:
 		 // Count the number of work items with errors. We need to count two flags
 		 m_n_erroneousItems  = this->countItemsWithStatus(workItems, processingStatus::ERROR_FLAGGED);
 		 m_n_erroneousItems += this->countItemsWithStatus(workItems, processingStatus::EXCEPTION_CAUGHT);
+		 m_n_erroneousItems += this->countItemsWithStatus(workItems, processingStatus::CANCELLED);
 
 		 // Make it known that the first iteration has ended (if this is the first iteration)
 		 if(m_in_first_iteration) {
@@ -740,6 +774,9 @@ protected:
 				 // Do the actual submission
 				 this->submit(w_ptr);
 
+				 // Serial execution processes items inside of submit(), so the outcome may already be decided
+				 this->checkCancellation(workItems);
+
 				 // Assign the id of the first processable item in this iteration. This is
 				 // so we can identify the first individual in the first iteration.
 				 if(not got_first_processable_item_id) {
@@ -769,7 +806,7 @@ protected:
 
 				 // Update the submission counter
 				 nSubmittedItems++;
-			 } else if(processingStatus::DO_IGNORE != ps && processingStatus::PROCESSED != ps) {
+			 } else if(processingStatus::DO_IGNORE != ps && processingStatus::PROCESSED != ps && processingStatus::CANCELLED != ps) {
 				 throw gemfony_exception(
 					 g_error_streamer(DO_LOG, time_and_place)
 						 << "In GBaseExecutorT<processable_type>::submitAllWorkItems(): Error" << std::endl
@@ -846,6 +883,34 @@ protected:
 		 , std::vector<std::shared_ptr<processable_type>>&
 	 ) BASE = 0;
 
+	 /***************************************************************************/
+	 /**
+	  * Cancels all items that have not yet returned, if cancellation was requested
+	  * by the user or the registered cancellation check considers the outcome of
+	  * the current submission decided. Derived classes should call this function
+	  * whenever items have returned.
+	  *
+	  * @param workItems The work items of the current submission
+	  * @return A boolean indicating whether items were cancelled
+	  */
+	 bool checkCancellation(
+		 const std::vector<std::shared_ptr<processable_type>>& workItems
+	 ) {
+		 if(not m_cancellation_requested.load() && not (m_cancellation_check && m_cancellation_check(workItems))) {
+			 return false;
+		 }
+
+		 bool cancelled = false;
+		 for(auto const& w_ptr: workItems) {
+			 if(w_ptr->is_due_for_processing() && not w_ptr->cancellationRequested()) {
+				 w_ptr->requestCancellation();
+				 cancelled = true;
+			 }
+		 }
+
+		 return cancelled;
+	 }
+
 	 /***************************************************************************/
 	 /**
 	  * Count the number of work items in a batch with a specific flag
@@ -895,6 +960,10 @@ protected:
 			 workItems
 			 , processingStatus::EXCEPTION_CAUGHT
 		 );
+		 nErrorState     += this->countItemsWithStatus(
+			 workItems
+			 , processingStatus::CANCELLED
+		 );
 		 if(nErrorState > 0) has_errors = true;
 
 		 return executor_status_t{is_complete, has_errors};
@@ -1057,6 +1126,9 @@ private:
 	 std::vector<std::shared_ptr<processable_type>> m_old_work_items_cnt; ///< Temporarily holds old work items of the current iteration
 
 	 std::mutex m_concurrent_workon_mutex; ///< Makes sure the workOn function is only called once at the same time on this object
+
+	 std::atomic<bool> m_cancellation_requested{false}; ///< Set by the user to cancel outstanding items of the current submission
+	 std::function<bool(const std::vector<std::shared_ptr<processable_type>>&)> m_cancellation_check; ///< Tells whether outstanding items are still needed
 };
 
 /******************************************************************************/
@@ -1654,6 +1726,9 @@ protected:
 			 // Retrieve the future and check for errors
 			 try {
 				 result_type r = f.get();
+
+				 // Items still waiting in the pool may no longer be needed
+				 this->checkCancellation(workItems);
 #ifdef DEBUG
 			 } catch(const g_processing_exception& e) {
 				 // This is an expected exception if processing has failed. We do nothing,
@@ -2237,6 +2312,9 @@ private:
 			 // No need to continue if all currently submitted work items have returned
 			 if(status.is_complete) break;
 
+			 // Items that have not yet returned may no longer be needed
+			 this->checkCancellation(workItems);
+
 			 // For succesfully processed items, update the internal timeout variables,
 			 // so we know how much longer this cycle should run
 			 if(w_ptr->is_processed()) {
@@ -2280,6 +2358,9 @@ private:
 
 			 // Break the loop if all items (or at least the minimum percentage) were received
 			 if(status.is_complete || this->minPartialReturnRateReached()) break;
+
+			 // Items that have not yet returned may no longer be needed
+			 this->checkCancellation(workItems);
 		 } while(true);
 
 		 // Check for the processing flags and derive the is_complete and has_errors states
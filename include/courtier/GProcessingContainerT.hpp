@@ -46,6 +46,10 @@
 #include <type_traits>
 #include <exception>
 #include <functional>
+#include <atomic>
+#include <memory>
+#include <limits>
+#include <algorithm>
 
 // Boost headers go here
 #include <boost/archive/xml_oarchive.hpp>
@@ -129,7 +133,17 @@ class GProcessingContainerT
 		 & BOOST_SERIALIZATION_NVP(m_stored_results_cnt)
 		 & BOOST_SERIALIZATION_NVP(m_stored_error_descriptions)
 		 & BOOST_SERIALIZATION_NVP(m_processing_status)
-		 & BOOST_SERIALIZATION_NVP(m_evaluation_id);
+		 & BOOST_SERIALIZATION_NVP(m_evaluation_id)
+		 & BOOST_SERIALIZATION_NVP(m_cancellation_bound)
+		 & BOOST_SERIALIZATION_NVP(m_intermediate_bound);
+
+		 // The cancellation flag travels with the item, so that remote consumers
+		 // do not start work on items that have become obsolete in the meantime.
+		 // It is only ever switched on here, as a concurrent cancellation request
+		 // must not be undone by serialization.
+		 bool cancellation_requested = m_cancellation_flag_ptr->load();
+		 ar & make_nvp("m_cancellation_requested", cancellation_requested);
+		 if(cancellation_requested) m_cancellation_flag_ptr->store(true);
 	 }
 
 	 ///////////////////////////////////////////////////////////////////////
@@ -170,6 +184,8 @@ public:
 		 , m_stored_error_descriptions(cp.m_stored_error_descriptions)
 		 , m_processing_status(cp.m_processing_status)
 		 , m_evaluation_id(cp.m_evaluation_id)
+		 , m_cancellation_bound(cp.m_cancellation_bound)
+		 , m_intermediate_bound(cp.m_intermediate_bound)
 	 {
 		 Gem::Common::copyCloneableSmartPointer(cp.m_pre_processor_ptr, m_pre_processor_ptr);
 		 Gem::Common::copyCloneableSmartPointer(cp.m_post_processor_ptr, m_post_processor_ptr);
@@ -198,6 +214,8 @@ public:
 	 	m_stored_error_descriptions = cp.m_stored_error_descriptions;
 	 	m_processing_status = cp.m_processing_status;
 	 	m_evaluation_id = cp.m_evaluation_id;
+	 	m_cancellation_bound = cp.m_cancellation_bound;
+	 	m_intermediate_bound = cp.m_intermediate_bound;
 
 	    Gem::Common::copyCloneableSmartPointer(cp.m_pre_processor_ptr, m_pre_processor_ptr);
 	    Gem::Common::copyCloneableSmartPointer(cp.m_post_processor_ptr, m_post_processor_ptr);
@@ -276,6 +294,12 @@ public:
 		 // Assign a new evaluation id
 		 m_evaluation_id = std::string("eval_") + Gem::Common::to_string(boost::uuids::random_generator()());
 
+		 // No need to start work on an item that is no longer needed
+		 m_intermediate_bound = std::numeric_limits<double>::lowest();
+		 if(this->cancel_if_requested()) {
+			 return this->m_stored_results_cnt.at(0);
+		 }
+
 		 // Clear the error descriptions
 		 m_stored_error_descriptions.clear();
 
@@ -308,6 +332,14 @@ public:
 			 m_post_processing_time = std::chrono::duration<double>(afterPostProcessing - afterProcessing).count();
 
 			 m_processing_status = processingStatus::PROCESSED;
+
+			 // The user code may have given up early after polling cancellationRequested().
+			 // Its results are then meaningless.
+			 if(this->cancellationRequested()) {
+				 m_processing_status = processingStatus::DO_PROCESS;
+				 this->cancel_if_requested();
+				 return this->m_stored_results_cnt.at(0);
+			 }
 		 } catch(boost::exception& e) {
 			 // Let the audience know we had an error
 			 m_processing_status = processingStatus::EXCEPTION_CAUGHT;
@@ -455,9 +487,110 @@ public:
 	  * @return A boolean indicating whether there were errors during processing
 	  */
 	 bool has_errors() const noexcept {
+		 // Cancelled items have no defined value and are treated like erroneous items
 		 return
 			 (processingStatus::EXCEPTION_CAUGHT == m_processing_status)
-			 || (processingStatus::ERROR_FLAGGED == m_processing_status);
+			 || (processingStatus::ERROR_FLAGGED == m_processing_status)
+			 || (processingStatus::CANCELLED == m_processing_status);
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Checks whether processing of this item was cancelled
+	  */
+	 bool is_cancelled() const noexcept {
+		 return (processingStatus::CANCELLED == m_processing_status);
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Requests cancellation of the processing of this item. This function may be
+	  * called from any thread, e.g. by an executor while the item is being processed.
+	  * Items that have not yet been started will not be processed at all. Running
+	  * user code needs to poll cancellationRequested() in order to stop early.
+	  * Cancelled items carry the CANCELLED status and have no defined result.
+	  */
+	 void requestCancellation() noexcept {
+		 m_cancellation_flag_ptr->store(true);
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Allows long-running user code to check whether it should stop processing.
+	  * This is the case if cancellation was requested explicitly, or if the
+	  * intermediate bound reported by the user code exceeds the cancellation bound,
+	  * i.e. the item can no longer become competitive.
+	  *
+	  * @return A boolean indicating whether processing should be stopped
+	  */
+	 bool cancellationRequested() const noexcept {
+		 return m_cancellation_flag_ptr->load() || (m_intermediate_bound > m_cancellation_bound);
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Marks a not yet processed item as cancelled, if a cancellation was
+	  * requested. This allows consumers to drop obsolete items without
+	  * processing them.
+	  *
+	  * @return A boolean indicating whether the item was cancelled
+	  */
+	 bool cancel_if_requested() {
+		 if(processingStatus::DO_PROCESS != m_processing_status || not this->cancellationRequested()) {
+			 return false;
+		 }
+
+		 m_pre_processing_time = 0.;
+		 m_processing_time = 0.;
+		 m_post_processing_time = 0.;
+		 this->clear_stored_results_vec();
+		 m_processing_status = processingStatus::CANCELLED;
+
+		 return true;
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Sets the bound beyond which processing of this item becomes pointless. Bounds
+	  * follow the convention that smaller values are better. The bound is transferred
+	  * together with the item, so that remote consumers may cancel hopeless evaluations.
+	  *
+	  * @param bound The bound beyond which processing should be cancelled
+	  */
+	 void setCancellationBound(double bound) noexcept {
+		 m_cancellation_bound = bound;
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Retrieves the bound beyond which processing of this item becomes pointless
+	  */
+	 double getCancellationBound() const noexcept {
+		 return m_cancellation_bound;
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Allows user code to report an intermediate bound during processing, i.e. a
+	  * value the final result is known not to fall below (smaller values being
+	  * better). Bounds may only become tighter, smaller values than the one already
+	  * reported are ignored. Once the bound exceeds the cancellation bound,
+	  * cancellationRequested() returns true.
+	  *
+	  * @param bound The intermediate bound of the final result
+	  * @return A boolean indicating whether processing should be stopped
+	  */
+	 bool reportIntermediateBound(double bound) noexcept {
+		 m_intermediate_bound = (std::max)(m_intermediate_bound, bound);
+		 return this->cancellationRequested();
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Retrieves the intermediate bound reported during the last processing step
+	  */
+	 double getIntermediateBound() const noexcept {
+		 return m_intermediate_bound;
 	 }
 
 	 /***************************************************************************/
@@ -477,6 +610,7 @@ public:
 	  * - PROCESSED --> PROCESSED, IGNORE, DO_PROCESS
 	  * - EXCEPTION_CAUGHT --> EXCEPTION_CAUGHT, IGNORE, DO_PROCESS
 	  * - ERROR_FLAGGED --> ERROR_FLAGGED, IGNORE, DO_PROCESS
+	  * - CANCELLED --> CANCELLED, IGNORE, DO_PROCESS
 	  * Note that some target states may result in the erasure of existing
 	  * information, such as past error messages. Setting a new processing state
 	  * of "PROCESSED" via this function is not allowed and will result in an
@@ -569,6 +703,7 @@ public:
 
 			 case processingStatus::EXCEPTION_CAUGHT:
 			 case processingStatus::ERROR_FLAGGED:
+			 case processingStatus::CANCELLED:
 				 if(target_ps == processingStatus::DO_IGNORE || target_ps == processingStatus::DO_PROCESS) {
 					 // Store the new state
 					 m_processing_status = target_ps;
@@ -589,6 +724,11 @@ public:
 
 			 //------------------------------------------------------------------------------------
 		 };
+
+		 // A new submission starts without a pending cancellation request
+		 if(processingStatus::DO_PROCESS == m_processing_status) {
+			 m_cancellation_flag_ptr->store(false);
+		 }
 	 }
 
 	 /***************************************************************************/
@@ -597,6 +737,7 @@ public:
 	  */
 	 void mark_as_due_for_processing() {
 		 m_processing_status = processingStatus::DO_PROCESS;
+		 m_cancellation_flag_ptr->store(false);
 	 }
 
 	 /***************************************************************************/
@@ -860,6 +1001,8 @@ public:
 		 m_stored_error_descriptions = p_load->m_stored_error_descriptions;
 		 m_processing_status = p_load->m_processing_status;
 		 m_evaluation_id = p_load->m_evaluation_id;
+		 m_cancellation_bound = p_load->m_cancellation_bound;
+		 m_intermediate_bound = p_load->m_intermediate_bound;
 
 		 Gem::Common::copyCloneableSmartPointer(p_load->m_pre_processor_ptr, m_pre_processor_ptr);
 		 Gem::Common::copyCloneableSmartPointer(p_load->m_post_processor_ptr, m_post_processor_ptr);
@@ -1033,6 +1176,10 @@ private:
 	 processingStatus m_processing_status = processingStatus::DO_IGNORE; ///< By default no processing is initiated
 
 	 std::string m_evaluation_id = "empty"; ///< A unique id that is assigned to an evaluation
+	 double m_cancellation_bound = std::numeric_limits<double>::max(); ///< Processing may be stopped once the intermediate bound exceeds this value
+	 double m_intermediate_bound = std::numeric_limits<double>::lowest(); ///< The tightest bound of the final result reported so far during processing
+
+	 std::shared_ptr<std::atomic<bool>> m_cancellation_flag_ptr = std::make_shared<std::atomic<bool>>(false); ///< Set when cancellation was requested; not copied
 };
 
 /******************************************************************************/
@@ -46,6 +46,9 @@
 #include <iostream>
 #include <string>
 #include <chrono>
+#include <map>
+#include <memory>
+#include <cstring>
 
 // Boost header files go here
 #include <boost/lexical_cast.hpp>
@@ -58,6 +61,7 @@
 // Geneva header files go here
 #include "common/GCommonEnums.hpp"
 #include "common/GCommonHelperFunctions.hpp"
+#include "common/GExternalProcess.hpp"
 #include "common/GFactoryT.hpp"
 #include "common/GParserBuilder.hpp"
 #include "hap/GRandomT.hpp"
@@ -113,6 +117,7 @@ const std::string GEEI_DEF_STARTMODE = "random";
 const std::string GEEI_DEF_DATATYPE = "setup_data";
 const std::string GEEI_DEF_RUNID = "empty";
 const bool GEEI_DEF_REMOVETEMPORARIES = "true";
+const bool GEEI_DEF_USEPERSISTENTEVALUATOR = false;
 
 /******************************************************************************/
 // Forward declaration so we can expose the factory type to the public
@@ -137,6 +142,24 @@ class GExternalEvaluatorIndividualFactory;
  *
  * The xml parameter files are created using boost::property_tree and its write_xml
  * utility. Hence the external program needs to understand the XML format.
+ *
+ * Starting a program and parsing XML for every evaluation may be more expensive than
+ * the evaluation itself. Programs may thus additionally support a persistent mode,
+ * selected through setUsePersistentEvaluator(). Each evaluating thread then starts
+ * the program once, with the --serve switch, and exchanges messages with it over its
+ * standard input and output, as described for Gem::Common::GExternalProcess. A program
+ * that crashes is restarted for the next evaluation. All numbers are little-endian;
+ * strings are preceded by their length as a uint32. A request holds
+ *
+ * uint32 iteration, string evaluation id,
+ * uint32 nDoubles, nDoubles x float64, uint32 nInt32s, nInt32s x int32, uint32 nBools, nBools x uint8
+ *
+ * where parameters of each type appear in the order of the variables of the setup file.
+ * The response to a request holds
+ *
+ * uint8 isValid, string evaluation id (as received), uint32 nResults, nResults x float64
+ *
+ * The program should exit when its standard input is closed.
  */
 class GExternalEvaluatorIndividual : public GParameterSet {
 	 ///////////////////////////////////////////////////////////////////////
@@ -153,7 +176,8 @@ class GExternalEvaluatorIndividual : public GParameterSet {
 		 & BOOST_SERIALIZATION_NVP(m_custom_options)
 		 & BOOST_SERIALIZATION_NVP(m_parameter_file_base_name)
 		 & BOOST_SERIALIZATION_NVP(m_n_results)
-		 & BOOST_SERIALIZATION_NVP(m_remove_exec_temporaries);
+		 & BOOST_SERIALIZATION_NVP(m_remove_exec_temporaries)
+		 & BOOST_SERIALIZATION_NVP(m_use_persistent_evaluator);
 	 }
 
 	 ///////////////////////////////////////////////////////////////////////
@@ -205,6 +229,11 @@ public:
 	 /** @brief Allows to check whether temporaries should be removed */
 	 G_API_INDIVIDUALS bool getRemoveExecTemporaries() const;
 
+	 /** @brief Allows to specify whether evaluations should be sent to a persistent external process */
+	 G_API_INDIVIDUALS void setUsePersistentEvaluator(bool);
+	 /** @brief Allows to check whether evaluations are sent to a persistent external process */
+	 G_API_INDIVIDUALS bool getUsePersistentEvaluator() const;
+
 protected:
 	 /***************************************************************************/
 	 /** @brief Loads the data of another GExternalEvaluatorIndividual */
@@ -233,6 +262,13 @@ private:
 	 /** @brief Creates a deep clone of this object */
 	 virtual G_API_INDIVIDUALS GObject *clone_() const final;
 
+	 /** @brief Evaluates this object by exchanging files with a newly started external program */
+	 double fileExchangeFitnessCalculation();
+	 /** @brief Evaluates this object by exchanging messages with a persistent external program */
+	 double persistentFitnessCalculation();
+	 /** @brief Assigns the worst case to all results and marks this object as invalid */
+	 double markAsFailed(std::string const&);
+
 	 /***************************************************************************/
 
 	 std::string m_program_name; ///< The name of the external program to be executed
@@ -241,6 +277,7 @@ private:
 	 std::size_t m_n_results; ///< The number of results to be expected from the evaluation function
 	 std::string runID_; ///< Identifies this run with a unique id
 	 bool m_remove_exec_temporaries; ///< Indicates whether temporary files should be removed
+	 bool m_use_persistent_evaluator; ///< Indicates whether evaluations are sent to a persistent external process
 };
 
 /******************************************************************************/
@@ -283,6 +320,7 @@ class GExternalEvaluatorIndividualFactory
 		 & BOOST_SERIALIZATION_NVP(m_parameterFileBaseName)
 		 & BOOST_SERIALIZATION_NVP(m_initValues)
 		 & BOOST_SERIALIZATION_NVP(m_removeExecTemporaries)
+		 & BOOST_SERIALIZATION_NVP(m_usePersistentEvaluator)
 		 & BOOST_SERIALIZATION_NVP(m_externalEvaluatorQueried)
 		 & BOOST_SERIALIZATION_NVP(m_ptr);
 	 }
@@ -408,6 +446,11 @@ public:
 	 /** @brief Allows to check whether temporaries should be removed */
 	 G_API_INDIVIDUALS bool getRemoveExecTemporaries() const;
 
+	 /** @brief Allows to specify whether evaluations should be sent to a persistent external process */
+	 G_API_INDIVIDUALS void setUsePersistentEvaluator(bool);
+	 /** @brief Allows to check whether evaluations are sent to a persistent external process */
+	 G_API_INDIVIDUALS bool getUsePersistentEvaluator() const;
+
 	 // End of public getters and setters
 	 /**************************************************************************/
 
@@ -483,6 +526,7 @@ private:
 	 Gem::Common::GOneTimeRefParameterT<std::string> m_initValues;
 
 	 Gem::Common::GOneTimeRefParameterT<bool> m_removeExecTemporaries;
+	 Gem::Common::GOneTimeRefParameterT<bool> m_usePersistentEvaluator;
 
 	 bool m_externalEvaluatorQueried; ///< Specifies whether the external evaluator program has already been queried for setup information
 	 pt::ptree m_ptr; ///< Holds setup information for individuals, as provided by the external evaluator program
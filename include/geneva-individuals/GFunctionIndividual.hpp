@@ -391,6 +391,10 @@ protected:
 
 	 /** @brief The actual value calculation takes place here */
 	 G_API_INDIVIDUALS double fitnessCalculation() final;
+	 /** @brief Updates the parent's fitness for the separable demo functions */
+	 G_API_INDIVIDUALS bool incrementalFitnessCalculation(parameterset_delta const&, double&) final;
+	 /** @brief Evaluates an entire population of parameter sets in one go */
+	 G_API_INDIVIDUALS bool batchFitnessCalculation(std::vector<double> const&, std::size_t, std::vector<double>&) const final;
 
 	 //---------------------------------------------------------------------------
 
@@ -406,6 +410,9 @@ private:
 	 /** @brief Creates a deep clone of this object */
 	 G_API_INDIVIDUALS GObject *clone_() const final;
 
+	 /** @brief Calculates the value of a demo function for a given set of parameters */
+	 static G_API_INDIVIDUALS double functionValue(solverFunction, double const *, std::size_t);
+
 	 //---------------------------------------------------------------------------
 	 // Data
 
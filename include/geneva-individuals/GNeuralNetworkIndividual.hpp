@@ -42,6 +42,7 @@
 // Standard header files go here
 #include <iostream>
 #include <cmath>
+#include <cstring>
 #include <sstream>
 #include <vector>
 #include <fstream>
@@ -66,6 +67,8 @@
 #include <boost/serialization/version.hpp>
 #include <boost/optional.hpp>
 #include <boost/filesystem.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
 
 // Geneva header files go here
 #include "common/GCommonEnums.hpp"
@@ -252,6 +255,14 @@ public:
 	 G_API_INDIVIDUALS void saveToDisk(const std::string &) const;
 	 /** @brief Loads training data from the disc */
 	 G_API_INDIVIDUALS void loadFromDisk(const std::string &);
+	 /** @brief Saves the data of this struct to disc in a flat binary format */
+	 G_API_INDIVIDUALS void saveToBinaryFile(const std::string &) const;
+	 /** @brief Loads training data from a memory-mapped binary file */
+	 G_API_INDIVIDUALS void loadFromBinaryFile(const std::string &);
+	 /** @brief Checks whether a file holds training data in the flat binary format */
+	 static G_API_INDIVIDUALS bool isBinaryFile(const std::string &);
+	 /** @brief Converts a training data file to the flat binary format */
+	 static G_API_INDIVIDUALS void convertToBinaryFile(const std::string &, const std::string &);
 
 	 /** @brief Adds a new training set to the collection, Requires for the network architecture to be defined already */
 	 G_API_INDIVIDUALS void addTrainingSet(std::shared_ptr <trainingSet>, const std::size_t &);
@@ -336,6 +347,10 @@ using GDatStore = Gem::Common::GSingletonT<Gem::Geneva::networkData>;
 
 /******************************************************************************/
 ////////////////////////////////////////////////////////////////////////////////
+/******************************************************************************/
+/** @brief Identifies training data files in the flat binary format */
+const std::string GNN_BINARY_MAGIC = "GNNBIN01";
+
 /******************************************************************************/
 // A number of default settings for the factory
 const std::string GNN_DEF_DATAFILE = "./Datasets/hyper_cube.dat";
@@ -978,6 +993,9 @@ protected:
 	 /** @brief The actual fitness calculation */
 	 virtual G_API_INDIVIDUALS double fitnessCalculation() final;
 
+	 /** @brief Performs self tests that are expected to succeed. This is needed for testing purposes */
+	 G_API_INDIVIDUALS void specificTestsNoFailureExpected_GUnitTests_() override;
+
 private:
 	 /***************************************************************************/
 	 /** @brief Creates a deep clone of this object */
@@ -986,6 +1004,11 @@ private:
 	 /** @brief The transfer function */
 	 double transfer(const double &value) const;
 
+#ifdef GEM_TESTING
+	 /** @brief The fitness calculation accessing every weight through its parameter object */
+	 double perWeightFitnessCalculation();
+#endif /* GEM_TESTING */
+
 	 /***************************************************************************/
 	 // Local variables
 	 transferFunction tF_; ///< The transfer function to be used for the training
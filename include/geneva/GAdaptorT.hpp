@@ -48,6 +48,7 @@
 
 #include "common/GSerializationHelperFunctionsT.hpp"
 #include "hap/GRandomT.hpp"
+#include "hap/GRandomDistributionsT.hpp"
 #include "geneva/GObject.hpp"
 #include "geneva/GOptimizationEnums.hpp"
 
@@ -637,12 +638,23 @@ public:
 		 }
 
 		 if (adaptionMode::WITHPROBABILITY == m_adaptionMode) { // The most likely case
-			 for (auto &val: valVec) {
-				 // A likelihood of m_adProb for adaption
-				 if (m_weighted_bool(gr, std::bernoulli_distribution::param_type(gfabs(m_adProb)))) {
+			 // Decide for all positions in one go. A likelihood of m_adProb for adaption
+			 std::vector<fp_type> decisions(valVec.size());
+			 Gem::Hap::fill_uniform_real<fp_type>(gr, decisions);
+
+			 const fp_type adProb = gfabs(m_adProb);
+			 std::size_t nSelected = std::size_t(std::count_if(
+				 decisions.begin()
+				 , decisions.end()
+				 , [adProb](fp_type u) -> bool { return u < adProb; }
+			 ));
+
+			 prepareBulkAdaptions(nSelected, gr);
+			 for (std::size_t pos = 0; pos < valVec.size(); pos++) {
+				 if (decisions[pos] < adProb) {
 					 adaptAdaption(range, gr);
 					 customAdaptions(
-						 val
+						 valVec[pos]
 						 , range
 						 , gr
 					 );
@@ -650,7 +662,9 @@ public:
 					 nAdapted += 1;
 				 }
 			 }
+			 finalizeBulkAdaptions();
 		 } else if (adaptionMode::ALWAYS == m_adaptionMode) { // always adapt
+			 prepareBulkAdaptions(valVec.size(), gr);
 			 for (auto &val: valVec) {
 				 adaptAdaption(range, gr);
 				 customAdaptions(
@@ -661,6 +675,7 @@ public:
 
 				 nAdapted += 1;
 			 }
+			 finalizeBulkAdaptions();
 		 }
 
 		 // No need to test for "m_adaptionMode == adaptionMode::NEVER" as no action is needed in this case
@@ -896,6 +911,26 @@ protected:
 		 , Gem::Hap::GRandomBase& gr
 	 ) BASE { /* nothing */}
 
+	 /***************************************************************************/
+	 /**
+	  * This function is re-implemented by derived classes that may produce the
+	  * random numbers for the adaption of an entire vector in one go. It is
+	  * called before customAdaptions() is applied to nAdaptions positions.
+	  *
+	  * @param nAdaptions The number of calls to customAdaptions() that will follow
+	  */
+	 virtual void prepareBulkAdaptions(
+		 std::size_t
+		 , Gem::Hap::GRandomBase& gr
+	 ) BASE { /* nothing */ }
+
+	 /***************************************************************************/
+	 /**
+	  * Gives derived classes the opportunity to release data created in
+	  * prepareBulkAdaptions()
+	  */
+	 virtual void finalizeBulkAdaptions() BASE { /* nothing */ }
+
 	 /***************************************************************************/
 
 	 /** @brief Adaption of values as specified by the user */
@@ -41,6 +41,7 @@
 
 // Standard headers go here
 #include <type_traits>
+#include <vector>
 
 // Boost headers go here
 
@@ -251,15 +252,45 @@ protected:
         using namespace Gem::Common;
         using namespace Gem::Hap;
 
-        // adapt the value in situ. Note that this changes
-        // the argument of this function
-        value += (
-            range * GAdaptorT<fp_type, fp_type>::m_normal_distribution(
+        // Use a gaussian random number produced in bulk, if available
+        fp_type z = m_standardNormalsPos < m_standardNormals.size()
+            ? m_standardNormals[m_standardNormalsPos++]
+            : GAdaptorT<fp_type, fp_type>::m_normal_distribution(
                 gr
                 , typename std::normal_distribution<fp_type>::param_type(
                     0.
-                    , GNumGaussAdaptorT<fp_type, fp_type>::sigma_
-                )));
+                    , 1.
+                ));
+
+        // adapt the value in situ. Note that this changes
+        // the argument of this function
+        value += range * GNumGaussAdaptorT<fp_type, fp_type>::sigma_ * z;
+    }
+
+    /***************************************************************************/
+    /**
+     * Produces the gaussian random numbers needed for the adaption of an entire
+     * vector in one go. The numbers follow a standard normal distribution, so
+     * that sigma may still change between positions through adaptAdaption().
+     *
+     * @param nAdaptions The number of calls to customAdaptions() that will follow
+     */
+    void prepareBulkAdaptions(
+        std::size_t nAdaptions
+        , Gem::Hap::GRandomBase &gr
+    ) override {
+        m_standardNormals.resize(nAdaptions);
+        Gem::Hap::fill_normal<fp_type>(gr, m_standardNormals);
+        m_standardNormalsPos = 0;
+    }
+
+    /***************************************************************************/
+    /**
+     * Discards remaining bulk random numbers
+     */
+    void finalizeBulkAdaptions() override {
+        m_standardNormals.clear();
+        m_standardNormalsPos = 0;
     }
 
     /* ----------------------------------------------------------------------------------
@@ -340,6 +371,11 @@ private:
     /***************************************************************************/
     /** @brief Creates a deep clone of this object. */
     GObject *clone_() const override = 0;
+
+    /***************************************************************************/
+
+    std::vector<fp_type> m_standardNormals; ///< Standard normal random numbers produced in bulk for the adaption of a vector; not serialized
+    std::size_t m_standardNormalsPos = 0; ///< The position of the next unused entry in m_standardNormals
 };
 
 /******************************************************************************/
@@ -70,6 +70,13 @@ enum class maxMode : Gem::Common::ENUMBASETYPE {
 const bool GPS_DEF_USE_RANDOMCRASH = false;
 const double GPS_DEF_RANDOMCRASHPROB = 0.001;
 
+/******************************************************************************/
+/** @brief Incremental (delta) evaluation of adapted individuals is opt-in */
+const bool GPS_DEF_USE_INCREMENTALEVALUATION = false;
+
+/** @brief Batch evaluation of entire populations is opt-in */
+const bool GPS_DEF_USE_BATCHEVALUATION = false;
+
 /******************************************************************************/
 /**
  * Default population sizes -- 100 by default (parents + children)
@@ -92,6 +99,15 @@ const std::size_t DEFNMONITORINDS = 1;
  */
 const std::uint32_t DEFREPULSIONTHRESHOLD = 0;
 
+/******************************************************************************/
+/**
+ * Whether swarm algorithms should by default update positions asynchronously,
+ * i.e. move particles using the bests found by previously returned batches of
+ * the same iteration, and the default size of these batches
+ */
+const bool DEFAULTSWARMASYNCUPDATES = false;
+const std::size_t DEFAULTSWARMASYNCBATCHSIZE = 1;
+
 /******************************************************************************/
 /**
  * The maximum number an adaption of an individual should be performed until a
@@ -303,6 +319,8 @@ const std::string DEFAULTCPDIR = "./checkpoints/";
  * The default serialization mode used for check-pointing
  */
 const Gem::Common::serializationMode DEFAULTCPSERMODE = Gem::Common::serializationMode::BINARY;
+const bool DEFAULTCPASYNC = false; ///< Whether checkpoint files are written by a background thread
+const std::uint32_t DEFAULTCPFULLINTERVAL = 0; ///< Every checkpoint is complete by default
 
 
 /******************************************************************************/
@@ -504,6 +522,9 @@ enum class sortingModeMP : Gem::Common::ENUMBASETYPE {
  */
 const double SA_T0 = 1000.; ///< The default start temperature in simulated annealing
 const double SA_ALPHA = 0.95; ///< The degradation strength in simulated annealing
+const bool SA_PARALLELTEMPERING = false; ///< Whether parents act as replicas at different temperatures by default
+const double SA_PTTEMPERATURERATIO = 2.; ///< The default ratio between the temperatures of neighboring replicas
+const std::uint32_t SA_PTSWAPINTERVAL = 1; ///< The default number of iterations between replica swap attempts
 
 /******************************************************************************/
 /**
@@ -565,6 +586,54 @@ enum class updateRule : Gem::Common::ENUMBASETYPE {
 
 const updateRule DEFAULTUPDATERULE = updateRule::SWARM_UPDATERULE_CLASSIC; ///< The default update rule in swarms
 
+/******************************************************************************/
+/**
+ * Specifies how gradient descents estimate the gradient. Forward differences need one
+ * evaluation per parameter, central differences two. SPSA (simultaneous perturbation
+ * stochastic approximation) needs two evaluations, independent of the number of parameters.
+ */
+enum class gradientEstimator : Gem::Common::ENUMBASETYPE {
+	GD_FORWARDDIFFERENCE = 0
+	, GD_CENTRALDIFFERENCE = 1
+	, GD_SPSA = 2
+	, GRADIENTESTIMATOR_LAST = static_cast<Gem::Common::ENUMBASETYPE>(GD_SPSA)
+};
+
+/******************************************************************************/
+
+const gradientEstimator DEFAULTGRADIENTESTIMATOR = gradientEstimator::GD_FORWARDDIFFERENCE; ///< The default gradient estimator in gradient descents
+
+/******************************************************************************/
+/**
+ * Specifies how random parameter scans pick their samples: either independently
+ * from a uniform distribution, or from a low-discrepancy (quasi-random) sequence,
+ * which covers the parameter space more evenly with the same number of samples.
+ */
+enum class scanSequence : Gem::Common::ENUMBASETYPE {
+	SCAN_UNIFORMRANDOM = 0
+	, SCAN_HALTON = 1
+	, SCAN_SOBOL = 2
+	, SCANSEQUENCE_LAST = static_cast<Gem::Common::ENUMBASETYPE>(SCAN_SOBOL)
+};
+
+/******************************************************************************/
+
+const scanSequence DEFAULTSCANSEQUENCE = scanSequence::SCAN_UNIFORMRANDOM; ///< The default sampling method of random parameter scans
+const bool DEFAULTSCRAMBLESCANSEQUENCE = false; ///< Whether quasi-random scan sequences are scrambled by default
+
+/******************************************************************************/
+/**
+ * Specifies how individuals migrate between concurrently running islands:
+ * to the next island only (ring), to all other islands (fully connected),
+ * or to one randomly chosen island.
+ */
+enum class migrationTopology : Gem::Common::ENUMBASETYPE {
+	MIGRATION_RING = 0
+	, MIGRATION_FULL = 1
+	, MIGRATION_RANDOM = 2
+	, MIGRATIONTOPOLOGY_LAST = static_cast<Gem::Common::ENUMBASETYPE>(MIGRATION_RANDOM)
+};
+
 /******************************************************************************/
 
 /** @brief Puts a Gem::Geneva::maxMode into a stream. Needed also for boost::lexical_cast<> */
@@ -633,6 +702,24 @@ G_API_GENEVA std::ostream& operator<<(std::ostream&, const Gem::Geneva::updateRu
 /** @brief Reads a Gem::Geneva::updateRule from a stream. Needed also for boost::lexical_cast<> */
 G_API_GENEVA std::istream& operator>>(std::istream&, Gem::Geneva::updateRule&);
 
+/** @brief Puts a Gem::Geneva::gradientEstimator into a stream. Needed also for boost::lexical_cast<> */
+G_API_GENEVA std::ostream& operator<<(std::ostream&, const Gem::Geneva::gradientEstimator&);
+
+/** @brief Reads a Gem::Geneva::gradientEstimator from a stream. Needed also for boost::lexical_cast<> */
+G_API_GENEVA std::istream& operator>>(std::istream&, Gem::Geneva::gradientEstimator&);
+
+/** @brief Puts a Gem::Geneva::scanSequence into a stream. Needed also for boost::lexical_cast<> */
+G_API_GENEVA std::ostream& operator<<(std::ostream&, const Gem::Geneva::scanSequence&);
+
+/** @brief Reads a Gem::Geneva::scanSequence from a stream. Needed also for boost::lexical_cast<> */
+G_API_GENEVA std::istream& operator>>(std::istream&, Gem::Geneva::scanSequence&);
+
+/** @brief Puts a Gem::Geneva::migrationTopology into a stream. Needed also for boost::lexical_cast<> */
+G_API_GENEVA std::ostream& operator<<(std::ostream&, const Gem::Geneva::migrationTopology&);
+
+/** @brief Reads a Gem::Geneva::migrationTopology from a stream. Needed also for boost::lexical_cast<> */
+G_API_GENEVA std::istream& operator>>(std::istream&, Gem::Geneva::migrationTopology&);
+
 /** @brief Puts a Gem::Geneva::adaptionMode into a stream. Needed also for boost::lexical_cast<> */
 G_API_GENEVA std::ostream& operator<<(std::ostream&, const Gem::Geneva::adaptionMode&);
 
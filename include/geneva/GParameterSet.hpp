@@ -177,6 +177,21 @@ private:
     bool m_transformed_fitness_set = false; ///< Indicates whether a suitable m_transformed_fitness value is available
 };
 
+/******************************************************************************/
+////////////////////////////////////////////////////////////////////////////////
+/******************************************************************************/
+/**
+ * Describes the difference between an individual and the parent it was adapted
+ * from, as handed to GParameterSet::incrementalFitnessCalculation(). All
+ * positions refer to the vector obtained through streamline<double>().
+ */
+struct parameterset_delta {
+    std::vector<std::size_t> changed_positions; ///< The positions of all double parameters that differ from the parent
+    std::vector<double> parent_values; ///< All double parameter values of the parent
+    std::vector<double> current_values; ///< All double parameter values of this individual
+    std::vector<double> parent_raw_fitness; ///< The raw fitness values of the parent
+};
+
 /******************************************************************************/
 ////////////////////////////////////////////////////////////////////////////////
 /******************************************************************************/
@@ -221,7 +236,14 @@ class GParameterSet
         & BOOST_SERIALIZATION_NVP(m_max_retries_until_valid)
         & BOOST_SERIALIZATION_NVP(m_n_adaptions)
         & BOOST_SERIALIZATION_NVP(m_useRandomCrash)
-        & BOOST_SERIALIZATION_NVP(m_randomCrashProb);
+        & BOOST_SERIALIZATION_NVP(m_randomCrashProb)
+        & BOOST_SERIALIZATION_NVP(m_use_incremental_evaluation)
+        & BOOST_SERIALIZATION_NVP(m_delta_reference_valid)
+        & BOOST_SERIALIZATION_NVP(m_delta_reference_values)
+        & BOOST_SERIALIZATION_NVP(m_delta_reference_raw_fitness)
+        & BOOST_SERIALIZATION_NVP(m_use_batch_evaluation)
+        & BOOST_SERIALIZATION_NVP(m_precomputed_raw_fitness_valid)
+        & BOOST_SERIALIZATION_NVP(m_precomputed_raw_fitness);
     }
     ///////////////////////////////////////////////////////////////////////
 
@@ -343,6 +365,24 @@ public:
     /** @brief Allows to check whether random crashes are activated, and with which probability the occur */
     G_API_GENEVA std::tuple<bool, double> getRandomCrash() const;
 
+    /** @brief Allows to enable or disable incremental (delta) evaluation after adaptions */
+    G_API_GENEVA void setUseIncrementalEvaluation(bool);
+    /** @brief Checks whether incremental (delta) evaluation is enabled */
+    G_API_GENEVA bool getUseIncrementalEvaluation() const;
+    /** @brief Checks whether a parent evaluation is available for incremental evaluation */
+    G_API_GENEVA bool hasDeltaReference() const;
+    /** @brief Retrieves the positions of all double parameters that changed relative to the parent */
+    G_API_GENEVA std::vector<std::size_t> getChangedParameterPositions() const;
+
+    /** @brief Allows to enable or disable batch evaluation of entire populations */
+    G_API_GENEVA void setUseBatchEvaluation(bool);
+    /** @brief Checks whether batch evaluation is enabled */
+    G_API_GENEVA bool getUseBatchEvaluation() const;
+    /** @brief Checks whether a fitness value was precomputed by a batch evaluation */
+    G_API_GENEVA bool hasPrecomputedFitness() const;
+    /** @brief Evaluates all items due for processing in one go, if they support it */
+    static G_API_GENEVA bool batchEvaluation(std::vector<std::shared_ptr<GParameterSet>>&);
+
     /***************************************************************************/
     /**
      * Retrieves a parameter of a given type at the specified position.
@@ -908,10 +948,10 @@ public:
 protected:
     /***************************************************************************/
     /**
-     * A random number generator. Note that the actual calculation is
-     * done in a random number proxy / factory
+     * A random number generator. Note that by default the actual calculation
+     * is done in a random number proxy / factory
      */
-    Gem::Hap::GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMPROXY> m_gr;
+    Gem::Hap::GRandomT<Gem::Hap::DEFAULTRANDFLAVOUR> m_gr;
 
     /***************************************************************************/
     /** @brief Do the required processing for this object */
@@ -946,8 +986,14 @@ protected:
 
     /** @brief The fitness calculation for the main quality criterion takes place here */
     G_API_GENEVA double fitnessCalculation() override = 0;
+    /** @brief Updates the parent's fitness from a parameter delta; falls back to fitnessCalculation() if false is returned */
+    virtual G_API_GENEVA bool incrementalFitnessCalculation(parameterset_delta const&, double&) BASE;
+    /** @brief Evaluates a matrix of parameter sets in one go; falls back to process() per item if false is returned */
+    virtual G_API_GENEVA bool batchFitnessCalculation(std::vector<double> const&, std::size_t, std::vector<double>&) const BASE;
     /** @brief Sets the fitness to a given set of values and clears the dirty flag */
     G_API_GENEVA void setFitness_(std::vector<double> const &);
+    /** @brief Reports a raw fitness the final result cannot improve upon; returns true if the evaluation should stop */
+    G_API_GENEVA bool reportIntermediateFitness(double);
 
     /** @brief Combines secondary evaluation results by adding the individual results */
     G_API_GENEVA double sumCombiner() const;
@@ -1004,6 +1050,13 @@ private:
     /** @brief Retrieval of a suitable position for cross over inside of a vector */
     std::size_t getCrossOverPos(std::size_t, std::size_t);
 
+    /** @brief Stores the current parameters and fitness as the reference for incremental evaluation */
+    void storeDeltaReference();
+    /** @brief Removes any stored reference for incremental evaluation */
+    void clearDeltaReference();
+    /** @brief Assembles the difference to the stored reference, if it is usable */
+    bool buildDelta(parameterset_delta&) const;
+
     /***************************************************************************/
     // Data
 
@@ -1047,6 +1100,17 @@ private:
     bool m_useRandomCrash
         = false; ///< Indicates whether the individual should crash at random intervals for debugging purposes
     double m_randomCrashProb = 0.; ///< The probability for a random crash
+
+    bool m_use_incremental_evaluation
+        = GPS_DEF_USE_INCREMENTALEVALUATION; ///< Indicates whether adapt() should record a reference for incremental evaluation
+    bool m_delta_reference_valid = false; ///< Indicates whether the reference values below may be used
+    std::vector<double> m_delta_reference_values; ///< The double parameters of the parent this individual was adapted from
+    std::vector<double> m_delta_reference_raw_fitness; ///< The raw fitness values of the parent this individual was adapted from
+
+    bool m_use_batch_evaluation
+        = GPS_DEF_USE_BATCHEVALUATION; ///< Indicates whether populations of this individual may be evaluated in a single batch
+    bool m_precomputed_raw_fitness_valid = false; ///< Indicates whether m_precomputed_raw_fitness holds a usable value
+    double m_precomputed_raw_fitness = 0.; ///< The main raw fitness as calculated by a batch evaluation
 };
 
 } /* namespace Geneva */
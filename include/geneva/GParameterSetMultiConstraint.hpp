@@ -139,7 +139,7 @@ public:
     /** @brief The default constructor */
     explicit G_API_GENEVA GParameterSetFormulaConstraint(std::string);
     /** @brief The copy constructor */
-    G_API_GENEVA GParameterSetFormulaConstraint(const GParameterSetFormulaConstraint &) = default;
+    G_API_GENEVA GParameterSetFormulaConstraint(const GParameterSetFormulaConstraint &);
     /** @brief The destructor */
     G_API_GENEVA ~GParameterSetFormulaConstraint() override = default;
 
@@ -174,6 +174,8 @@ private:
     G_API_GENEVA GParameterSetFormulaConstraint() = default;
 
     std::string rawFormula_; ///< Holds the raw formula, in which values haven't been replaced yet
+
+    mutable std::shared_ptr<Gem::Common::GFormulaParserT<double>> parser_ptr_; ///< Holds the formula compiled upon the first check; not copied or serialized
 };
 
 /******************************************************************************/
@@ -44,6 +44,11 @@
 #include <fstream>
 #include <type_traits>
 #include <chrono>
+#include <vector>
+#include <map>
+#include <memory>
+#include <limits>
+#include <cstdint>
 
 // Boost header files go here
 #include <boost/filesystem.hpp>
@@ -54,6 +59,7 @@
 // Geneva headers go here
 #include "courtier/GExecutorT.hpp"
 #include "common/GCommonEnums.hpp"
+#include "common/GAsyncFileWriter.hpp"
 #include "common/GPlotDesigner.hpp"
 #include "common/GLogger.hpp"
 #include "common/GCommonHelperFunctions.hpp"
@@ -371,7 +377,9 @@ class GProgressPlotterT
 		 & BOOST_SERIALIZATION_NVP(m_monitorBestOnly)
 		 & BOOST_SERIALIZATION_NVP(m_monitorValidOnly)
 		 & BOOST_SERIALIZATION_NVP(m_observeBoundaries)
-		 & BOOST_SERIALIZATION_NVP(m_addPrintCommand);
+		 & BOOST_SERIALIZATION_NVP(m_addPrintCommand)
+		 & BOOST_SERIALIZATION_NVP(m_dataReductionMode)
+		 & BOOST_SERIALIZATION_NVP(m_maxNDataPoints);
 	 }
 	 ///////////////////////////////////////////////////////////////////////
 
@@ -417,6 +425,8 @@ public:
 			, m_monitorValidOnly(cp.m_monitorValidOnly)
 			, m_observeBoundaries(cp.m_observeBoundaries)
 			, m_addPrintCommand(cp.m_addPrintCommand)
+			, m_dataReductionMode(cp.m_dataReductionMode)
+			, m_maxNDataPoints(cp.m_maxNDataPoints)
 	 {
 		 Gem::Common::copyCloneableSmartPointer(cp.m_progressPlotter2D_oa, m_progressPlotter2D_oa);
 		 Gem::Common::copyCloneableSmartPointer(cp.m_progressPlotter3D_oa, m_progressPlotter3D_oa);
@@ -518,6 +528,46 @@ public:
 		 return m_observeBoundaries;
 	 }
 
+	 /***************************************************************************/
+	 /**
+	  * Limits the number of points kept in the progress plots, so that memory
+	  * consumption does not grow with the number of iterations. RESERVOIR keeps
+	  * a uniform random sample of all points, DECIMATION every n-th point.
+	  * Takes effect with the next optimization run.
+	  */
+	 void setDataReduction(
+		 Gem::Common::dataReductionMode dataReductionMode
+		 , std::size_t maxNDataPoints = Gem::Common::DEFMAXNDATAPOINTS
+	 ) {
+		 if(Gem::Common::dataReductionMode::NONE != dataReductionMode && maxNDataPoints < 2) {
+			 throw gemfony_exception(
+				 g_error_streamer(DO_LOG, time_and_place)
+					 << "In GProgressPlotterT<fp_type>::setDataReduction(): Error!" << std::endl
+					 << "At least two data points must be retained, got " << maxNDataPoints << std::endl
+			 );
+		 }
+
+		 m_dataReductionMode = dataReductionMode;
+		 m_maxNDataPoints = maxNDataPoints;
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Retrieves the data reduction mode of the progress plots
+	  */
+	 Gem::Common::dataReductionMode getDataReductionMode() const {
+		 return m_dataReductionMode;
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Retrieves the maximum number of points kept in the progress plots
+	  * when data reduction is active
+	  */
+	 std::size_t getMaxNDataPoints() const {
+		 return m_maxNDataPoints;
+	 }
+
 	 /***************************************************************************/
 	 /**
 	  * Allows to check whether parameters should be profiled
@@ -681,6 +731,8 @@ protected:
 		 m_monitorValidOnly = p_load->m_monitorValidOnly;
 		 m_observeBoundaries = p_load->m_observeBoundaries;
 		 m_addPrintCommand = p_load->m_addPrintCommand;
+		 m_dataReductionMode = p_load->m_dataReductionMode;
+		 m_maxNDataPoints = p_load->m_maxNDataPoints;
 	 }
 
 	/***************************************************************************/
@@ -727,6 +779,8 @@ protected:
 		compare_t(IDENTITY(m_monitorValidOnly, p_load->m_monitorValidOnly), token);
 		compare_t(IDENTITY(m_observeBoundaries, p_load->m_observeBoundaries), token);
 		compare_t(IDENTITY(m_addPrintCommand, p_load->m_addPrintCommand), token);
+		compare_t(IDENTITY(m_dataReductionMode, p_load->m_dataReductionMode), token);
+		compare_t(IDENTITY(m_maxNDataPoints, p_load->m_maxNDataPoints), token);
 
 		// React on deviations from the expectation
 		token.evaluate();
@@ -829,6 +883,7 @@ private:
 						m_progressPlotter2D_oa = std::make_shared<Gem::Common::GGraph2D>();
 
 						m_progressPlotter2D_oa->setPlotMode(Gem::Common::graphPlotMode::CURVE);
+						m_progressPlotter2D_oa->setDataReduction(m_dataReductionMode, m_maxNDataPoints);
 						m_progressPlotter2D_oa->setPlotLabel("Fitness as a function of a parameter value");
 						m_progressPlotter2D_oa->setXAxisLabel(this->getLabel(m_fp_profVarVec[0]));
 						m_progressPlotter2D_oa->setYAxisLabel("Fitness");
@@ -840,6 +895,7 @@ private:
 					{
 						m_progressPlotter3D_oa = std::make_shared<Gem::Common::GGraph3D>();
 
+						m_progressPlotter3D_oa->setDataReduction(m_dataReductionMode, m_maxNDataPoints);
 						m_progressPlotter3D_oa->setPlotLabel("Fitness as a function of parameter values");
 						m_progressPlotter3D_oa->setXAxisLabel(this->getLabel(m_fp_profVarVec[0]));
 						m_progressPlotter3D_oa->setYAxisLabel(this->getLabel(m_fp_profVarVec[1]));
@@ -853,6 +909,7 @@ private:
 					{
 						m_progressPlotter4D_oa = std::make_shared<Gem::Common::GGraph4D>();
 
+						m_progressPlotter4D_oa->setDataReduction(m_dataReductionMode, m_maxNDataPoints);
 						m_progressPlotter4D_oa->setPlotLabel("Fitness (color-coded) as a function of parameter values");
 						m_progressPlotter4D_oa->setXAxisLabel(this->getLabel(m_fp_profVarVec[0]));
 						m_progressPlotter4D_oa->setYAxisLabel(this->getLabel(m_fp_profVarVec[1]));
@@ -1065,6 +1122,44 @@ private:
 	 bool m_observeBoundaries = false; ///< When set to true, the plotter will ignore values outside of a scan boundary
 
 	 bool m_addPrintCommand = false; ///< Asks the GPlotDesigner to add a print command to result files
+
+	 Gem::Common::dataReductionMode m_dataReductionMode = Gem::Common::DEFDATAREDUCTIONMODE; ///< How the number of points in the progress plots is limited
+	 std::size_t m_maxNDataPoints = Gem::Common::DEFMAXNDATAPOINTS; ///< The maximum number of points in the progress plots when data reduction is active
+};
+
+/******************************************************************************/
+////////////////////////////////////////////////////////////////////////////////
+/******************************************************************************/
+/**
+ * A compact snapshot of a candidate solution, as needed by the solution loggers.
+ * Snapshots are taken in the optimization thread, while formatting and output
+ * may then happen in a background thread. Parameter values are stored per type,
+ * in the same order as in GParameterSet::toCSV().
+ */
+class GSolutionRecord {
+public:
+	 /** @brief Takes a snapshot of an individual */
+	 G_API_GENEVA GSolutionRecord(GParameterSet const &, bool useRawFitness);
+
+	 /** @brief Writes the record in the format of GParameterSet::toCSV() (without names and types) */
+	 G_API_GENEVA void toCSV(std::ostream &, bool withCommas, bool showValidity) const;
+	 /** @brief Retrieves all parameter values, converted to double */
+	 G_API_GENEVA std::vector<double> getParameterValues() const;
+	 /** @brief Retrieves the fitness values; NaN if the individual wasn't processed */
+	 G_API_GENEVA std::vector<double> getFitnessValues() const;
+	 /** @brief Checks whether the individual represents a valid solution */
+	 G_API_GENEVA bool isValid() const;
+
+private:
+	 std::vector<double> m_dValues; ///< The values of all double parameters
+	 std::vector<float> m_fValues; ///< The values of all float parameters
+	 std::vector<std::int32_t> m_iValues; ///< The values of all integer parameters
+	 std::vector<bool> m_bValues; ///< The values of all boolean parameters
+	 std::vector<double> m_fitness; ///< The fitness values; empty if the individual wasn't processed
+	 std::size_t m_nFitness = 0; ///< The number of fitness criteria
+	 bool m_isProcessed = false; ///< Whether the individual has been evaluated
+	 bool m_hasErrors = false; ///< Whether the evaluation has failed
+	 bool m_isValid = false; ///< Whether the individual represents a valid solution
 };
 
 /******************************************************************************/
@@ -1081,7 +1176,10 @@ private:
  * is considered better depends on whether evaluation criteria are maximized or minimized
  * and is determined from the individual. Note that this class can only be instantiated
  * if individual_type is either a derivative of GParamterSet or is an object of the
- * GParameterSet class itself.
+ * GParameterSet class itself. By default, individuals are only snapshotted in the
+ * optimization thread, while formatting and output happen in a background thread
+ * that keeps the file open. Optionally, solutions may additionally be written to a
+ * compact binary file (see setBinaryFileName()).
  */
 class GAllSolutionFileLogger
 	: public GBasePluggableOM
@@ -1103,7 +1201,9 @@ class GAllSolutionFileLogger
 		 & BOOST_SERIALIZATION_NVP(m_useRawFitness)
 		 & BOOST_SERIALIZATION_NVP(m_showValidity)
 		 & BOOST_SERIALIZATION_NVP(m_printInitial)
-		 & BOOST_SERIALIZATION_NVP(m_showIterationBoundaries);
+		 & BOOST_SERIALIZATION_NVP(m_showIterationBoundaries)
+		 & BOOST_SERIALIZATION_NVP(m_binaryFileName)
+		 & BOOST_SERIALIZATION_NVP(m_writeAsync);
 	 }
 	 ///////////////////////////////////////////////////////////////////////
 
@@ -1120,7 +1220,7 @@ public:
 		 , const std::vector<double>& boundaries
 	 );
 	 /** @brief The copy constructor */
-	 G_API_GENEVA GAllSolutionFileLogger(const GAllSolutionFileLogger& cp) = default;
+	 G_API_GENEVA GAllSolutionFileLogger(const GAllSolutionFileLogger& cp);
 	 /** @brief The destructor */
 	 G_API_GENEVA  ~GAllSolutionFileLogger() override = default;
 
@@ -1168,6 +1268,16 @@ public:
 	 /** @brief Allows to check whether a comment line should be inserted between iterations */
 	 G_API_GENEVA bool getShowIterationBoundaries() const;
 
+	 /** @brief Sets the name of a file to which solutions are additionally written in binary format */
+	 G_API_GENEVA void setBinaryFileName(const std::string& binaryFileName);
+	 /** @brief Retrieves the name of the binary output file */
+	 G_API_GENEVA std::string getBinaryFileName() const;
+
+	 /** @brief Allows to specify whether output should happen in a background thread */
+	 G_API_GENEVA void setWriteAsync(bool writeAsync = true);
+	 /** @brief Allows to check whether output happens in a background thread */
+	 G_API_GENEVA bool getWriteAsync() const;
+
 protected:
 	 /************************************************************************/
 
@@ -1214,6 +1324,18 @@ private:
 		 , G_OptimizationAlgorithm_Base const * const goa
 	 );
 
+	 /** @brief Opens the output files */
+	 G_API_GENEVA void openWriters();
+	 /** @brief Waits for all pending output and closes the output files */
+	 G_API_GENEVA void closeWriters();
+
+	 /** @brief Writes a block of records in binary, column-wise format */
+	 static G_API_GENEVA void writeBinaryBlock(
+		 std::ostream&
+		 , std::uint32_t
+		 , std::vector<GSolutionRecord> const&
+	 );
+
 	 /***************************************************************************/
 	 // Data
 
@@ -1226,6 +1348,11 @@ private:
 	 bool m_showValidity = true; ///< Indicates whether the validity of a solution should be shown
 	 bool m_printInitial = false; ///< Indicates whether the initial population should be printed
 	 bool m_showIterationBoundaries = false; ///< Indicates whether a comment indicating the end of an iteration should be printed
+	 std::string m_binaryFileName = ""; ///< The name of a file to which solutions are additionally written in binary format; empty if none
+	 bool m_writeAsync = true; ///< Indicates whether output should happen in a background thread
+
+	 std::unique_ptr<Gem::Common::GAsyncFileWriter> m_csv_writer_ptr; ///< Writes text output; neither serialized nor copied
+	 std::unique_ptr<Gem::Common::GAsyncFileWriter> m_binary_writer_ptr; ///< Writes binary output; neither serialized nor copied
 };
 
 /******************************************************************************/
@@ -1233,7 +1360,8 @@ private:
 /******************************************************************************/
 /**
  * This class prints out all evaluations of each iteration. The format is
- * eval0_0, eval0_1, ... ,eval0_n, ..., evalm_0, evalm_1, ... ,evalm_n
+ * eval0_0, eval0_1, ... ,eval0_n, ..., evalm_0, evalm_1, ... ,evalm_n .
+ * By default, output happens in a background thread that keeps the file open.
  */
 class GIterationResultsFileLogger
 	: public GBasePluggableOM
@@ -1249,7 +1377,8 @@ class GIterationResultsFileLogger
 		 & make_nvp("GBasePluggableOM",	boost::serialization::base_object<GBasePluggableOM>(*this))
 		 & BOOST_SERIALIZATION_NVP(m_fileName)
 		 & BOOST_SERIALIZATION_NVP(m_withCommas)
-		 & BOOST_SERIALIZATION_NVP(m_useRawFitness);
+		 & BOOST_SERIALIZATION_NVP(m_useRawFitness)
+		 & BOOST_SERIALIZATION_NVP(m_writeAsync);
 	 }
 	 ///////////////////////////////////////////////////////////////////////
 
@@ -1261,7 +1390,7 @@ public:
 	 /** @brief Initialization with a file name */
 	 explicit G_API_GENEVA GIterationResultsFileLogger(const std::string& fileName);
 	 /** @brief The copy constructor */
-	 G_API_GENEVA GIterationResultsFileLogger(const GIterationResultsFileLogger& cp) = default;
+	 G_API_GENEVA GIterationResultsFileLogger(const GIterationResultsFileLogger& cp);
 	 /** @brief The destructor */
 	 G_API_GENEVA ~GIterationResultsFileLogger() override = default;
 
@@ -1280,6 +1409,11 @@ public:
 	 /** @brief Allows to retrieve whether the true (instead of the transformed) fitness should be shown */
 	 G_API_GENEVA bool getUseTrueFitness() const;
 
+	 /** @brief Allows to specify whether output should happen in a background thread */
+	 G_API_GENEVA void setWriteAsync(bool writeAsync = true);
+	 /** @brief Allows to check whether output happens in a background thread */
+	 G_API_GENEVA bool getWriteAsync() const;
+
 protected:
 	 /************************************************************************/
 	 /** @brief Loads the data of another object */
@@ -1322,6 +1456,9 @@ private:
 	 std::string m_fileName = "IterationResultsLog.txt"; ///< The name of the file to which solutions should be stored
 	 bool m_withCommas = true; ///< When set to true, commas will be printed in-between values
 	 bool m_useRawFitness = false; ///< Indicates whether true- or transformed fitness should be output
+	 bool m_writeAsync = true; ///< Indicates whether output should happen in a background thread
+
+	 std::unique_ptr<Gem::Common::GAsyncFileWriter> m_writer_ptr; ///< Writes to the output file; neither serialized nor copied
 };
 
 /******************************************************************************/
@@ -2002,7 +2139,8 @@ class GProcessingTimesLogger
 		 & BOOST_SERIALIZATION_NVP(m_post_processing_times_hist2D)
 		 & BOOST_SERIALIZATION_NVP(m_all_processing_times_hist2D)
 		 & BOOST_SERIALIZATION_NVP(m_nBinsX)
-		 & BOOST_SERIALIZATION_NVP(m_nBinsY);
+		 & BOOST_SERIALIZATION_NVP(m_nBinsY)
+		 & BOOST_SERIALIZATION_NVP(m_streamingHistograms);
 	 }
 	 ///////////////////////////////////////////////////////////////////////
 
@@ -2063,6 +2201,11 @@ public:
 	 /** @brief Retrieves the current number of bins for the processing times histograms in y-direction */
 	 G_API_GENEVA std::size_t getNBinsY() const;
 
+	 /** @brief Specifies whether the histograms should bin timings directly instead of storing them */
+	 G_API_GENEVA void setStreamingHistograms(bool streamingHistograms);
+	 /** @brief Checks whether the histograms bin timings directly instead of storing them */
+	 G_API_GENEVA bool getStreamingHistograms() const;
+
 protected:
 	 /************************************************************************/
 
@@ -2127,6 +2270,8 @@ private:
 
 	 std::size_t m_nBinsX = Gem::Common::DEFAULTNBINSGPD; ///< The number of bins in the histograms in x-direction
 	 std::size_t m_nBinsY = Gem::Common::DEFAULTNBINSGPD; ///< The number of bins in the histograms in y-direction
+
+	 bool m_streamingHistograms = false; ///< Whether the histograms bin timings directly, so memory does not grow with the number of evaluations
 };
 
 /******************************************************************************/
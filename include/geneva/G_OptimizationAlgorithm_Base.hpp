@@ -45,6 +45,11 @@
 #include <chrono>
 #include <type_traits>
 #include <utility>
+#include <functional>
+#include <algorithm>
+#include <future>
+#include <map>
+#include <unordered_set>
 
 // Boost header files go here
 #include <boost/filesystem.hpp>
@@ -56,6 +61,7 @@
 #include "common/GCommonHelperFunctionsT.hpp"
 #include "common/GSerializationHelperFunctionsT.hpp"
 #include "common/GPlotDesigner.hpp"
+#include "common/GThreadPool.hpp"
 #include "courtier/GExecutorT.hpp"
 #include "geneva/GObject.hpp"
 #include "geneva/G_Interface_OptimizerT.hpp"
@@ -217,6 +223,10 @@ private:
         & BOOST_SERIALIZATION_NVP(m_cp_last)
         & BOOST_SERIALIZATION_NVP(m_cp_remove)
         & BOOST_SERIALIZATION_NVP(m_cp_serialization_mode)
+        & BOOST_SERIALIZATION_NVP(m_cp_async)
+        & BOOST_SERIALIZATION_NVP(m_cp_full_interval)
+        & BOOST_SERIALIZATION_NVP(m_cp_delta_base)
+        & BOOST_SERIALIZATION_NVP(m_cp_delta_ids)
         & BOOST_SERIALIZATION_NVP(m_qualityThreshold)
         & BOOST_SERIALIZATION_NVP(m_hasQualityThreshold)
         & BOOST_SERIALIZATION_NVP(m_maxDuration)
@@ -266,6 +276,10 @@ private:
         & BOOST_SERIALIZATION_NVP(m_cp_last)
         & BOOST_SERIALIZATION_NVP(m_cp_remove)
         & BOOST_SERIALIZATION_NVP(m_cp_serialization_mode)
+        & BOOST_SERIALIZATION_NVP(m_cp_async)
+        & BOOST_SERIALIZATION_NVP(m_cp_full_interval)
+        & BOOST_SERIALIZATION_NVP(m_cp_delta_base)
+        & BOOST_SERIALIZATION_NVP(m_cp_delta_ids)
         & BOOST_SERIALIZATION_NVP(m_qualityThreshold)
         & BOOST_SERIALIZATION_NVP(m_hasQualityThreshold)
         & BOOST_SERIALIZATION_NVP(m_maxDuration)
@@ -327,6 +341,16 @@ public:
     G_API_GENEVA void setRemoveCheckpointFiles(bool cp_remove);
     /** @brief Allows to check whether checkpoint files will be removed */
     G_API_GENEVA bool checkpointFilesAreRemoved() const;
+    /** @brief Specifies whether checkpoint files should be written by a background thread */
+    G_API_GENEVA void setCheckpointAsync(bool cp_async);
+    /** @brief Checks whether checkpoint files are written by a background thread */
+    G_API_GENEVA bool getCheckpointAsync() const;
+    /** @brief Sets how often complete checkpoints are written; others only hold changed individuals */
+    G_API_GENEVA void setCheckpointFullInterval(std::uint32_t cp_full_interval);
+    /** @brief Retrieves how often complete checkpoints are written */
+    G_API_GENEVA std::uint32_t getCheckpointFullInterval() const;
+    /** @brief Waits until all checkpoint files scheduled for writing have been written */
+    G_API_GENEVA void waitForCheckpoints() const;
 
     /** @brief Resets the class to the state before the optimize call. */
     G_API_GENEVA void resetToOptimizationStart();
@@ -493,12 +517,24 @@ public:
     /** @brief Checks whether a checkpoint-file has the same "personality" as our own algorithm */
     G_API_GENEVA bool cp_personality_fits(const boost::filesystem::path &p) const;
 
+    /** @brief Registers a function to be called at the end of each iteration, e.g. to exchange individuals with concurrent optimizations */
+    G_API_GENEVA void registerMigrationHook(std::function<void(G_OptimizationAlgorithm_Base &)> migrationHook);
+    /** @brief Removes a registered migration hook */
+    G_API_GENEVA void resetMigrationHook();
+    /** @brief Checks whether a migration hook has been registered */
+    G_API_GENEVA bool hasMigrationHook() const;
+
+    /** @brief Retrieves copies of the best processed individuals of the current population */
+    G_API_GENEVA std::vector<std::shared_ptr<GParameterSet>> getEmigrants(std::size_t nEmigrants) const;
+    /** @brief Lets individuals from other populations replace the worst local individuals */
+    G_API_GENEVA std::size_t integrateImmigrants(std::vector<std::shared_ptr<GParameterSet>> const & immigrants);
+
 protected:
     /***************************************************************************/
     // Some data
 
-    Gem::Hap::GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMPROXY>
-        m_gr; ///< A random number generator. Note that the actual calculation is done in a random number proxy / factory
+    Gem::Hap::GRandomT<Gem::Hap::DEFAULTRANDFLAVOUR>
+        m_gr; ///< A random number generator. Note that by default the actual calculation is done in a random number proxy / factory
     std::uniform_real_distribution<double>
         m_uniform_real_distribution; ///< Access to uniformly distributed double random values
 
@@ -548,12 +584,15 @@ protected:
         std::vector<std::shared_ptr<GParameterSet>> &workItems
         , bool resubmitUnprocessed = false
         , const std::string &caller = std::string()
+        , bool useIterationCounter = true
     );
     /** @brief Retrieves a vector of old work items after job submission */
     G_API_GENEVA std::vector<std::shared_ptr<GParameterSet>> getOldWorkItems();
 
     /** @brief Saves the state of the class to disc */
     G_API_GENEVA void saveCheckpoint(bf::path const & outputFile) const;
+    /** @brief Passes on errors of checkpoints that have already been written in the background */
+    G_API_GENEVA void collectFinishedCheckpoints() const;
 
     /** @brief Extracts the short name of the optimization algorithm */
     G_API_GENEVA std::string extractOptAlgFromPath(const boost::filesystem::path &p) const;
@@ -586,6 +625,13 @@ protected:
     /** @brief Let individuals know the number of stalls encountered so far */
     G_API_GENEVA void markNStalls();
 
+    /** @brief Replaces the worst individuals in a given range with better immigrants */
+    G_API_GENEVA std::size_t replaceWorstIndividuals(
+        std::vector<std::shared_ptr<GParameterSet>> const & immigrants
+        , std::size_t first
+        , std::size_t last
+    );
+
 private:
     /***************************************************************************/
     // Overloaded or virtual base functions
@@ -627,6 +673,9 @@ private:
     /** @brief Gives derived classes an opportunity to update their internal structures. */
     virtual G_API_GENEVA void actOnStalls_() BASE = 0;
 
+    /** @brief Lets individuals from other populations replace local individuals */
+    virtual G_API_GENEVA std::size_t integrateImmigrants_(std::vector<std::shared_ptr<GParameterSet>> const & immigrants) BASE;
+
     /***************************************************************************/
 
     /** @brief Update the stall counter. */
@@ -714,6 +763,15 @@ private:
     mutable std::string m_cp_last = "empty"; ///< The name of the last saved checkpoint
     bool m_cp_remove = true; ///< Whether checkpoint files should be overwritten or kept
     Gem::Common::serializationMode m_cp_serialization_mode = DEFAULTCPSERMODE; ///< Determines whether check-pointing should be done in text-, XML, or binary mode
+    bool m_cp_async = DEFAULTCPASYNC; ///< Whether checkpoint files are written by a background thread
+    std::uint32_t m_cp_full_interval = DEFAULTCPFULLINTERVAL; ///< Every n-th checkpoint is complete, the others only hold individuals changed since then. 0 means: all checkpoints are complete
+    std::string m_cp_delta_base = ""; ///< Only set in delta checkpoints: The file name of the complete checkpoint they refer to
+    std::vector<std::string> m_cp_delta_ids; ///< Only set in delta checkpoints: For each position, the evaluation id of an unchanged individual or an empty string for stored ones
+    mutable std::uint32_t m_cp_counter = 0; ///< The number of checkpoints written in this optimization run; neither serialized nor copied
+    mutable std::string m_cp_last_full = "empty"; ///< The name of the last complete checkpoint; neither serialized nor copied
+    mutable std::unordered_set<std::string> m_cp_full_ids; ///< Evaluation ids of the individuals in the last complete checkpoint; neither serialized nor copied
+    mutable std::shared_ptr<Gem::Common::GThreadPool> m_cp_writer_ptr; ///< Writes checkpoint files in the background; neither serialized nor copied
+    mutable std::vector<std::future<void>> m_cp_futures_cnt; ///< Allows to wait for checkpoint files being written; neither serialized nor copied
     double m_qualityThreshold = DEFAULTQUALITYTHRESHOLD; ///< A threshold beyond which optimization is expected to stop
     bool m_hasQualityThreshold = false; ///< Specifies whether a qualityThreshold has been set
     std::chrono::duration<double>
@@ -738,6 +796,9 @@ private:
         = execMode::BROKER; ///< The default execution mode. Unless explicitöy requested by the user, we always go through the broker
     std::string m_default_executor_config
         = "./config/GBrokerExecutor.json"; ///< The default configuration file for the broker executor
+
+    std::function<void(G_OptimizationAlgorithm_Base &)>
+        m_migration_hook; ///< Called at the end of each iteration; neither serialized nor copied
 };
 
 /*******************************************************************************/
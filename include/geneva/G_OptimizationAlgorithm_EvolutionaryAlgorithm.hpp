@@ -42,6 +42,7 @@
 // Standard headers go here
 #include <vector>
 #include <tuple>
+#include <limits>
 
 // Boost headers go here
 
@@ -49,6 +50,7 @@
 #include "common/GExceptions.hpp"
 #include "common/GCommonHelperFunctionsT.hpp"
 #include "common/GPlotDesigner.hpp"
+#include "common/GRBFSurrogate.hpp"
 #include "geneva/GOptimizationEnums.hpp"
 #include "geneva/GParameterSet.hpp"
 #include "geneva/G_OptimizationAlgorithm_ParChild.hpp"
@@ -68,6 +70,41 @@ namespace Geneva {
  */
 const sortingMode DEFAULTEASORTINGMODE = sortingMode::MUCOMMANU_SINGLEEVAL;
 
+/**
+ * Steady-state mode is switched off by default
+ */
+const bool DEFAULTEASTEADYSTATE = false;
+
+/**
+ * The default number of children evaluated together in steady-state mode
+ */
+const std::size_t DEFAULTEASTEADYSTATEBATCHSIZE = 1;
+
+/**
+ * Hopeless children are evaluated to completion by default
+ */
+const bool DEFAULTEACANCELHOPELESSCHILDREN = false;
+
+/**
+ * Surrogate pre-screening of children is switched off by default
+ */
+const bool DEFAULTEAUSESURROGATE = false;
+
+/**
+ * The default number of candidates per child created for surrogate pre-screening
+ */
+const double DEFAULTEASURROGATEOVERGENERATION = 3.;
+
+/**
+ * The default number of iterations after which the surrogate model is refreshed
+ */
+const std::uint32_t DEFAULTEASURROGATEREFRESHINTERVAL = 1;
+
+/**
+ * The default number of evaluated individuals kept by the surrogate model
+ */
+const std::size_t DEFAULTEASURROGATEARCHIVESIZE = Gem::Common::DEFAULTRBFMAXARCHIVESIZE;
+
 /******************************************************************************/
 ////////////////////////////////////////////////////////////////////////////////
 /******************************************************************************/
@@ -90,7 +127,14 @@ class GEvolutionaryAlgorithm
             "G_OptimizationAlgorithm_ParChild"
             , boost::serialization::base_object<G_OptimizationAlgorithm_ParChild>(*this))
         & BOOST_SERIALIZATION_NVP(m_sorting_mode)
-        & BOOST_SERIALIZATION_NVP(m_n_threads);
+        & BOOST_SERIALIZATION_NVP(m_n_threads)
+        & BOOST_SERIALIZATION_NVP(m_use_steady_state)
+        & BOOST_SERIALIZATION_NVP(m_steady_state_batch_size)
+        & BOOST_SERIALIZATION_NVP(m_cancel_hopeless_children)
+        & BOOST_SERIALIZATION_NVP(m_use_surrogate)
+        & BOOST_SERIALIZATION_NVP(m_surrogate_overgeneration)
+        & BOOST_SERIALIZATION_NVP(m_surrogate_refresh_interval)
+        & BOOST_SERIALIZATION_NVP(m_surrogate_archive_size);
     }
     ///////////////////////////////////////////////////////////////////////
 
@@ -118,6 +162,37 @@ public:
     /** @brief Retrieves the number of threads this population uses for adaption */
     G_API_GENEVA std::uint16_t getNThreads() const;
 
+    /** @brief Switches the asynchronous steady-state mode on or off */
+    G_API_GENEVA void setUseSteadyState(bool useSteadyState);
+    /** @brief Checks whether the asynchronous steady-state mode is used */
+    G_API_GENEVA bool getUseSteadyState() const;
+    /** @brief Sets the number of children evaluated together in steady-state mode */
+    G_API_GENEVA void setSteadyStateBatchSize(std::size_t batchSize);
+    /** @brief Retrieves the number of children evaluated together in steady-state mode */
+    G_API_GENEVA std::size_t getSteadyStateBatchSize() const;
+
+    /** @brief Allows children to stop their evaluation once they cannot beat the worst parent */
+    G_API_GENEVA void setCancelHopelessChildren(bool cancelHopelessChildren);
+    /** @brief Checks whether children may stop their evaluation once they cannot beat the worst parent */
+    G_API_GENEVA bool getCancelHopelessChildren() const;
+
+    /** @brief Switches surrogate pre-screening of children on or off */
+    G_API_GENEVA void setUseSurrogate(bool useSurrogate);
+    /** @brief Checks whether children are pre-screened with a surrogate model */
+    G_API_GENEVA bool getUseSurrogate() const;
+    /** @brief Sets the number of candidates created per child for surrogate pre-screening */
+    G_API_GENEVA void setSurrogateOvergeneration(double overgeneration);
+    /** @brief Retrieves the number of candidates created per child for surrogate pre-screening */
+    G_API_GENEVA double getSurrogateOvergeneration() const;
+    /** @brief Sets the number of iterations after which the surrogate model is refreshed */
+    G_API_GENEVA void setSurrogateRefreshInterval(std::uint32_t refreshInterval);
+    /** @brief Retrieves the number of iterations after which the surrogate model is refreshed */
+    G_API_GENEVA std::uint32_t getSurrogateRefreshInterval() const;
+    /** @brief Sets the number of evaluated individuals kept by the surrogate model */
+    G_API_GENEVA void setSurrogateArchiveSize(std::size_t archiveSize);
+    /** @brief Retrieves the number of evaluated individuals kept by the surrogate model */
+    G_API_GENEVA std::size_t getSurrogateArchiveSize() const;
+
 protected:
     /***************************************************************************/
     // Virtual or overridden protected functions
@@ -163,6 +238,14 @@ protected:
 
     /** @brief Fixes the population after a job submission */
     G_API_GENEVA void fixAfterJobSubmission();
+    /** @brief Evaluates children in batches, letting each batch compete with the parents as soon as it returns */
+    G_API_GENEVA void runSteadyStateFitnessCalculation();
+    /** @brief Tells children in a given range which fitness they need to beat in order to be selected */
+    G_API_GENEVA void setChildCancellationBounds(std::size_t, std::size_t);
+    /** @brief Creates surplus children and keeps those the surrogate model considers most promising */
+    G_API_GENEVA void surrogatePreScreening();
+    /** @brief Adds the individuals evaluated in this iteration to the surrogate model */
+    G_API_GENEVA void updateSurrogate();
 
 private:
     /***************************************************************************/
@@ -216,11 +299,22 @@ private:
     G_API_GENEVA void sortMuPlusNuParetoMode();
     /** @brief Selection according to the pareto tag, not taking into account the parents of a population (i.e. in MUCOMMANU mode). */
     G_API_GENEVA void sortMuCommaNuParetoMode();
+    /** @brief Sorts the population according to pareto fronts, starting with a given position */
+    G_API_GENEVA void sortParetoFronts(std::size_t);
     /** @brief Determines whether the first individual dominates the second */
     G_API_GENEVA bool aDominatesB(
         std::shared_ptr<GParameterSet> a
         , std::shared_ptr<GParameterSet> b
     ) const;
+    /** @brief Determines whether the first (minimization-only) fitness vector dominates the second */
+    static G_API_GENEVA bool aDominatesB(
+        std::vector<double> const& a
+        , std::vector<double> const& b
+    );
+    /** @brief Assigns a pareto front to each fitness vector, following Deb's fast non-dominated sorting */
+    static G_API_GENEVA std::vector<std::size_t> fastNonDominatedSort(
+        std::vector<std::vector<double>> const&
+    );
 
     /** @brief Fills the collection with individuals */
     G_API_GENEVA void fillWithObjects(const std::size_t &nIndividuals);
@@ -231,6 +325,14 @@ private:
     sortingMode m_sorting_mode = DEFAULTEASORTINGMODE; ///< The chosen sorting scheme
     std::uint16_t m_n_threads = Gem::Common::DEFAULTNHARDWARETHREADS; ///< The number of threads
     std::shared_ptr<Gem::Common::GThreadPool> m_tp_ptr; ///< Temporarily holds a thread pool
+    bool m_use_steady_state = DEFAULTEASTEADYSTATE; ///< Whether children are evaluated and selected in asynchronous batches
+    std::size_t m_steady_state_batch_size = DEFAULTEASTEADYSTATEBATCHSIZE; ///< The number of children evaluated together in steady-state mode
+    bool m_cancel_hopeless_children = DEFAULTEACANCELHOPELESSCHILDREN; ///< Whether children may stop their evaluation once they cannot beat the worst parent
+    bool m_use_surrogate = DEFAULTEAUSESURROGATE; ///< Whether children are pre-screened with a surrogate model before submission
+    double m_surrogate_overgeneration = DEFAULTEASURROGATEOVERGENERATION; ///< The number of candidates created per child for pre-screening
+    std::uint32_t m_surrogate_refresh_interval = DEFAULTEASURROGATEREFRESHINTERVAL; ///< The number of iterations after which the surrogate is refreshed
+    std::size_t m_surrogate_archive_size = DEFAULTEASURROGATEARCHIVESIZE; ///< The number of evaluated individuals kept by the surrogate
+    std::shared_ptr<Gem::Common::GRBFSurrogate> m_surrogate_ptr; ///< Temporarily holds the surrogate model
 
     /***************************************************************************/
 };
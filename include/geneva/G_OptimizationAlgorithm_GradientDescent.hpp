@@ -95,7 +95,9 @@ class GGradientDescent
         & BOOST_SERIALIZATION_NVP(nStartingPoints_)
         & BOOST_SERIALIZATION_NVP(nFPParmsFirst_)
         & BOOST_SERIALIZATION_NVP(finiteStep_)
-        & BOOST_SERIALIZATION_NVP(stepSize_);
+        & BOOST_SERIALIZATION_NVP(stepSize_)
+        & BOOST_SERIALIZATION_NVP(gradientEstimator_)
+        & BOOST_SERIALIZATION_NVP(spsaPerturbations_);
     }
 
     ///////////////////////////////////////////////////////////////////////
@@ -125,6 +127,11 @@ public:
     /** @brief Retrieves the current step size */
     G_API_GENEVA double getStepSize() const;
 
+    /** @brief Specifies how the gradient is estimated */
+    G_API_GENEVA void setGradientEstimator(gradientEstimator);
+    /** @brief Retrieves the method used for the estimation of the gradient */
+    G_API_GENEVA gradientEstimator getGradientEstimator() const;
+
 protected:
     /***************************************************************************/
     // Virtual or overridden protected functions
@@ -212,6 +219,7 @@ private:
 
     double finiteStep_ = DEFAULTFINITESTEP; ///< The size of the incremental adaption of the feature vector
     double stepSize_ = DEFAULTSTEPSIZE; ///< A multiplicative factor for the adaption
+    gradientEstimator gradientEstimator_ = DEFAULTGRADIENTESTIMATOR; ///< Specifies how the gradient is estimated
     long double stepRatio_ = (
         DEFAULTSTEPSIZE / DEFAULTFINITESTEP
     ); ///< The ratio of stepSize_ and finiteStep_. NOTE: long double; Will be recalculated in init()
@@ -223,8 +231,13 @@ private:
     std::vector<double> adjustedFiniteStep_
         = std::vector<double>(); ///< A step-size normalized to each parameter range; Will be recalculated in init()
 
+    std::vector<double> spsaPerturbations_
+        = std::vector<double>(); ///< The random directions (+1 or -1) of the SPSA perturbation of each starting point
+
     /** @brief Lets individuals know about their position in the population */
     void markIndividualPositions();
+    /** @brief Retrieves the number of evaluations needed for the gradient of each starting point */
+    std::size_t getNChildrenPerStartingPoint() const;
 };
 
 /******************************************************************************/
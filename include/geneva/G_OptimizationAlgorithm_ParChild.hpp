@@ -288,6 +288,9 @@ private:
     /** @brief Gives individuals an opportunity to update their internal structures */
     G_API_GENEVA void actOnStalls_() override;
 
+    /** @brief Lets immigrants replace the worst parents */
+    G_API_GENEVA std::size_t integrateImmigrants_(std::vector<std::shared_ptr<GParameterSet>> const & immigrants) override;
+
 
     /** @brief Adapts all children of this population */
     virtual G_API_GENEVA void adaptChildren_() BASE = 0;
@@ -42,11 +42,14 @@
 // Standard headers go here
 #include <fstream>
 #include <memory>
+#include <limits>
+#include <tuple>
 
 // Boost headers go here
 
 // Geneva headers go here
 #include "hap/GRandomT.hpp"
+#include "hap/GQuasiRandom.hpp"
 #include "common/GExceptions.hpp"
 #include "common/GCommonHelperFunctionsT.hpp"
 #include "common/GPlotDesigner.hpp"
@@ -139,6 +142,9 @@ public:
     virtual G_API_GENEVA ~scanParInterface() BASE = default;
     virtual G_API_GENEVA NAMEANDIDTYPE getVarAddress() const BASE = 0;
     virtual G_API_GENEVA bool goToNextItem() BASE = 0;
+    virtual G_API_GENEVA std::size_t getNSteps() const BASE = 0;
+    virtual G_API_GENEVA void setPosition(std::size_t) BASE = 0;
+    virtual G_API_GENEVA void setUnitPosition(double) BASE = 0;
     virtual G_API_GENEVA bool isAtTerminalPosition() const BASE = 0;
     virtual G_API_GENEVA bool isAtFirstPosition() const BASE = 0;
     virtual G_API_GENEVA void resetPosition() BASE = 0;
@@ -195,7 +201,9 @@ public:
         , m_lower(pps.lowerBoundary)
         , m_upper(pps.upperBoundary)
         , m_randomScan(randomScan)
-        , m_typeDescription(t) {
+        , m_typeDescription(t)
+        , m_unitPos(0.)
+        , m_useUnitPos(false) {
         if (not m_randomScan) {
             // Fill the object with data
             this->m_data_cnt = fillWithData<T>(
@@ -212,13 +220,16 @@ public:
      * random number generator.
      */
     baseScanParT(const baseScanParT<T> &cp)
-        : m_var(cp.m_var)
+        : Gem::Common::GPODVectorT<T>(cp)
+        , m_var(cp.m_var)
         , m_step(cp.m_step)
-        , m_nSteps(cp.m_step)
+        , m_nSteps(cp.m_nSteps)
         , m_lower(cp.m_lower)
         , m_upper(cp.m_upper)
         , m_randomScan(cp.m_randomScan)
         , m_typeDescription(cp.m_typeDescription)
+        , m_unitPos(cp.m_unitPos)
+        , m_useUnitPos(cp.m_useUnitPos)
     { /* nothing */ }
 
     /***************************************************************************/
@@ -250,7 +261,9 @@ public:
     T getCurrentItem(
         Gem::Hap::GRandomBase &gr
     ) const {
-        if (m_randomScan) {
+        if (m_useUnitPos) {
+            return getItemAtUnitPosition(m_unitPos);
+        } else if (m_randomScan) {
             return getRandomItem(gr);
         } else {
             return this->at(m_step);
@@ -264,19 +277,71 @@ public:
      * @return A boolean indicating whether a warp has taken place
      */
     bool goToNextItem() override {
-        if (++m_step >= m_nSteps) {
+        if (++m_step >= this->getNSteps()) {
             m_step = 0;
             return true;
         }
         return false;
     }
 
+    /***************************************************************************/
+    /**
+     * Retrieves the number of values of this parameter. On a grid this is the
+     * number of grid points actually created, which may differ from the requested
+     * number of steps (e.g. for booleans or integer ranges).
+     */
+    std::size_t getNSteps() const override {
+        return m_randomScan ? m_nSteps : this->size();
+    }
+
+    /***************************************************************************/
+    /**
+     * Sets the current position, e.g. when decoding a combination index
+     */
+    void setPosition(std::size_t step) override {
+        if (step >= this->getNSteps()) {
+            throw gemfony_exception(
+                g_error_streamer(
+                    DO_LOG
+                    , time_and_place
+                )
+                    << "In baseScanParT::setPosition(): Error!" << std::endl
+                    << "Invalid position " << step << " for " << this->getNSteps() << " steps" << std::endl
+            );
+        }
+
+        m_step = step;
+        m_useUnitPos = false;
+    }
+
+    /***************************************************************************/
+    /**
+     * Lets the current item be determined by a position in [0,1) inside of the
+     * value range, e.g. a coordinate of a quasi-random sequence. Remains in effect
+     * until setPosition() is called.
+     */
+    void setUnitPosition(double unitPos) override {
+        if (unitPos < 0. || unitPos >= 1.) {
+            throw gemfony_exception(
+                g_error_streamer(
+                    DO_LOG
+                    , time_and_place
+                )
+                    << "In baseScanParT::setUnitPosition(): Error!" << std::endl
+                    << "Position " << unitPos << " is outside of [0,1)" << std::endl
+            );
+        }
+
+        m_unitPos = unitPos;
+        m_useUnitPos = true;
+    }
+
     /***************************************************************************/
     /**
      * Checks whether step_ points to the last item in the array
      */
     bool isAtTerminalPosition() const override {
-        return m_step >= m_nSteps;
+        return m_step >= this->getNSteps();
     }
 
     /***************************************************************************/
@@ -293,6 +358,7 @@ public:
      */
     void resetPosition() override {
         m_step = 0;
+        m_useUnitPos = false;
     }
 
     /***************************************************************************/
@@ -314,6 +380,8 @@ protected:
     T m_upper; ///< The upper boundary of an item
     bool m_randomScan; ///< Indicates whether we are dealing with a random scan or not
     std::string m_typeDescription; ///< Holds an identifier for the type described by this class
+    double m_unitPos; ///< A position inside of [0,1), used instead of m_step or random values if m_useUnitPos is set
+    bool m_useUnitPos; ///< Indicates whether the current item is determined by m_unitPos
 
     mutable Gem::Hap::GRandom m_gr; ///< Simple access to a random number generator
 
@@ -333,6 +401,8 @@ protected:
         , m_upper(T(1))
         , m_randomScan(true)
         , m_typeDescription("")
+        , m_unitPos(0.)
+        , m_useUnitPos(false)
     { /* nothing */ }
 
     /***************************************************************************/
@@ -356,6 +426,25 @@ protected:
         return T(0);
     }
 
+    /***************************************************************************/
+    /**
+     * Maps a position in [0,1) onto the value range. To be re-implemented for each supported type
+     */
+    T getItemAtUnitPosition(double /* unitPos */) const {
+        // A trap. This function needs to be re-implemented for each supported type
+        throw gemfony_exception(
+            g_error_streamer(
+                DO_LOG
+                , time_and_place
+            )
+                << "In baseScanParT::getItemAtUnitPosition(): Error!" << std::endl
+                << "Function called for unsupported type" << std::endl
+        );
+
+        // Make the compiler happy
+        return T(0);
+    }
+
 private:
     mutable std::bernoulli_distribution m_uniform_bool; ///< boolean random numbers with an even distribution
     mutable std::uniform_real_distribution<float> m_uniform_float_distribution;  ///< Uniformly distributed fp numbers
@@ -425,6 +514,45 @@ inline std::int32_t baseScanParT<std::int32_t>::getRandomItem(
         ));
 }
 
+/******************************************************************************/
+/**
+ * Maps a position in [0,1) onto a boolean value
+ */
+template<>
+inline bool baseScanParT<bool>::getItemAtUnitPosition(double unitPos) const {
+    return unitPos >= 0.5;
+}
+
+/******************************************************************************/
+/**
+ * Maps a position in [0,1) onto the float value range
+ */
+template<>
+inline float baseScanParT<float>::getItemAtUnitPosition(double unitPos) const {
+    return m_lower + static_cast<float>(unitPos) * (m_upper - m_lower);
+}
+
+/******************************************************************************/
+/**
+ * Maps a position in [0,1) onto the double value range
+ */
+template<>
+inline double baseScanParT<double>::getItemAtUnitPosition(double unitPos) const {
+    return m_lower + unitPos * (m_upper - m_lower);
+}
+
+/******************************************************************************/
+/**
+ * Maps a position in [0,1) onto the (inclusive) integer value range, so that
+ * all values cover equally sized parts of [0,1)
+ */
+template<>
+inline std::int32_t baseScanParT<std::int32_t>::getItemAtUnitPosition(double unitPos) const {
+    std::int64_t nValues = std::int64_t(m_upper) - std::int64_t(m_lower) + 1;
+    std::int64_t offset = (std::min)(static_cast<std::int64_t>(unitPos * static_cast<double>(nValues)), nValues - 1);
+    return static_cast<std::int32_t>(std::int64_t(m_lower) + offset);
+}
+
 /******************************************************************************/
 ////////////////////////////////////////////////////////////////////////////////
 /******************************************************************************/
@@ -646,7 +774,9 @@ const std::size_t DEFAULTNMONITORINDS = 10;
  * best solution). So realistically, this algorithm can only be used for small
  * numbers of parameters and steps. In random sampling mode, the algorithm will
  * try to evenly scatter random individuals throughout the parameter space (defined
- * by those parameters intended to be modified). The optimization monitor associated
+ * by those parameters intended to be modified). Instead of uniform random numbers,
+ * Halton or Sobol sequences may be used, which cover the parameter space more evenly.
+ * The optimization monitor associated
  * with this class will simply store all parameters and results in an XML file.
  */
 class GParameterScan
@@ -671,7 +801,12 @@ class GParameterScan
         & BOOST_SERIALIZATION_NVP(m_d_cnt)
         & BOOST_SERIALIZATION_NVP(m_f_cnt)
         & BOOST_SERIALIZATION_NVP(m_simpleScanItems)
-        & BOOST_SERIALIZATION_NVP(m_scansPerformed);
+        & BOOST_SERIALIZATION_NVP(m_scansPerformed)
+        & BOOST_SERIALIZATION_NVP(m_nShards)
+        & BOOST_SERIALIZATION_NVP(m_shardIndex)
+        & BOOST_SERIALIZATION_NVP(m_scanSequence)
+        & BOOST_SERIALIZATION_NVP(m_scrambleSequence)
+        & BOOST_SERIALIZATION_NVP(m_scrambleSeed);
     }
 
     ///////////////////////////////////////////////////////////////////////
@@ -704,6 +839,28 @@ public:
     /** @brief Allows to check whether the parameter space should be scanned randomly or on a grid */
     G_API_GENEVA bool getScanRandomly() const;
 
+    /** @brief Restricts the scan to one of a number of equally sized ranges of parameter combinations */
+    G_API_GENEVA void setShard(std::size_t, std::size_t);
+    /** @brief Retrieves the number of ranges the parameter combinations are split into */
+    G_API_GENEVA std::size_t getNShards() const;
+    /** @brief Retrieves the range of parameter combinations scanned by this object */
+    G_API_GENEVA std::size_t getShardIndex() const;
+
+    /** @brief Specifies how random scans pick their samples */
+    G_API_GENEVA void setScanSequence(scanSequence);
+    /** @brief Retrieves how random scans pick their samples */
+    G_API_GENEVA scanSequence getScanSequence() const;
+
+    /** @brief Specifies whether quasi-random sequences should be scrambled, and the seed to be used */
+    G_API_GENEVA void setScrambleSequence(bool, Gem::Hap::seed_type = Gem::Hap::DEFAULTSTARTSEED);
+    /** @brief Checks whether quasi-random sequences are scrambled */
+    G_API_GENEVA bool getScrambleSequence() const;
+    /** @brief Retrieves the seed used for the scrambling of quasi-random sequences */
+    G_API_GENEVA Gem::Hap::seed_type getScrambleSeed() const;
+
+    /** @brief Retrieves the overall number of parameter combinations to be scanned */
+    G_API_GENEVA std::size_t getNCombinations() const;
+
 protected:
     /***************************************************************************/
     // Virtual or overridden protected functions
@@ -848,12 +1005,17 @@ private:
     /** @brief Randomly shuffle the work items a number of times */
     void randomShuffle();
 
-    /** @brief Retrieves the next available parameter set */
+    /** @brief Retrieves the parameter set belonging to the current positions of all parameter objects */
     std::shared_ptr<parSet> getParameterSet(std::size_t &);
+    /** @brief Retrieves the parameter set with a given combination index */
+    std::shared_ptr<parSet> getParameterSet(std::size_t, std::size_t &);
 
     /** @brief Switches to the next parameter set */
     bool switchToNextParameterSet();
 
+    /** @brief Retrieves the first and (exclusive) last combination index of a shard */
+    std::tuple<std::size_t, std::size_t> getShardRange(std::size_t) const;
+
     /** @brief Fills all parameter objects into the m_all_par_vec vector */
     void fillAllParVec();
 
@@ -876,6 +1038,16 @@ private:
         = 0; ///< When set to a value > 0, a random scan of the entire parameter space will be made instead of individual parameters -- set through the configuration file
     std::size_t m_scansPerformed = 0; ///< Holds the number of processed items so far while a simple scan is performed
 
+    std::size_t m_nShards = 1; ///< The number of ranges the parameter combinations are split into
+    std::size_t m_shardIndex = 0; ///< The range of parameter combinations scanned by this object
+    std::size_t m_nextCombination = 0; ///< The index of the next parameter combination to be scanned; Will be set in init()
+    std::size_t m_endCombination = 0; ///< The end of the range of combination indices to be scanned; Will be set in init()
+
+    scanSequence m_scanSequence = DEFAULTSCANSEQUENCE; ///< Determines how random scans pick their samples
+    bool m_scrambleSequence = DEFAULTSCRAMBLESCANSEQUENCE; ///< Indicates whether quasi-random sequences are scrambled
+    Gem::Hap::seed_type m_scrambleSeed = Gem::Hap::DEFAULTSTARTSEED; ///< The seed used for scrambling; must be identical for all shards
+    std::shared_ptr<Gem::Hap::GQuasiRandomSequence> m_sequence_ptr; ///< The quasi-random sequence used in random scans, if any; Will be set in init()
+
     /***************************************************************************/
 };
 
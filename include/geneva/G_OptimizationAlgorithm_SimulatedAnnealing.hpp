@@ -41,6 +41,8 @@
 
 // Standard headers go here
 #include <tuple>
+#include <vector>
+#include <cmath>
 
 // Boost headers go here
 
@@ -52,6 +54,7 @@
 #include "geneva/GParameterSet.hpp"
 #include "geneva/G_OptimizationAlgorithm_ParChild.hpp"
 #include "geneva/G_OptimizationAlgorithm_SimulatedAnnealing_PersonalityTraits.hpp"
+#include "geneva/GTestIndividual1.hpp"
 
 namespace Gem {
 namespace Geneva {
@@ -62,6 +65,10 @@ namespace Geneva {
 /**
  * This is a specialization of the GParameterSetParChild class. The class adds
  * an infrastructure for simulated annealing (Geneva-style, i.e. with larger populations).
+ * In parallel tempering (replica exchange) mode, each parent is a chain running at its
+ * own temperature, with temperatures increasing geometrically from the first parent
+ * onwards. Children are assigned to the chains in turn, so that all chains advance in the
+ * same evaluation cycle, and neighboring chains periodically attempt to swap their states.
  */
 class GSimulatedAnnealing :
     public G_OptimizationAlgorithm_ParChild
@@ -80,7 +87,12 @@ class GSimulatedAnnealing :
         & BOOST_SERIALIZATION_NVP(m_t0)
         & BOOST_SERIALIZATION_NVP(m_t)
         & BOOST_SERIALIZATION_NVP(m_alpha)
-        & BOOST_SERIALIZATION_NVP(m_n_threads);
+        & BOOST_SERIALIZATION_NVP(m_n_threads)
+        & BOOST_SERIALIZATION_NVP(m_use_parallel_tempering)
+        & BOOST_SERIALIZATION_NVP(m_pt_temperature_ratio)
+        & BOOST_SERIALIZATION_NVP(m_pt_swap_interval)
+        & BOOST_SERIALIZATION_NVP(m_pt_swaps_attempted)
+        & BOOST_SERIALIZATION_NVP(m_pt_swaps_accepted);
     }
     ///////////////////////////////////////////////////////////////////////
 
@@ -110,6 +122,23 @@ public:
     /** @brief Retrieves the current temperature. This function is used for simulated annealing */
     G_API_GENEVA double getT() const;
 
+    /** @brief Enables or disables the parallel tempering mode */
+    G_API_GENEVA void setUseParallelTempering(bool);
+    /** @brief Checks whether the parallel tempering mode is used */
+    G_API_GENEVA bool getUseParallelTempering() const;
+    /** @brief Sets the ratio between the temperatures of neighboring chains in parallel tempering mode */
+    G_API_GENEVA void setPTTemperatureRatio(double);
+    /** @brief Retrieves the ratio between the temperatures of neighboring chains in parallel tempering mode */
+    G_API_GENEVA double getPTTemperatureRatio() const;
+    /** @brief Sets the number of iterations between swap attempts in parallel tempering mode */
+    G_API_GENEVA void setPTSwapInterval(std::uint32_t);
+    /** @brief Retrieves the number of iterations between swap attempts in parallel tempering mode */
+    G_API_GENEVA std::uint32_t getPTSwapInterval() const;
+    /** @brief Retrieves the current temperature of a given chain in parallel tempering mode */
+    G_API_GENEVA double getChainTemperature(std::size_t) const;
+    /** @brief Retrieves the share of accepted swaps between chains in parallel tempering mode */
+    G_API_GENEVA double getPTSwapAcceptanceRate() const;
+
 protected:
     /***************************************************************************/
     // Virtual or overridden protected functions
@@ -156,6 +185,9 @@ protected:
     /** @brief Fixes the population after a job submission */
     G_API_GENEVA void fixAfterJobSubmission();
 
+    /** @brief Creates children from parents; assigns children to chains in parallel tempering mode */
+    G_API_GENEVA void recombine() override;
+
 private:
     /***************************************************************************/
     // Virtual or overridden private functions
@@ -190,9 +222,15 @@ private:
 
     /** @brief Performs a simulated annealing style sorting and selection */
     void sortSAMode();
+    /** @brief Performs the selection inside of each chain and the swaps between chains in parallel tempering mode */
+    void sortPTMode();
+    /** @brief Attempts to swap the states of neighboring chains in parallel tempering mode */
+    void swapChains();
 
     /** @brief Calculates the simulated annealing probability for a child to replace a parent */
     double saProb(const double &qParent, const double &qChild);
+    /** @brief Calculates the probability for a child to replace a parent at a given temperature */
+    double saProb(const double &qParent, const double &qChild, const double &t);
 
     /** @brief Updates the temperature. This function is used for simulated annealing. */
     void updateTemperature();
@@ -206,6 +244,12 @@ private:
 
     std::uint16_t m_n_threads = Gem::Common::DEFAULTNHARDWARETHREADS; ///< The number of threads
 
+    bool m_use_parallel_tempering = SA_PARALLELTEMPERING; ///< Whether parents act as chains at different temperatures
+    double m_pt_temperature_ratio = SA_PTTEMPERATURERATIO; ///< The ratio between the temperatures of neighboring chains
+    std::uint32_t m_pt_swap_interval = SA_PTSWAPINTERVAL; ///< The number of iterations between swap attempts
+    std::uint64_t m_pt_swaps_attempted = 0; ///< The number of swaps between chains attempted so far
+    std::uint64_t m_pt_swaps_accepted = 0; ///< The number of swaps between chains accepted so far
+
     std::shared_ptr<Gem::Common::GThreadPool> m_tp_ptr; ///< Temporarily holds a thread pool
 };
 
@@ -40,6 +40,8 @@
 #include "common/GGlobalDefines.hpp"
 
 // Standard headers go here
+#include <vector>
+#include <algorithm>
 
 // Boost headers go here
 
@@ -92,6 +94,8 @@ class GSwarmAlgorithm
 		 & BOOST_SERIALIZATION_NVP(m_update_rule)
 		 & BOOST_SERIALIZATION_NVP(m_random_fill_up)
 		 & BOOST_SERIALIZATION_NVP(m_repulsion_threshold)
+		 & BOOST_SERIALIZATION_NVP(m_use_async_updates)
+		 & BOOST_SERIALIZATION_NVP(m_async_batch_size)
 		 & BOOST_SERIALIZATION_NVP(m_dbl_lower_parameter_boundaries_cnt)
 		 & BOOST_SERIALIZATION_NVP(m_dbl_upper_parameter_boundaries_cnt)
 		 & BOOST_SERIALIZATION_NVP(m_dbl_vel_max_cnt)
@@ -154,6 +158,16 @@ public:
 	 /** @brief Allows to retrieve the number of stalls as of which the algorithm switches to repulsive mode */
 	 G_API_GENEVA std::uint32_t getRepulsionThreshold() const;
 
+	 /** @brief Allows to switch asynchronous position updates on or off */
+	 G_API_GENEVA void setUseAsyncUpdates(bool);
+	 /** @brief Checks whether asynchronous position updates are used */
+	 G_API_GENEVA bool getUseAsyncUpdates() const;
+
+	 /** @brief Sets the number of particles evaluated together in asynchronous mode */
+	 G_API_GENEVA void setAsyncBatchSize(std::size_t);
+	 /** @brief Retrieves the number of particles evaluated together in asynchronous mode */
+	 G_API_GENEVA std::size_t getAsyncBatchSize() const;
+
 	 /** @brief All individuals automatically added to a neighborhood will have equal value */
 	 G_API_GENEVA void setNeighborhoodsEqualFillUp();
 	 /** @brief All individuals automatically added to a neighborhood will have a random value */
@@ -227,6 +241,8 @@ protected:
 	 virtual G_API_GENEVA std::tuple<double, double> findBests() BASE;
 	 /** @brief Triggers an update of all individual's positions */
 	 virtual G_API_GENEVA void updatePositions() BASE;
+	 /** @brief Moves and evaluates particles in batches, using the latest bests for each batch */
+	 virtual G_API_GENEVA void runAsyncUpdates() BASE;
 
 	 /** @brief Fixes an incomplete population */
 	 virtual G_API_GENEVA void adjustNeighborhoods() BASE;
@@ -254,14 +270,12 @@ protected:
 	 G_API_GENEVA void updateIndividualPositions(
 		 const std::size_t&
 		 , std::shared_ptr<GParameterSet>
-		 , std::shared_ptr<GParameterSet>
-		 , std::shared_ptr<GParameterSet>
-		 , std::shared_ptr<GParameterSet>
+		 , const std::size_t&
 		 , std::tuple<double, double, double, double>
 	 );
 
-	 /** @brief Adjusts the velocity vector so that its values don't exceed the allowed value range */
-	 G_API_GENEVA void pruneVelocity(std::vector<double>&);
+	 /** @brief Extracts the parameter values of the neighborhood and global bests */
+	 G_API_GENEVA void updateBestValues();
 
 	 /** Updates the personal best of an individual */
 	 G_API_GENEVA void updatePersonalBest(std::shared_ptr<GParameterSet>);
@@ -275,7 +289,11 @@ protected:
 	 std::shared_ptr<GParameterSet> m_global_best_ptr; ///< The globally best individual
 
 	 std::vector<std::shared_ptr<GParameterSet>> m_neighborhood_bests_cnt = std::vector<std::shared_ptr<GParameterSet>>(m_n_neighborhoods); ///< The collection of best individuals from each neighborhood
-	 std::vector<std::shared_ptr<GParameterSet>> m_velocities_cnt = std::vector<std::shared_ptr<GParameterSet>>(); ///< Holds velocities, as calculated in the previous iteration
+	 std::vector<double> m_velocities_cnt = std::vector<double>(); ///< Holds velocities, as calculated in the previous iteration, one row of parameters per particle
+	 std::vector<double> m_dbl_neighborhood_best_values_cnt = std::vector<double>(); ///< Holds the parameter values of the neighborhood bests, one row per neighborhood
+	 std::vector<double> m_dbl_global_best_values_cnt = std::vector<double>(); ///< Holds the parameter values of the globally best individual
+	 std::vector<double> m_dbl_ind_values_cnt = std::vector<double>(); ///< Scratch space for the parameter values of the particle being moved
+	 std::vector<double> m_dbl_personal_best_values_cnt = std::vector<double>(); ///< Scratch space for the parameter values of a particle's personal best
 
 	 double m_c_personal = DEFAULTCPERSONAL; ///< A factor for multiplication of personal best distances
 	 double m_c_neighborhood = DEFAULTCNEIGHBORHOOD; ///< A factor for multiplication of neighborhood best distances
@@ -287,6 +305,9 @@ protected:
 
 	 std::uint32_t m_repulsion_threshold = DEFREPULSIONTHRESHOLD; ///< The number of stalls until the swarm algorithm switches to repulsion instead of attraction
 
+	 bool m_use_async_updates = DEFAULTSWARMASYNCUPDATES; ///< Whether particles are moved using the bests of previously returned batches of the same iteration
+	 std::size_t m_async_batch_size = DEFAULTSWARMASYNCBATCHSIZE; ///< The number of particles submitted together in asynchronous mode
+
 	 std::vector<double> m_dbl_lower_parameter_boundaries_cnt = std::vector<double>(); ///< Holds lower boundaries of double parameters
 	 std::vector<double> m_dbl_upper_parameter_boundaries_cnt = std::vector<double>(); ///< Holds upper boundaries of double parameters
 	 std::vector<double> m_dbl_vel_max_cnt = std::vector<double>(); ///< Holds the maximum allowed values of double-type velocities
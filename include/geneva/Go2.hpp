@@ -42,6 +42,8 @@
 // Standard header files go here
 #include <functional>
 #include <mutex>
+#include <exception>
+#include <random>
 
 // Boost header files go here
 #include <boost/algorithm/string.hpp>
@@ -51,6 +53,7 @@
 #include "common/GFactoryT.hpp"
 #include "common/GExceptions.hpp"
 #include "common/GParserBuilder.hpp"
+#include "common/GThreadGroup.hpp"
 #include "hap/GRandomFactory.hpp"
 #include "hap/GRandomT.hpp"
 #include "courtier/GCourtierHelperFunctions.hpp"
@@ -87,6 +90,10 @@ const std::uint32_t GO2_DEF_OFFSET=0;
 const std::string GO2_DEF_OPTALGS{""}; // NOLINT
 const std::string GO2_DEF_NOCONSUMER{"none"}; // NOLINT
 const bool GO2_DEF_COPYBESTINDIVIDUALSONLY=true;
+const std::size_t GO2_DEF_NISLANDS=1;
+const std::uint32_t GO2_DEF_MIGRATIONINTERVAL=10;
+const std::size_t GO2_DEF_NMIGRANTS=1;
+const migrationTopology GO2_DEF_MIGRATIONTOPOLOGY=migrationTopology::MIGRATION_RING;
 
 /******************************************************************************/
 /** @brief Set a number of parameters of the random number factory */
@@ -145,6 +152,23 @@ public:
 	 /** @brief Retrieves the currently registered number of algorithms */
 	 G_API_GENEVA std::size_t getNAlgorithms() const;
 
+	 /** @brief Sets the number of concurrently running islands per algorithm (1 disables the island mode) */
+	 G_API_GENEVA void setNIslands(std::size_t);
+	 /** @brief Retrieves the number of concurrently running islands per algorithm */
+	 G_API_GENEVA std::size_t getNIslands() const;
+	 /** @brief Sets the number of iterations between two migrations (0 disables migration) */
+	 G_API_GENEVA void setMigrationInterval(std::uint32_t);
+	 /** @brief Retrieves the number of iterations between two migrations */
+	 G_API_GENEVA std::uint32_t getMigrationInterval() const;
+	 /** @brief Sets the number of individuals sent by an island in each migration */
+	 G_API_GENEVA void setNMigrants(std::size_t);
+	 /** @brief Retrieves the number of individuals sent by an island in each migration */
+	 G_API_GENEVA std::size_t getNMigrants() const;
+	 /** @brief Sets the topology along which individuals migrate */
+	 G_API_GENEVA void setMigrationTopology(migrationTopology);
+	 /** @brief Retrieves the topology along which individuals migrate */
+	 G_API_GENEVA migrationTopology getMigrationTopology() const;
+
 	 /** @brief Allows to register a content creator */
 	 G_API_GENEVA void registerContentCreator(
 		 std::shared_ptr<Gem::Common::GFactoryT<GParameterSet>>
@@ -225,6 +249,11 @@ private:
 	 /** @brief Perform the actual optimization cycle */
 	 G_API_GENEVA Go2 const * const optimize_(std::uint32_t) final;
 
+	 /** @brief Runs concurrent copies of an algorithm, exchanging their best individuals periodically */
+	 void optimizeIslands_(std::shared_ptr<GOABase>);
+	 /** @brief Sends the best individuals of an island to its neighbours and integrates received individuals */
+	 void migrate_(std::size_t, GOABase &);
+
 	 /***************************************************************************/
 	 // Initialization code for the Geneva library
 	 GenevaInitializer m_gi;
@@ -249,6 +278,15 @@ private:
 	 bool m_sorted = false; ///< Indicates whether local individuals have been sorted
 	 std::uint32_t m_iterations_consumed = 0; ///< The number of successive iterations performed by this object so far
 	 bool m_copyBestIndividualsOnly = GO2_DEF_COPYBESTINDIVIDUALSONLY; ///< Indicates whether only the best individuals of an optimization run are copied to the next algorithm
+
+	 //---------------------------------------------------------------------------
+	 // Parameters of the island mode
+	 std::size_t m_n_islands = GO2_DEF_NISLANDS; ///< The number of concurrently running copies of each algorithm
+	 std::uint32_t m_migration_interval = GO2_DEF_MIGRATIONINTERVAL; ///< The number of iterations between two migrations
+	 std::size_t m_n_migrants = GO2_DEF_NMIGRANTS; ///< The number of individuals sent by an island in each migration
+	 migrationTopology m_migration_topology = GO2_DEF_MIGRATIONTOPOLOGY; ///< The paths along which individuals migrate
+	 std::vector<std::vector<std::shared_ptr<GParameterSet>>> m_island_mailboxes_cnt; ///< Individuals waiting to enter each island
+	 std::mutex m_island_mailboxes_mutex; ///< Protects access to the mailboxes
 	 //---------------------------------------------------------------------------
 	 // Name and path of a checkpoint file, if supplied by the user
 	 std::string m_cp_file = "empty";
@@ -68,8 +68,21 @@ const double DEF_BINORM_DISTANCE=0.5;
 enum class RANDFLAVOURS : Gem::Common::ENUMBASETYPE {
 	RANDOMPROXY = 0 // random numbers are taken from the factory
 	, RANDOMLOCAL = 1 // random numbers are produced locally, using a seed taken from the seed manager or provided to the constructor
+	, RANDOMCOUNTER = 2 // random numbers are produced locally by a counter-based generator, using a unique stream id per object
 };
 
+/******************************************************************************/
+/**
+ * The flavour of the random number generators held by individuals and
+ * optimization algorithms. Define GENEVA_HAP_USE_COUNTER_BASED_RANDOM to
+ * replace the random number factory by counter-based generators.
+ */
+#ifdef GENEVA_HAP_USE_COUNTER_BASED_RANDOM
+const RANDFLAVOURS DEFAULTRANDFLAVOUR = RANDFLAVOURS::RANDOMCOUNTER;
+#else
+const RANDFLAVOURS DEFAULTRANDFLAVOUR = RANDFLAVOURS::RANDOMPROXY;
+#endif /* GENEVA_HAP_USE_COUNTER_BASED_RANDOM */
+
 /******************************************************************************/
 
 /** @brief Puts a Gem::Hap::RANDFLAVOURS into a stream. Needed also for boost::lexical_cast<> */
@@ -0,0 +1,280 @@
+/********************************************************************************
+ *
+ * This file is part of the Geneva library collection. The following license
+ * applies to this file:
+ *
+ * ------------------------------------------------------------------------------
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * ------------------------------------------------------------------------------
+ *
+ * Note that other files in the Geneva library collection may use a different
+ * license. Please see the licensing information in each file.
+ *
+ ********************************************************************************
+ *
+ * Geneva was started by Dr. Rüdiger Berlich and was later maintained together
+ * with Dr. Ariel Garcia under the auspices of Gemfony scientific. For further
+ * information on Gemfony scientific, see http://www.gemfomy.eu .
+ *
+ * The majority of files in Geneva was released under the Apache license v2.0
+ * in February 2020.
+ *
+ * See the NOTICE file in the top-level directory of the Geneva library
+ * collection for a list of contributors and copyright information.
+ *
+ ********************************************************************************/
+
+#pragma once
+
+// Global checks, defines and includes needed for all of Geneva
+#include "common/GGlobalDefines.hpp"
+
+// Standard headers go here
+#include <cstdint>
+#include <array>
+#include <limits>
+#include <iterator>
+#include <cstddef>
+
+// Boost headers go here
+
+// Geneva headers go here
+
+namespace Gem {
+namespace Hap {
+
+/******************************************************************************/
+////////////////////////////////////////////////////////////////////////////////
+/******************************************************************************/
+/**
+ * The Philox4x32-10 counter-based random number generator (Salmon et al.,
+ * "Parallel Random Numbers: As Easy as 1, 2, 3", SC'11). Random numbers are
+ * obtained by encrypting a 128 bit counter with a 64 bit key, so that the
+ * entire state of a stream consists of its key, its stream id and a block
+ * counter. Different streams are obtained simply by using different keys or
+ * stream ids, without any seeding cost, and arbitrary positions of a stream
+ * can be reached in constant time. The class satisfies the requirements of a
+ * C++11 uniform random bit generator, so it may be used with the standard
+ * distributions.
+ */
+class GPhilox4x32 {
+public:
+	 /** @brief The type of the random numbers emitted by this engine */
+	 using result_type = std::uint32_t;
+	 /** @brief The type of a single block of random numbers */
+	 using block_type = std::array<std::uint32_t, 4>;
+	 /** @brief The type of the key */
+	 using key_type = std::array<std::uint32_t, 2>;
+
+	 /***************************************************************************/
+	 /**
+	  * Initialization with the key and the id of the stream. Both together
+	  * uniquely identify a sequence of random numbers.
+	  *
+	  * @param key The key used to encrypt the counter
+	  * @param stream The id of the stream, stored in the upper half of the counter
+	  */
+	 GPhilox4x32(std::uint64_t key, std::uint64_t stream) noexcept
+		 : m_key{{static_cast<std::uint32_t>(key), static_cast<std::uint32_t>(key >> 32)}}
+		 , m_stream(stream)
+	 { /* nothing */ }
+
+	 /***************************************************************************/
+	 // Defaulted constructors, destructor and assignment operators
+
+	 GPhilox4x32() = default;
+	 GPhilox4x32(GPhilox4x32 const&) = default;
+	 GPhilox4x32(GPhilox4x32 &&) = default;
+	 ~GPhilox4x32() = default;
+
+	 GPhilox4x32& operator=(GPhilox4x32 const&) = default;
+	 GPhilox4x32& operator=(GPhilox4x32 &&) = default;
+
+	 /***************************************************************************/
+	 /**
+	  * The smallest value emitted by this engine
+	  */
+	 static constexpr result_type (min)() {
+		 return (std::numeric_limits<result_type>::min)();
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * The largest value emitted by this engine
+	  */
+	 static constexpr result_type (max)() {
+		 return (std::numeric_limits<result_type>::max)();
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Emits the next random number of the stream
+	  */
+	 result_type operator()() {
+		 if(BLOCKSIZE == m_pos) {
+			 m_buffer = this->block(m_block++);
+			 m_pos = 0;
+		 }
+		 return m_buffer[m_pos++];
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Fills a range with the next random numbers of the stream. Apart from the
+	  * start and the end of the range, entire blocks are written at once. The
+	  * result is identical to repeated calls to operator().
+	  *
+	  * @param first The start of the range to be filled
+	  * @param last The end of the range to be filled
+	  */
+	 template <typename out_iterator>
+	 void generate(out_iterator first, out_iterator last) {
+		 while(first != last && m_pos < BLOCKSIZE) {
+			 *first++ = m_buffer[m_pos++];
+		 }
+
+		 while(std::distance(first, last) >= static_cast<std::ptrdiff_t>(BLOCKSIZE)) {
+			 block_type b = this->block(m_block++);
+			 for(std::uint32_t i=0; i<BLOCKSIZE; i++) {
+				 *first++ = b[i];
+			 }
+		 }
+
+		 while(first != last) {
+			 *first++ = (*this)();
+		 }
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Skips a number of random numbers in constant time
+	  *
+	  * @param n The number of random numbers to be skipped
+	  */
+	 void discard(std::uint64_t n) {
+		 while(n > 0 && m_pos < BLOCKSIZE) {
+			 m_pos++;
+			 n--;
+		 }
+		 if(0 == n) return;
+
+		 m_block += n / BLOCKSIZE;
+		 std::uint32_t remainder = static_cast<std::uint32_t>(n % BLOCKSIZE);
+		 if(remainder > 0) {
+			 m_buffer = this->block(m_block++);
+			 m_pos = remainder;
+		 }
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Calculates a block of four random numbers at an arbitrary position of this
+	  * stream, without changing the state of the engine
+	  *
+	  * @param blockIndex The position of the block in the stream
+	  * @return The block of random numbers at this position
+	  */
+	 block_type block(std::uint64_t blockIndex) const {
+		 return philox(
+			 block_type{{
+				 static_cast<std::uint32_t>(blockIndex)
+				 , static_cast<std::uint32_t>(blockIndex >> 32)
+				 , static_cast<std::uint32_t>(m_stream)
+				 , static_cast<std::uint32_t>(m_stream >> 32)
+			 }}
+			 , m_key
+		 );
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * The Philox4x32 bijection with 10 rounds
+	  *
+	  * @param counter The counter to be encrypted
+	  * @param key The key used for the encryption
+	  * @return The encrypted counter
+	  */
+	 static block_type philox(block_type counter, key_type key) {
+		 for(std::size_t r=0; r<NROUNDS; r++) {
+			 if(r > 0) {
+				 key[0] += W0;
+				 key[1] += W1;
+			 }
+
+			 std::uint64_t p0 = static_cast<std::uint64_t>(M0) * counter[0];
+			 std::uint64_t p1 = static_cast<std::uint64_t>(M1) * counter[2];
+
+			 counter = block_type{{
+				 static_cast<std::uint32_t>(p1 >> 32) ^ counter[1] ^ key[0]
+				 , static_cast<std::uint32_t>(p1)
+				 , static_cast<std::uint32_t>(p0 >> 32) ^ counter[3] ^ key[1]
+				 , static_cast<std::uint32_t>(p0)
+			 }};
+		 }
+
+		 return counter;
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Retrieves the id of the stream
+	  */
+	 std::uint64_t getStream() const {
+		 return m_stream;
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Checks for equality with another engine, i.e. whether both will emit
+	  * the same sequence of random numbers
+	  */
+	 bool operator==(GPhilox4x32 const& cp) const {
+		 return
+			 m_key == cp.m_key
+			 && m_stream == cp.m_stream
+			 && m_block == cp.m_block
+			 && m_pos == cp.m_pos
+			 && (BLOCKSIZE == m_pos || m_buffer == cp.m_buffer);
+	 }
+
+	 /***************************************************************************/
+	 /**
+	  * Checks for inequality with another engine
+	  */
+	 bool operator!=(GPhilox4x32 const& cp) const {
+		 return not operator==(cp);
+	 }
+
+private:
+	 /***************************************************************************/
+
+	 static constexpr std::uint32_t BLOCKSIZE = 4; ///< The number of random numbers per block
+	 static constexpr std::size_t NROUNDS = 10; ///< The number of Philox rounds
+	 static constexpr std::uint32_t M0 = 0xD2511F53; ///< Multiplier for the first word pair
+	 static constexpr std::uint32_t M1 = 0xCD9E8D57; ///< Multiplier for the second word pair
+	 static constexpr std::uint32_t W0 = 0x9E3779B9; ///< Weyl sequence increment of the first key word
+	 static constexpr std::uint32_t W1 = 0xBB67AE85; ///< Weyl sequence increment of the second key word
+
+	 key_type m_key{{0, 0}}; ///< The key of this stream
+	 std::uint64_t m_stream = 0; ///< The id of this stream
+	 std::uint64_t m_block = 0; ///< The index of the next block to be calculated
+	 block_type m_buffer{{0, 0, 0, 0}}; ///< The current block of random numbers
+	 std::uint32_t m_pos = BLOCKSIZE; ///< The position of the next random number in m_buffer
+};
+
+/******************************************************************************/
+////////////////////////////////////////////////////////////////////////////////
+/******************************************************************************/
+
+} /* namespace Hap */
+} /* namespace Gem */
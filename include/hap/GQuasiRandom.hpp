@@ -0,0 +1,151 @@
+/********************************************************************************
+ *
+ * This file is part of the Geneva library collection. The following license
+ * applies to this file:
+ *
+ * ------------------------------------------------------------------------------
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * ------------------------------------------------------------------------------
+ *
+ * Note that other files in the Geneva library collection may use a different
+ * license. Please see the licensing information in each file.
+ *
+ ********************************************************************************
+ *
+ * Geneva was started by Dr. Rüdiger Berlich and was later maintained together
+ * with Dr. Ariel Garcia under the auspices of Gemfony scientific. For further
+ * information on Gemfony scientific, see http://www.gemfomy.eu .
+ *
+ * The majority of files in Geneva was released under the Apache license v2.0
+ * in February 2020.
+ *
+ * See the NOTICE file in the top-level directory of the Geneva library
+ * collection for a list of contributors and copyright information.
+ *
+ ********************************************************************************/
+
+#pragma once
+
+// Global checks, defines and includes needed for all of Geneva
+#include "common/GGlobalDefines.hpp"
+
+// Standard headers go here
+#include <cstdint>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <cmath>
+
+// Boost headers go here
+#include <boost/cast.hpp>
+
+// Geneva headers go here
+#include "common/GBoundedBufferT.hpp"
+#include "common/GExceptions.hpp"
+#include "common/GErrorStreamer.hpp"
+#include "hap/GRandomDefines.hpp"
+
+namespace Gem {
+namespace Hap {
+
+/******************************************************************************/
+
+const std::size_t MAXSOBOLDIMENSIONS = 21; ///< The number of dimensions for which Sobol direction numbers are available
+const std::size_t SOBOLNBITS = 32; ///< The number of bits of each Sobol coordinate
+
+/******************************************************************************/
+/**
+ * The interface of low-discrepancy ("quasi-random") sequences. Points are
+ * addressed by their index, so that any part of a sequence may be computed
+ * independently of the preceding points (e.g. on different machines). All
+ * coordinates lie in [0,1).
+ */
+class GQuasiRandomSequence
+{
+public:
+	/** @brief The destructor */
+	virtual G_API_HAP ~GQuasiRandomSequence() BASE = default;
+
+	/** @brief Retrieves coordinate dim of the point with the given index */
+	virtual G_API_HAP double value(std::uint64_t, std::size_t) const BASE = 0;
+	/** @brief Retrieves the number of dimensions of the sequence */
+	virtual G_API_HAP std::size_t getNDimensions() const BASE = 0;
+};
+
+/******************************************************************************/
+/**
+ * The Halton sequence, i.e. the radical inverse of the point index, using the
+ * n-th prime number as the base of dimension n. When scrambling is requested,
+ * the digits of each dimension are subjected to a random permutation (keeping
+ * the digit 0 fixed), determined by a seed. The stratification of the
+ * unscrambled sequence is retained.
+ */
+class GHaltonSequence
+	: public GQuasiRandomSequence
+{
+public:
+	/** @brief Initialization with the number of dimensions and optional scrambling */
+	G_API_HAP explicit GHaltonSequence(std::size_t, bool = false, seed_type = DEFAULTSTARTSEED);
+	/** @brief The destructor */
+	G_API_HAP ~GHaltonSequence() override = default;
+
+	/** @brief Retrieves coordinate dim of the point with the given index */
+	G_API_HAP double value(std::uint64_t, std::size_t) const override;
+	/** @brief Retrieves the number of dimensions of the sequence */
+	G_API_HAP std::size_t getNDimensions() const override;
+
+	/** @brief Retrieves the base used for a given dimension */
+	G_API_HAP std::uint64_t getBase(std::size_t) const;
+
+private:
+	GHaltonSequence() = delete; ///< Intentionally undefined
+
+	std::vector<std::uint64_t> m_bases; ///< One prime base per dimension
+	std::vector<std::vector<std::uint64_t>> m_permutations; ///< Digit permutations for each dimension
+};
+
+/******************************************************************************/
+/**
+ * The Sobol sequence in base 2, using the direction numbers of Joe and Kuo
+ * ("new-joe-kuo-6.21201") for up to MAXSOBOLDIMENSIONS dimensions.
+ * Points are produced in Gray code order, like in sequential generators, but
+ * are computed directly from their index. When scrambling is requested, each
+ * dimension is subjected to a random digital shift determined by a seed, which
+ * retains the stratification of the unscrambled sequence.
+ */
+class GSobolSequence
+	: public GQuasiRandomSequence
+{
+public:
+	/** @brief Initialization with the number of dimensions and optional scrambling */
+	G_API_HAP explicit GSobolSequence(std::size_t, bool = false, seed_type = DEFAULTSTARTSEED);
+	/** @brief The destructor */
+	G_API_HAP ~GSobolSequence() override = default;
+
+	/** @brief Retrieves coordinate dim of the point with the given index */
+	G_API_HAP double value(std::uint64_t, std::size_t) const override;
+	/** @brief Retrieves the number of dimensions of the sequence */
+	G_API_HAP std::size_t getNDimensions() const override;
+
+private:
+	GSobolSequence() = delete; ///< Intentionally undefined
+
+	std::size_t m_nDimensions; ///< The number of dimensions of this sequence
+	std::vector<std::vector<std::uint32_t>> m_directions; ///< SOBOLNBITS direction numbers per dimension
+	std::vector<std::uint32_t> m_shifts; ///< Digital shifts for each dimension (0 if unscrambled)
+};
+
+/******************************************************************************/
+
+} /* namespace Hap */
+} /* namespace Gem */
@@ -87,6 +87,8 @@ public:
 	 virtual G_API_HAP ~GRandomBase();
 	 /** @brief Retrieves a "raw" random item item */
 	 G_API_HAP GRandomBase::result_type operator()();
+	 /** @brief Fills an array with "raw" random items */
+	 G_API_HAP void fill(GRandomBase::result_type *first, std::size_t n);
 
 	/***************************************************************************/
 	// Prevent copying
@@ -121,6 +123,8 @@ private:
 	 /***************************************************************************/
 	 /** @brief Uniformly distributed integer numbers in the range min/max */
 	 virtual G_API_HAP result_type int_random() = 0;
+	 /** @brief Fills an array with uniformly distributed integer numbers in the range min/max */
+	 virtual G_API_HAP void int_random_n(result_type *first, std::size_t n);
 };
 
 /******************************************************************************/
@@ -94,6 +94,12 @@ using lagged_fibonacci = std::subtract_with_carry_engine<uint_fast64_t, 48, 5, 1
 	const std::size_t   DEFAULTSEEDVECTORSIZE = 2000; ///< The size of the seeding vector
 #endif /* GENEVA_HAP_RANDOM_FACTORY_SEED_VECTOR_SIZE */
 
+#ifdef GENEVA_HAP_BULK_CHUNK_SIZE
+	const std::size_t   DEFAULTBULKCHUNKSIZE = GENEVA_HAP_BULK_CHUNK_SIZE; ///< The number of variates produced in one go by bulk functions
+#else
+	const std::size_t   DEFAULTBULKCHUNKSIZE = 256; ///< The number of variates produced in one go by bulk functions
+#endif /* GENEVA_HAP_BULK_CHUNK_SIZE */
+
 /******************************************************************************/
 /**
  * The number of threads that simultaneously produce [0,1[ random numbers
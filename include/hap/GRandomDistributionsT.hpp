@@ -42,6 +42,11 @@
 // Standard headers go here
 #include <random>
 #include <limits>
+#include <array>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <type_traits>
 
 // Boost headers go here
 
@@ -338,6 +343,174 @@ bool operator!=(
 	return lhs.param() != rhs.param();
 };
 
+/******************************************************************************/
+////////////////////////////////////////////////////////////////////////////////
+/******************************************************************************/
+/**
+ * Fills an array with uniformly distributed random numbers in the range [0,1[.
+ * Raw random numbers are retrieved from the generator in one go, and are
+ * then converted in a loop without branches, which the compiler may vectorize.
+ * Double precision numbers use 53 random bits (i.e. two raw numbers), single
+ * precision numbers use 24 random bits.
+ *
+ * @param gr The generator providing raw random numbers
+ * @param first The start of the array to be filled
+ * @param n The number of random numbers to be produced (at most DEFAULTBULKCHUNKSIZE)
+ */
+template <
+	typename fp_type
+	, typename std::enable_if<std::is_floating_point<fp_type>::value>::type* dummy = nullptr
+>
+void fill_canonical_chunk(
+	GRandomBase& gr
+	, fp_type *first
+	, std::size_t n
+) {
+	static_assert(
+		0xFFFFFFFFu == (GRandomBase::max)() && 0 == (GRandomBase::min)()
+		, "fill_canonical_chunk() assumes raw random numbers with 32 random bits"
+	);
+
+	std::array<GRandomBase::result_type, 2*DEFAULTBULKCHUNKSIZE> raw;
+
+	if(sizeof(fp_type) > sizeof(std::uint32_t)) {
+		gr.fill(raw.data(), 2*n);
+		for(std::size_t i=0; i<n; i++) {
+			// Compare genrand_res53() of the original Mersenne Twister implementation
+			first[i] = fp_type(
+				(double(raw[2*i] >> 5)*67108864. + double(raw[2*i+1] >> 6)) * (1./9007199254740992.)
+			);
+		}
+	} else {
+		gr.fill(raw.data(), n);
+		for(std::size_t i=0; i<n; i++) {
+			first[i] = fp_type(raw[i] >> 8) * fp_type(1./16777216.);
+		}
+	}
+}
+
+/******************************************************************************/
+/**
+ * Fills an array with uniformly distributed random numbers in the range [min,max[.
+ * This is equivalent to, but much faster than repeated calls to
+ * std::uniform_real_distribution<fp_type>(min,max) on a GRandomBase object.
+ *
+ * @param gr The generator providing raw random numbers
+ * @param first The start of the array to be filled
+ * @param n The number of random numbers to be produced
+ * @param min The lower boundary of the distribution
+ * @param max The upper boundary of the distribution
+ */
+template <
+	typename fp_type
+	, typename std::enable_if<std::is_floating_point<fp_type>::value>::type* dummy = nullptr
+>
+void fill_uniform_real(
+	GRandomBase& gr
+	, fp_type *first
+	, std::size_t n
+	, fp_type min = fp_type(0.)
+	, fp_type max = fp_type(1.)
+) {
+	const fp_type width = max - min;
+	for(std::size_t done=0; done<n; done += DEFAULTBULKCHUNKSIZE) {
+		std::size_t nChunk = (std::min)(n - done, DEFAULTBULKCHUNKSIZE);
+		fp_type *chunk = first + done;
+
+		fill_canonical_chunk(gr, chunk, nChunk);
+		for(std::size_t i=0; i<nChunk; i++) {
+			chunk[i] = min + width*chunk[i];
+		}
+	}
+}
+
+/******************************************************************************/
+/**
+ * Fills a vector with uniformly distributed random numbers in the range [min,max[.
+ * The size of the vector determines the number of random numbers.
+ */
+template <
+	typename fp_type
+	, typename std::enable_if<std::is_floating_point<fp_type>::value>::type* dummy = nullptr
+>
+void fill_uniform_real(
+	GRandomBase& gr
+	, std::vector<fp_type>& target
+	, fp_type min = fp_type(0.)
+	, fp_type max = fp_type(1.)
+) {
+	fill_uniform_real(gr, target.data(), target.size(), min, max);
+}
+
+/******************************************************************************/
+/**
+ * Fills an array with normally distributed random numbers. Variates are
+ * produced in pairs with the Box-Muller transform, which -- unlike the polar
+ * method used by std::normal_distribution -- does not involve a rejection step
+ * and may thus be applied to an entire chunk of uniform random numbers at once.
+ *
+ * @param gr The generator providing raw random numbers
+ * @param first The start of the array to be filled
+ * @param n The number of random numbers to be produced
+ * @param mean The mean of the distribution
+ * @param sigma The standard deviation of the distribution
+ */
+template <
+	typename fp_type
+	, typename std::enable_if<std::is_floating_point<fp_type>::value>::type* dummy = nullptr
+>
+void fill_normal(
+	GRandomBase& gr
+	, fp_type *first
+	, std::size_t n
+	, fp_type mean = fp_type(0.)
+	, fp_type sigma = fp_type(1.)
+) {
+	static_assert(
+		DEFAULTBULKCHUNKSIZE > 0 && 0 == DEFAULTBULKCHUNKSIZE%2
+		, "fill_normal() requires an even, positive DEFAULTBULKCHUNKSIZE"
+	);
+
+	const fp_type twopi = fp_type(2.*3.141592653589793238462643383279502884);
+
+	std::array<fp_type, DEFAULTBULKCHUNKSIZE> u;
+	std::array<fp_type, DEFAULTBULKCHUNKSIZE> result;
+
+	for(std::size_t done=0; done<n; done += DEFAULTBULKCHUNKSIZE) {
+		std::size_t nChunk = (std::min)(n - done, DEFAULTBULKCHUNKSIZE);
+		std::size_t nChunkPairs = (nChunk + 1)/2;
+
+		fill_canonical_chunk(gr, u.data(), 2*nChunkPairs);
+		for(std::size_t i=0; i<nChunkPairs; i++) {
+			// 1-u lies in ]0,1], so that the logarithm is always defined
+			fp_type r = sigma*std::sqrt(fp_type(-2.)*std::log(fp_type(1.) - u[i]));
+			fp_type phi = twopi*u[nChunkPairs + i];
+			result[2*i]   = mean + r*std::cos(phi);
+			result[2*i+1] = mean + r*std::sin(phi);
+		}
+
+		std::copy(result.begin(), result.begin() + nChunk, first + done);
+	}
+}
+
+/******************************************************************************/
+/**
+ * Fills a vector with normally distributed random numbers. The size of the
+ * vector determines the number of random numbers.
+ */
+template <
+	typename fp_type
+	, typename std::enable_if<std::is_floating_point<fp_type>::value>::type* dummy = nullptr
+>
+void fill_normal(
+	GRandomBase& gr
+	, std::vector<fp_type>& target
+	, fp_type mean = fp_type(0.)
+	, fp_type sigma = fp_type(1.)
+) {
+	fill_normal(gr, target.data(), target.size(), mean, sigma);
+}
+
 /******************************************************************************/
 
 } /* namespace Hap */
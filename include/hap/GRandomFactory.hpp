@@ -148,6 +148,21 @@ public:
 		 return m_r[m_current_pos++];
 	 }
 
+	 /***************************************************************************/
+	 /**
+	  * Copies up to n random numbers from the package to a target array
+	  *
+	  * @param first The start of the target array
+	  * @param n The maximum number of random numbers to be copied
+	  * @return The number of random numbers actually copied
+	  */
+	 std::size_t next_n(G_BASE_GENERATOR::result_type *first, std::size_t n) {
+		 std::size_t nCopied = (std::min)(n, DEFAULTARRAYSIZE - (std::min)(m_current_pos, DEFAULTARRAYSIZE));
+		 std::copy(m_r.begin() + m_current_pos, m_r.begin() + m_current_pos + nCopied, first);
+		 m_current_pos += nCopied;
+		 return nCopied;
+	 }
+
 private:
 	 /***************************************************************************/
 	 /**
@@ -49,12 +49,15 @@
 #include <sstream>
 #include <cassert>
 #include <thread>
+#include <atomic>
+#include <cstdint>
 
 // Boost headers go here
 
 // Geneva headers go here
 #include "hap/GRandomBase.hpp"
 #include "hap/GRandomDefines.hpp"
+#include "hap/GPhilox4x32.hpp"
 #include "common/GLogger.hpp"
 
 namespace Gem {
@@ -204,6 +207,22 @@ private:
 		return m_p->next();
 	}
 
+	/***************************************************************************/
+	/**
+	 * Copies entire stretches of random numbers from the current package,
+	 * retrieving new packages as needed
+	 */
+	void int_random_n(GRandomBase::result_type *first, std::size_t n) override {
+		std::size_t nCopied = 0;
+		while(nCopied < n) {
+			if (m_p->empty()) {
+				m_grf->returnUsedPackage(std::move(m_p));
+				getNewRandomContainer();
+			}
+			nCopied += m_p->next_n(first + nCopied, n - nCopied);
+		}
+	}
+
 	/***************************************************************************/
 	/**
 	 * (Re-)Initialization of p_. Checks that a valid GRandomFactory still
@@ -335,6 +354,136 @@ private:
 ////////////////////////////////////////////////////////////////////////////////
 /******************************************************************************/
 
+/** @brief Retrieves the process-wide key of counter-based random number streams */
+G_API_HAP std::uint64_t getCounterRandomKey();
+/** @brief Retrieves a new, unique id for a counter-based random number stream */
+G_API_HAP std::uint64_t getNewCounterRandomStream();
+
+/******************************************************************************/
+/**
+ * This specialization of the general GRandomT<> class produces random numbers
+ * locally with the counter-based Philox4x32 generator. Every object draws from
+ * its own stream, identified by a process-wide key and a unique stream id. As
+ * new streams only require an atomic increment, construction is cheap and no
+ * random numbers need to be passed between threads. The entire state amounts to
+ * a few dozen bytes, compared to a package of DEFAULTARRAYSIZE numbers held by
+ * the RANDOMPROXY flavour. A key and stream id may also be provided to the
+ * constructor, in which case the stream is reproducible.
+ */
+template<>
+class GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER>
+	: public Gem::Hap::GRandomBase
+{
+public:
+	/***************************************************************************/
+	/**
+	 * The standard constructor. Opens a new stream with the process-wide key.
+	 */
+	GRandomT() noexcept(false)
+		: Gem::Hap::GRandomBase()
+		, m_engine(getCounterRandomKey(), getNewCounterRandomStream())
+	{ /* nothing */ }
+
+	/***************************************************************************/
+	/**
+	 * Initialization with a key and stream id, resulting in a reproducible
+	 * sequence of random numbers
+	 *
+	 * @param key The key of the stream
+	 * @param stream The id of the stream
+	 */
+	GRandomT(std::uint64_t key, std::uint64_t stream) noexcept
+		: Gem::Hap::GRandomBase()
+		, m_engine(key, stream)
+	{ /* nothing */ }
+
+	/***************************************************************************/
+	/**
+	 * Copy construction does nothing, delegates to default constructor, so
+	 * that every object draws from its own stream
+	 */
+	GRandomT(GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER> const& cp) noexcept(false)
+		: GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER>()
+	{ /* nothing */ }
+
+	/***************************************************************************/
+	/**
+	 * Move construction does nothing, delegates to default constructor
+	 */
+	GRandomT(GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER> && cp) noexcept(false)
+		: GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER>()
+	{ /* nothing */ }
+
+	/***************************************************************************/
+	/**
+	 * The standard destructor
+	 */
+	~GRandomT() override = default;
+
+	/***************************************************************************/
+	/**
+	 * Copy-assignment does nothing
+	 */
+	GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER>& operator=(GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER> const& cp) noexcept
+	{
+		return *this;
+	}
+
+	/***************************************************************************/
+	/**
+	 * Move-assignment does nothing
+	 */
+	GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER>& operator=(GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER> && cp) noexcept
+	{
+		return *this;
+	}
+
+	/***************************************************************************/
+	/**
+	 * Skips a number of random numbers in constant time
+	 */
+	void discard(std::uint64_t n) {
+		m_engine.discard(n);
+	}
+
+	/***************************************************************************/
+	/**
+	 * Retrieves the id of the stream this object draws from
+	 */
+	std::uint64_t getStream() const {
+		return m_engine.getStream();
+	}
+
+private:
+	/***************************************************************************/
+	/**
+	 * This function produces uniform random numbers locally
+	 */
+	GRandomBase::result_type int_random() override {
+		return m_engine();
+	}
+
+	/***************************************************************************/
+	/**
+	 * Produces an entire array of random numbers, block by block
+	 */
+	void int_random_n(GRandomBase::result_type *first, std::size_t n) override {
+		m_engine.generate(first, first + n);
+	}
+
+	/***************************************************************************/
+	/** @brief The counter-based generator */
+	GPhilox4x32 m_engine;
+};
+
+/******************************************************************************/
+/** @brief Gives access to a counter-based random number generator private to the calling thread */
+G_API_HAP GRandomT<RANDFLAVOURS::RANDOMCOUNTER>& threadLocalRandom();
+
+/******************************************************************************/
+////////////////////////////////////////////////////////////////////////////////
+/******************************************************************************/
+
 } /* namespace Hap */
 } /* namespace Gem */
 
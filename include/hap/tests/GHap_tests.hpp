@@ -51,6 +51,7 @@
 #include <string>
 #include <vector>
 #include <algorithm>
+#include <cmath>
 
 // Boost header files go here
 #include <boost/test/unit_test.hpp>
@@ -61,6 +62,8 @@
 #include "common/GCommonEnums.hpp"
 #include "hap/GRandomT.hpp"
 #include "hap/GRandomDistributionsT.hpp"
+#include "hap/GQuasiRandom.hpp"
+#include "hap/GPhilox4x32.hpp"
 
 using namespace Gem::Hap;
 
@@ -203,6 +206,288 @@ public:
 		}
 
 		//------------------------------------------------------------------------------
+
+		{ // Check the first points of the Sobol sequence against reference values (Joe/Kuo direction numbers)
+			const double reference[8][3] = {
+				{0.,    0.,    0.}
+				, {0.5,   0.5,   0.5}
+				, {0.75,  0.25,  0.25}
+				, {0.25,  0.75,  0.75}
+				, {0.375, 0.375, 0.625}
+				, {0.875, 0.875, 0.125}
+				, {0.625, 0.125, 0.875}
+				, {0.125, 0.625, 0.375}
+			};
+
+			GSobolSequence sobol(3);
+			BOOST_CHECK(sobol.getNDimensions() == 3);
+			for(std::uint64_t i=0; i<8; i++) {
+				for(std::size_t d=0; d<3; d++) {
+					BOOST_CHECK_MESSAGE(
+						sobol.value(i, d) == reference[i][d]
+						, "Sobol point " << i << ", dimension " << d << ": " << sobol.value(i, d) << " instead of " << reference[i][d]
+					);
+				}
+			}
+
+			// All supported dimensions can be created
+			BOOST_CHECK_NO_THROW(GSobolSequence sobolMax(MAXSOBOLDIMENSIONS));
+		}
+
+		//------------------------------------------------------------------------------
+
+		{ // Check the first points of the Halton sequence against reference values
+			const double reference[6][2] = {
+				{0.,    0.}
+				, {0.5,   1./3.}
+				, {0.25,  2./3.}
+				, {0.75,  1./9.}
+				, {0.125, 4./9.}
+				, {0.625, 7./9.}
+			};
+
+			GHaltonSequence halton(4);
+			BOOST_CHECK(halton.getNDimensions() == 4);
+			BOOST_CHECK(halton.getBase(0) == 2 && halton.getBase(1) == 3 && halton.getBase(2) == 5 && halton.getBase(3) == 7);
+			for(std::uint64_t i=0; i<6; i++) {
+				for(std::size_t d=0; d<2; d++) {
+					BOOST_CHECK_MESSAGE(
+						std::fabs(halton.value(i, d) - reference[i][d]) < 1.e-12
+						, "Halton point " << i << ", dimension " << d << ": " << halton.value(i, d) << " instead of " << reference[i][d]
+					);
+				}
+			}
+		}
+
+		//------------------------------------------------------------------------------
+
+		{ // Check that scrambled sequences are reproducible and retain the stratification of the first points
+			GSobolSequence sobol1(4, true, 42), sobol2(4, true, 42);
+			GHaltonSequence halton1(4, true, 42), halton2(4, true, 42);
+
+			for(std::size_t d=0; d<4; d++) {
+				// The first 2^4 Sobol points hold one coordinate in each interval of size 1/16
+				std::vector<std::size_t> sobolHist(16, 0);
+				for(std::uint64_t i=0; i<16; i++) {
+					double value = sobol1.value(i, d);
+					BOOST_CHECK(value == sobol2.value(i, d));
+					BOOST_CHECK(value >= 0. && value < 1.);
+					sobolHist.at(static_cast<std::size_t>(value * 16.)) += 1;
+				}
+				BOOST_CHECK(std::all_of(sobolHist.begin(), sobolHist.end(), [](std::size_t n) { return 1 == n; }));
+
+				// The first b^2 Halton points hold one coordinate in each interval of size 1/b^2
+				// (the values are multiples of 1/b^2, so rounding gives the interval)
+				std::size_t nBins = static_cast<std::size_t>(halton1.getBase(d) * halton1.getBase(d));
+				std::vector<std::size_t> haltonHist(nBins, 0);
+				for(std::uint64_t i=0; i<nBins; i++) {
+					double value = halton1.value(i, d);
+					BOOST_CHECK(value == halton2.value(i, d));
+					BOOST_CHECK(value >= 0. && value < 1.);
+					haltonHist.at(static_cast<std::size_t>(std::round(value * static_cast<double>(nBins)))) += 1;
+				}
+				BOOST_CHECK(std::all_of(haltonHist.begin(), haltonHist.end(), [](std::size_t n) { return 1 == n; }));
+			}
+
+			// Scrambling needs to change the points
+			GSobolSequence sobol(4);
+			bool differs = false;
+			for(std::uint64_t i=1; i<16; i++) {
+				if(sobol.value(i, 0) != sobol1.value(i, 0)) differs = true;
+			}
+			BOOST_CHECK(differs);
+		}
+
+		//------------------------------------------------------------------------------
+
+		{ // Check the Philox4x32-10 known answer tests of the Random123 library
+			GPhilox4x32::block_type ctr0 = {{0, 0, 0, 0}};
+			GPhilox4x32::key_type key0 = {{0, 0}};
+			GPhilox4x32::block_type expected0 = {{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}};
+			BOOST_CHECK(expected0 == GPhilox4x32::philox(ctr0, key0));
+
+			GPhilox4x32::block_type ctr1 = {{0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}};
+			GPhilox4x32::key_type key1 = {{0xffffffff, 0xffffffff}};
+			GPhilox4x32::block_type expected1 = {{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}};
+			BOOST_CHECK(expected1 == GPhilox4x32::philox(ctr1, key1));
+
+			GPhilox4x32::block_type ctr2 = {{0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}};
+			GPhilox4x32::key_type key2 = {{0xa4093822, 0x299f31d0}};
+			GPhilox4x32::block_type expected2 = {{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}};
+			BOOST_CHECK(expected2 == GPhilox4x32::philox(ctr2, key2));
+		}
+
+		//------------------------------------------------------------------------------
+
+		{ // Check that identical keys and streams result in reproducible sequences and different streams differ
+			GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER> gr1(12345, 7);
+			GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER> gr2(12345, 7);
+			GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER> gr3(12345, 8);
+			GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER> gr4(54321, 7);
+
+			std::size_t nDiffStream = 0, nDiffKey = 0;
+			for(std::size_t i=0; i<1000; i++) {
+				auto r1 = gr1();
+				auto r4 = gr4();
+				BOOST_CHECK(r1 == gr2());
+				if(r1 != gr3()) nDiffStream++;
+				if(r1 != r4) nDiffKey++;
+			}
+			BOOST_CHECK(nDiffStream > 990);
+			BOOST_CHECK(nDiffKey > 990);
+
+			// Skipping ahead equals drawing the same amount of numbers
+			GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER> gr5(12345, 7);
+			GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER> gr6(12345, 7);
+			for(std::size_t i=0; i<1001; i++) gr5();
+			gr6.discard(1001);
+			for(std::size_t i=0; i<100; i++) {
+				BOOST_CHECK(gr5() == gr6());
+			}
+		}
+
+		//------------------------------------------------------------------------------
+
+		{ // Check that default-constructed counter-based generators draw from distinct streams
+			GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER> gr1;
+			GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER> gr2;
+			GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER> gr3(gr1); // Copies get a stream of their own
+			BOOST_CHECK(gr1.getStream() != gr2.getStream());
+			BOOST_CHECK(gr1.getStream() != gr3.getStream());
+
+			std::size_t nDiff = 0;
+			for(std::size_t i=0; i<1000; i++) {
+				if(gr1() != gr2()) nDiff++;
+			}
+			BOOST_CHECK(nDiff > 990);
+
+			// The thread-local generator is reused within a thread
+			BOOST_CHECK(&threadLocalRandom() == &threadLocalRandom());
+			BOOST_CHECK_NO_THROW(threadLocalRandom()());
+		}
+
+		//------------------------------------------------------------------------------
+
+		{ // Test that uniform_int(min,max) covers the entire range, including the upper boundary in RANDFLAVOURS::RANDOMCOUNTER mode
+			const std::int32_t MINRANDOM=-10;
+			const std::int32_t MAXRANDOM= 10;
+
+			GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER> gr;
+			std::uniform_int_distribution<std::int32_t> uniform_int_distribution(MINRANDOM, MAXRANDOM);
+			std::uniform_real_distribution<double> uniform_real_distribution(0., 1.);
+
+			std::vector<std::int32_t> randomHist(21, 0); // 21 positions from -10 to 10
+			double sum = 0.;
+			for(std::size_t i=0; i<nTests_; i++) {
+				std::int32_t randVal = uniform_int_distribution(gr);
+				BOOST_CHECK(randVal >= MINRANDOM && randVal <= MAXRANDOM);
+				BOOST_CHECK_NO_THROW(randomHist.at(std::size_t(randVal+10)) += 1);
+				sum += uniform_real_distribution(gr);
+			}
+
+			for(std::size_t i=0; i<21; i++) {
+				BOOST_CHECK(randomHist.at(i) > 0);
+			}
+
+			// The mean of uniform [0,1[ numbers should be close to 0.5
+			BOOST_CHECK(std::fabs(sum/double(nTests_) - 0.5) < 0.01);
+		}
+
+		//------------------------------------------------------------------------------
+
+		{ // Check that bulk production of raw random numbers yields the same sequence as single calls
+			GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER> gr1(4711, 3);
+			GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER> gr2(4711, 3);
+
+			// Odd sizes make sure we leave and enter blocks in the middle
+			for(std::size_t n: {std::size_t(1), std::size_t(3), std::size_t(17), std::size_t(1001)}) {
+				std::vector<GRandomBase::result_type> bulk(n);
+				BOOST_CHECK_NO_THROW(gr1.fill(bulk.data(), n));
+				for(std::size_t i=0; i<n; i++) {
+					BOOST_CHECK(bulk[i] == gr2());
+				}
+			}
+
+			// Bulk retrieval from the random factory needs to cross package boundaries
+			GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMPROXY> gr_proxy;
+			std::vector<GRandomBase::result_type> bulk(3*DEFAULTARRAYSIZE + 7, 0);
+			BOOST_CHECK_NO_THROW(gr_proxy.fill(bulk.data(), bulk.size()));
+			std::size_t nZero = std::size_t(std::count(bulk.begin(), bulk.end(), GRandomBase::result_type(0)));
+			BOOST_CHECK(nZero < 3);
+		}
+
+		//------------------------------------------------------------------------------
+
+		{ // Check the moments of uniformly distributed random numbers produced in bulk
+			const double MIN = -2., MAX = 3.;
+			GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER> gr_counter;
+			GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMPROXY> gr_proxy;
+
+			for(GRandomBase *gr: std::vector<GRandomBase *>{&gr_counter, &gr_proxy}) {
+				std::vector<double> values(nTests_ + 1); // Not a multiple of the chunk size
+				BOOST_CHECK_NO_THROW(fill_uniform_real<double>(*gr, values, MIN, MAX));
+
+				double mean = 0., var = 0.;
+				for(auto v: values) {
+					BOOST_CHECK(v >= MIN && v < MAX);
+					mean += v;
+				}
+				mean /= double(values.size());
+				for(auto v: values) var += (v - mean)*(v - mean);
+				var /= double(values.size());
+
+				BOOST_CHECK(std::fabs(mean - 0.5*(MIN + MAX)) < 0.02);
+				BOOST_CHECK(std::fabs(var - (MAX - MIN)*(MAX - MIN)/12.) < 0.05);
+			}
+
+			// Single precision numbers are produced as well
+			std::vector<float> values(nTests_);
+			BOOST_CHECK_NO_THROW(fill_uniform_real<float>(gr_counter, values));
+			float mean = 0.f;
+			for(auto v: values) {
+				BOOST_CHECK(v >= 0.f && v < 1.f);
+				mean += v;
+			}
+			BOOST_CHECK(std::fabs(mean/float(nTests_) - 0.5f) < 0.01f);
+		}
+
+		//------------------------------------------------------------------------------
+
+		{ // Check the moments of normally distributed random numbers produced in bulk
+			const double MEAN = 1., SIGMA = 2.;
+			GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER> gr_counter;
+			GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMPROXY> gr_proxy;
+
+			for(GRandomBase *gr: std::vector<GRandomBase *>{&gr_counter, &gr_proxy}) {
+				std::vector<double> values(nTests_ + 1); // An odd number of values
+				BOOST_CHECK_NO_THROW(fill_normal<double>(*gr, values, MEAN, SIGMA));
+
+				double mean = 0.;
+				for(auto v: values) {
+					BOOST_CHECK(std::isfinite(v));
+					mean += v;
+				}
+				mean /= double(values.size());
+
+				double m2 = 0., m3 = 0., m4 = 0.;
+				for(auto v: values) {
+					double d = v - mean;
+					m2 += d*d;
+					m3 += d*d*d;
+					m4 += d*d*d*d;
+				}
+				m2 /= double(values.size());
+				m3 /= double(values.size());
+				m4 /= double(values.size());
+
+				BOOST_CHECK(std::fabs(mean - MEAN) < 0.03);
+				BOOST_CHECK(std::fabs(std::sqrt(m2) - SIGMA) < 0.03);
+				BOOST_CHECK(std::fabs(m3/std::pow(m2, 1.5)) < 0.05); // skewness
+				BOOST_CHECK(std::fabs(m4/(m2*m2) - 3.) < 0.1); // kurtosis
+			}
+		}
+
+		//------------------------------------------------------------------------------
 	}
 
 	/***********************************************************************************/
@@ -210,7 +495,24 @@ public:
 	 * Test features that are expected to fail
 	 */
 	void failures_expected() {
-		{ /* nothing */ }
+		using namespace Gem::Hap;
+
+		//------------------------------------------------------------------------------
+
+		{ // Check that invalid dimensions and indices of quasi-random sequences are rejected
+			BOOST_CHECK_THROW(GSobolSequence sobolEmpty(0), gemfony_exception);
+			BOOST_CHECK_THROW(GSobolSequence sobolLarge(MAXSOBOLDIMENSIONS + 1), gemfony_exception);
+			BOOST_CHECK_THROW(GHaltonSequence haltonEmpty(0), gemfony_exception);
+
+			GSobolSequence sobol(2);
+			BOOST_CHECK_THROW(sobol.value(0, 2), gemfony_exception);
+			BOOST_CHECK_THROW(sobol.value(std::uint64_t(1) << SOBOLNBITS, 0), gemfony_exception);
+
+			GHaltonSequence halton(2);
+			BOOST_CHECK_THROW(halton.value(0, 2), gemfony_exception);
+		}
+
+		//------------------------------------------------------------------------------
 	}
 
 	/***********************************************************************************/
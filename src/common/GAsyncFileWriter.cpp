@@ -0,0 +1,244 @@
+/********************************************************************************
+ *
+ * This file is part of the Geneva library collection. The following license
+ * applies to this file:
+ *
+ * ------------------------------------------------------------------------------
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * ------------------------------------------------------------------------------
+ *
+ * Note that other files in the Geneva library collection may use a different
+ * license. Please see the licensing information in each file.
+ *
+ ********************************************************************************
+ *
+ * Geneva was started by Dr. Rüdiger Berlich and was later maintained together
+ * with Dr. Ariel Garcia under the auspices of Gemfony scientific. For further
+ * information on Gemfony scientific, see http://www.gemfomy.eu .
+ *
+ * The majority of files in Geneva was released under the Apache license v2.0
+ * in February 2020.
+ *
+ * See the NOTICE file in the top-level directory of the Geneva library
+ * collection for a list of contributors and copyright information.
+ *
+ ********************************************************************************/
+
+#include "common/GAsyncFileWriter.hpp"
+
+namespace Gem {
+namespace Common {
+
+/******************************************************************************/
+/**
+ * Initialization with the operating mode and the maximum number of pending jobs
+ *
+ * @param async Whether jobs should be executed in a background thread
+ * @param maxPendingWrites The maximum number of jobs that may be pending before write() blocks
+ */
+GAsyncFileWriter::GAsyncFileWriter(
+	bool async
+	, std::size_t maxPendingWrites
+)
+	: m_async(async)
+	, m_maxPendingWrites(maxPendingWrites)
+{
+	if(0 == m_maxPendingWrites) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG, time_and_place)
+				<< "In GAsyncFileWriter::GAsyncFileWriter(): Error!" << std::endl
+				<< "The maximum number of pending writes must be at least 1" << std::endl
+		);
+	}
+}
+
+/******************************************************************************/
+/**
+ * The destructor. Waits for all pending jobs. As we may not throw here, errors
+ * are only reported.
+ */
+GAsyncFileWriter::~GAsyncFileWriter() {
+	try {
+		this->close();
+	} catch(std::exception& e) {
+		glogger
+			<< "In GAsyncFileWriter::~GAsyncFileWriter(): Warning!" << std::endl
+			<< "Writing to file " << m_path.string() << " has failed with message" << std::endl
+			<< e.what() << std::endl
+			<< GWARNING;
+	} catch(...) {
+		glogger
+			<< "In GAsyncFileWriter::~GAsyncFileWriter(): Warning!" << std::endl
+			<< "Writing to file " << m_path.string() << " has failed" << std::endl
+			<< GWARNING;
+	}
+
+	// Terminates the writer thread
+	m_writer_ptr.reset();
+}
+
+/******************************************************************************/
+/**
+ * Opens the target file. Any file opened before is closed first.
+ *
+ * @param path The name of the file to write to
+ * @param mode The mode with which the file should be opened
+ */
+void GAsyncFileWriter::open(
+	boost::filesystem::path const& path
+	, std::ios_base::openmode mode
+) {
+	this->close();
+
+	m_stream_ptr.reset(new boost::filesystem::ofstream(path, mode));
+	if(not m_stream_ptr->good()) {
+		m_stream_ptr.reset();
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG, time_and_place)
+				<< "In GAsyncFileWriter::open(): Error!" << std::endl
+				<< "Could not open file " << path.string() << std::endl
+		);
+	}
+	m_path = path;
+
+	if(m_async && not m_writer_ptr) {
+		m_writer_ptr.reset(new GThreadPool(1));
+	}
+}
+
+/******************************************************************************/
+/**
+ * Checks whether a file is currently open
+ */
+bool GAsyncFileWriter::isOpen() const {
+	return bool(m_stream_ptr);
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the name of the file written to
+ */
+boost::filesystem::path GAsyncFileWriter::getPath() const {
+	return m_path;
+}
+
+/******************************************************************************/
+/**
+ * Submits a job that writes to the file. The function object should own all
+ * data it needs, as it may be executed after this function has returned.
+ *
+ * @param f A function object writing to the stream it is given
+ */
+void GAsyncFileWriter::write(std::function<void(std::ostream&)> f) {
+	if(not m_stream_ptr) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG, time_and_place)
+				<< "In GAsyncFileWriter::write(): Error!" << std::endl
+				<< "No file has been opened" << std::endl
+		);
+	}
+
+	if(not m_async) {
+		f(*m_stream_ptr);
+		return;
+	}
+
+	// Make room for the new job and pass on errors of jobs that have finished
+	this->waitForPendingWrites(m_maxPendingWrites - 1);
+
+	boost::filesystem::ofstream *stream_ptr = m_stream_ptr.get();
+	m_futures_cnt.push_back(
+		m_writer_ptr->async_schedule([stream_ptr, f]() { f(*stream_ptr); })
+	);
+}
+
+/******************************************************************************/
+/**
+ * Waits for all pending jobs and flushes the file
+ */
+void GAsyncFileWriter::flush() {
+	this->waitForPendingWrites(0);
+	if(m_stream_ptr) m_stream_ptr->flush();
+}
+
+/******************************************************************************/
+/**
+ * Waits for all pending jobs and closes the file. The stream is closed even if
+ * a job has failed, the error is passed on afterwards.
+ */
+void GAsyncFileWriter::close() {
+	std::exception_ptr e_ptr;
+	try {
+		this->waitForPendingWrites(0);
+	} catch(...) {
+		e_ptr = std::current_exception();
+	}
+
+	if(m_stream_ptr) {
+		m_stream_ptr->close();
+		m_stream_ptr.reset();
+	}
+
+	if(e_ptr) std::rethrow_exception(e_ptr);
+}
+
+/******************************************************************************/
+/**
+ * Checks whether jobs are executed in a background thread
+ */
+bool GAsyncFileWriter::isAsync() const {
+	return m_async;
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the maximum number of pending jobs
+ */
+std::size_t GAsyncFileWriter::getMaxPendingWrites() const {
+	return m_maxPendingWrites;
+}
+
+/******************************************************************************/
+/**
+ * Removes finished jobs and waits for the oldest ones until at most the given
+ * number of jobs remains pending. All jobs are waited for before the first
+ * error encountered is passed on.
+ *
+ * @param maxRemaining The number of jobs that may remain pending
+ */
+void GAsyncFileWriter::waitForPendingWrites(std::size_t maxRemaining) {
+	std::exception_ptr e_ptr;
+	std::size_t nWait = m_futures_cnt.size() > maxRemaining ? m_futures_cnt.size() - maxRemaining : 0;
+
+	auto it = m_futures_cnt.begin();
+	while(it != m_futures_cnt.end()) {
+		if(nWait > 0 || std::future_status::ready == it->wait_for(std::chrono::seconds(0))) {
+			if(nWait > 0) nWait--;
+			try {
+				it->get();
+			} catch(...) {
+				if(not e_ptr) e_ptr = std::current_exception();
+			}
+			it = m_futures_cnt.erase(it);
+		} else {
+			++it;
+		}
+	}
+
+	if(e_ptr) std::rethrow_exception(e_ptr);
+}
+
+/******************************************************************************/
+
+} /* namespace Common */
+} /* namespace Gem */
@@ -0,0 +1,399 @@
+/********************************************************************************
+ *
+ * This file is part of the Geneva library collection. The following license
+ * applies to this file:
+ *
+ * ------------------------------------------------------------------------------
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * ------------------------------------------------------------------------------
+ *
+ * Note that other files in the Geneva library collection may use a different
+ * license. Please see the licensing information in each file.
+ *
+ ********************************************************************************
+ *
+ * Geneva was started by Dr. Rüdiger Berlich and was later maintained together
+ * with Dr. Ariel Garcia under the auspices of Gemfony scientific. For further
+ * information on Gemfony scientific, see http://www.gemfomy.eu .
+ *
+ * The majority of files in Geneva was released under the Apache license v2.0
+ * in February 2020.
+ *
+ * See the NOTICE file in the top-level directory of the Geneva library
+ * collection for a list of contributors and copyright information.
+ *
+ ********************************************************************************/
+
+// Standard headers go here
+#include <cerrno>
+#include <cstring>
+#include <chrono>
+#include <thread>
+#include <limits>
+#include <sstream>
+
+// POSIX headers go here
+#include <unistd.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <pthread.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+#include "common/GExternalProcess.hpp"
+
+namespace Gem {
+namespace Common {
+
+/******************************************************************************/
+/**
+ * Initialization with the command line to be executed. The process is only
+ * started with the first exchange.
+ *
+ * @param command The command line to be executed by the shell
+ * @param maxFrameSize The maximum allowed size of a response
+ */
+GExternalProcess::GExternalProcess(
+	std::string const& command
+	, std::size_t maxFrameSize
+)
+	: m_command(command)
+	, m_maxFrameSize(maxFrameSize)
+	, m_pid(-1)
+	, m_toProcess(-1)
+	, m_fromProcess(-1)
+	, m_exitStatus(0)
+	, m_nStarts(0)
+{
+	if(m_command.empty()) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG, time_and_place)
+				<< "In GExternalProcess::GExternalProcess(): Error!" << std::endl
+				<< "Got empty command line" << std::endl
+		);
+	}
+
+	if(0 == m_maxFrameSize || m_maxFrameSize > std::size_t(std::numeric_limits<std::uint32_t>::max())) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG, time_and_place)
+				<< "In GExternalProcess::GExternalProcess(): Error!" << std::endl
+				<< "Invalid maximum frame size " << m_maxFrameSize << std::endl
+		);
+	}
+}
+
+/******************************************************************************/
+/**
+ * The destructor. Closes the input of the process and waits for it to exit.
+ */
+GExternalProcess::~GExternalProcess() {
+	this->terminate();
+}
+
+/******************************************************************************/
+/**
+ * Sends a request to the process and waits for its response. The process is
+ * started, if it is not running. If the process dies during the exchange or
+ * sends an oversized response, it is terminated and false is returned. It will
+ * then be restarted with the next exchange. getLastError() describes the failure.
+ *
+ * @param request The payload of the request frame
+ * @param response Will hold the payload of the response frame
+ * @return A boolean indicating whether the exchange was successful
+ */
+bool GExternalProcess::exchange(
+	std::string const& request
+	, std::string& response
+) {
+	if(request.size() > std::size_t(std::numeric_limits<std::uint32_t>::max())) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG, time_and_place)
+				<< "In GExternalProcess::exchange(): Error!" << std::endl
+				<< "Request of size " << request.size() << " does not fit into a frame" << std::endl
+		);
+	}
+
+	if(not this->isRunning()) {
+		this->start();
+	}
+
+	// Send the request, preceded by its length
+	char header[4];
+	std::uint32_t requestSize = static_cast<std::uint32_t>(request.size());
+	for(std::size_t i=0; i<4; i++) {
+		header[i] = static_cast<char>((requestSize >> (8*i)) & 0xFF);
+	}
+
+	if(not this->writeAll(header, 4) || not this->writeAll(request.data(), request.size())) {
+		return this->fail("The process did not accept the request");
+	}
+
+	// Retrieve the response
+	if(not this->readAll(header, 4)) {
+		return this->fail("The process terminated before sending a response");
+	}
+
+	std::size_t responseSize = 0;
+	for(std::size_t i=0; i<4; i++) {
+		responseSize |= std::size_t(static_cast<unsigned char>(header[i])) << (8*i);
+	}
+
+	if(responseSize > m_maxFrameSize) {
+		return this->fail(
+			"The process announced a response of " + std::to_string(responseSize)
+			+ " bytes, exceeding the limit of " + std::to_string(m_maxFrameSize) + " bytes"
+		);
+	}
+
+	response.resize(responseSize);
+	if(responseSize > 0 && not this->readAll(&response[0], responseSize)) {
+		return this->fail("The process terminated while sending its response");
+	}
+
+	return true;
+}
+
+/******************************************************************************/
+/**
+ * Terminates the process, if it is running. Its input is closed first, so the
+ * process may exit on its own. If it fails to do so in time, it is killed.
+ */
+void GExternalProcess::terminate() {
+	if(m_pid < 0) return;
+
+	::close(m_toProcess);
+	::close(m_fromProcess);
+
+	bool exited = false;
+	auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(DEFAULTPROCESSEXITTIMEOUT);
+	while(true) {
+		pid_t result = ::waitpid(m_pid, &m_exitStatus, WNOHANG);
+		if(result == m_pid) {
+			exited = true;
+			break;
+		} else if(result < 0 && EINTR != errno) {
+			exited = true; // The process is not our child anymore
+			break;
+		} else if(std::chrono::steady_clock::now() > deadline) {
+			break;
+		}
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(5));
+	}
+
+	if(not exited) {
+		::kill(m_pid, SIGKILL);
+		while(::waitpid(m_pid, &m_exitStatus, 0) < 0 && EINTR == errno) { /* nothing */ }
+	}
+
+	m_pid = -1;
+	m_toProcess = -1;
+	m_fromProcess = -1;
+}
+
+/******************************************************************************/
+/**
+ * Checks whether the process is currently running, i.e. it was started and
+ * is not known to have terminated.
+ */
+bool GExternalProcess::isRunning() const {
+	return m_pid >= 0;
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the command line of the process
+ */
+std::string GExternalProcess::getCommand() const {
+	return m_command;
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the number of times the process was started. Any number larger
+ * than 1 indicates restarts after failures.
+ */
+std::size_t GExternalProcess::getNStarts() const {
+	return m_nStarts;
+}
+
+/******************************************************************************/
+/**
+ * Retrieves a description of the last failed exchange
+ */
+std::string GExternalProcess::getLastError() const {
+	return m_lastError;
+}
+
+/******************************************************************************/
+/**
+ * Starts the process through the shell, with pipes attached to its standard
+ * input and output. All descriptors are marked close-on-exec, so processes
+ * started concurrently by other threads do not inherit them.
+ */
+void GExternalProcess::start() {
+	int toProcess[2];
+	int fromProcess[2];
+
+	if(::pipe(toProcess) < 0) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG, time_and_place)
+				<< "In GExternalProcess::start(): Error!" << std::endl
+				<< "Could not create pipe: " << std::strerror(errno) << std::endl
+		);
+	}
+
+	if(::pipe(fromProcess) < 0) {
+		int error = errno;
+		::close(toProcess[0]);
+		::close(toProcess[1]);
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG, time_and_place)
+				<< "In GExternalProcess::start(): Error!" << std::endl
+				<< "Could not create pipe: " << std::strerror(error) << std::endl
+		);
+	}
+
+	for(int fd: {toProcess[0], toProcess[1], fromProcess[0], fromProcess[1]}) {
+		::fcntl(fd, F_SETFD, FD_CLOEXEC);
+	}
+
+	// Prepared before forking, as the child may only use async-signal-safe functions
+	std::string shellCommand = "exec " + m_command;
+
+	pid_t pid = ::fork();
+	if(pid < 0) {
+		int error = errno;
+		for(int fd: {toProcess[0], toProcess[1], fromProcess[0], fromProcess[1]}) {
+			::close(fd);
+		}
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG, time_and_place)
+				<< "In GExternalProcess::start(): Error!" << std::endl
+				<< "Could not start \"" << m_command << "\": " << std::strerror(error) << std::endl
+		);
+	}
+
+	if(0 == pid) { // The child
+		// dup2 clears the close-on-exec flag of the new descriptors
+		if(::dup2(toProcess[0], STDIN_FILENO) < 0 || ::dup2(fromProcess[1], STDOUT_FILENO) < 0) {
+			::_exit(127);
+		}
+		::execl("/bin/sh", "sh", "-c", shellCommand.c_str(), static_cast<char *>(nullptr));
+		::_exit(127);
+	}
+
+	::close(toProcess[0]);
+	::close(fromProcess[1]);
+
+	m_pid = pid;
+	m_toProcess = toProcess[1];
+	m_fromProcess = fromProcess[0];
+	m_nStarts++;
+}
+
+/******************************************************************************/
+/**
+ * Writes a buffer completely to the process. SIGPIPE is blocked while writing,
+ * so a dead process results in an error rather than the termination of the
+ * caller. A SIGPIPE raised in the meantime is discarded.
+ *
+ * @param data The data to be written
+ * @param size The number of bytes to be written
+ * @return A boolean indicating whether all data could be written
+ */
+bool GExternalProcess::writeAll(const char *data, std::size_t size) {
+	sigset_t pipeSet, oldSet;
+	sigemptyset(&pipeSet);
+	sigaddset(&pipeSet, SIGPIPE);
+	::pthread_sigmask(SIG_BLOCK, &pipeSet, &oldSet);
+
+	bool success = true;
+	while(size > 0) {
+		ssize_t written = ::write(m_toProcess, data, size);
+		if(written < 0) {
+			if(EINTR == errno) continue;
+			success = false;
+			break;
+		}
+
+		data += written;
+		size -= std::size_t(written);
+	}
+
+	if(not success) {
+		sigset_t pending;
+		sigpending(&pending);
+		if(sigismember(&pending, SIGPIPE) && not sigismember(&oldSet, SIGPIPE)) {
+			int sig;
+			sigwait(&pipeSet, &sig);
+		}
+	}
+
+	::pthread_sigmask(SIG_SETMASK, &oldSet, nullptr);
+	return success;
+}
+
+/******************************************************************************/
+/**
+ * Reads the given number of bytes from the process
+ *
+ * @param data The buffer to be filled
+ * @param size The number of bytes to be read
+ * @return A boolean indicating whether all bytes could be read
+ */
+bool GExternalProcess::readAll(char *data, std::size_t size) {
+	while(size > 0) {
+		ssize_t nRead = ::read(m_fromProcess, data, size);
+		if(nRead < 0) {
+			if(EINTR == errno) continue;
+			return false;
+		} else if(0 == nRead) { // End of file
+			return false;
+		}
+
+		data += nRead;
+		size -= std::size_t(nRead);
+	}
+
+	return true;
+}
+
+/******************************************************************************/
+/**
+ * Terminates the process after a failed exchange and records the reason,
+ * together with the exit status of the process
+ *
+ * @param reason A description of the failure
+ * @return Always false, so it can be returned by exchange()
+ */
+bool GExternalProcess::fail(std::string const& reason) {
+	this->terminate();
+
+	std::ostringstream error;
+	error << reason << " (command \"" << m_command << "\"";
+	if(WIFEXITED(m_exitStatus)) {
+		error << ", exit code " << WEXITSTATUS(m_exitStatus);
+	} else if(WIFSIGNALED(m_exitStatus)) {
+		error << ", terminated by signal " << WTERMSIG(m_exitStatus);
+	}
+	error << ")";
+
+	m_lastError = error.str();
+	return false;
+}
+
+/******************************************************************************/
+
+} /* namespace Common */
+} /* namespace Gem */
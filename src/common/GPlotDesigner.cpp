@@ -70,6 +70,90 @@ BOOST_CLASS_EXPORT_IMPLEMENT(Gem::Common::GFunctionPlotter2D);
 
 BOOST_CLASS_EXPORT_IMPLEMENT(Gem::Common::GPlotDesigner);
 
+namespace {
+	/***************************************************************************/
+	/**
+	 * Calculates the ROOT-style number of the bin a value falls into, with 0
+	 * denoting the underflow- and nBins+1 the overflow-bin
+	 */
+	std::size_t streamingBinNumber(
+		double value
+		, double min
+		, double max
+		, std::size_t nBins
+	) {
+		if(std::isnan(value) || value >= max) {
+			return nBins + 1;
+		}
+
+		if(value < min) {
+			return 0;
+		}
+
+		auto bin = static_cast<std::size_t>((value - min) / (max - min) * static_cast<double>(nBins));
+		return std::min(bin, nBins - 1) + 1;
+	}
+
+	/***************************************************************************/
+	/**
+	 * Doubles the range of an adaptive axis until a value fits into it, merging
+	 * pairs of neighbouring bins. As the bin width exactly doubles, every old bin
+	 * falls completely into a single new bin. Bin contents are addressed as
+	 * binNumber*axisStride + row*rowStride, which covers both axes of 2D histograms.
+	 */
+	void widenStreamingAxis(
+		double value
+		, double &min
+		, double &max
+		, std::size_t nBins
+		, std::vector<double> &binContents
+		, std::size_t axisStride
+		, std::size_t rowStride
+		, std::size_t nRows
+	) {
+		if(!std::isfinite(value)) {
+			return; // Will end up in the under- or overflow bin
+		}
+
+		std::vector<double> merged(nBins);
+		while(value < min || value >= max) {
+			double width = max - min;
+			std::size_t offset = 0;
+			if(value < min) {
+				min -= width;
+				offset = nBins;
+			} else {
+				max += width;
+			}
+
+			for(std::size_t row = 0; row < nRows; row++) {
+				std::fill(merged.begin(), merged.end(), 0.);
+				for(std::size_t bin = 0; bin < nBins; bin++) {
+					merged[(offset + bin) / 2] += binContents[(bin + 1) * axisStride + row * rowStride];
+				}
+				for(std::size_t bin = 0; bin < nBins; bin++) {
+					binContents[(bin + 1) * axisStride + row * rowStride] = merged[bin];
+				}
+			}
+		}
+	}
+
+	/***************************************************************************/
+	/**
+	 * Turns the extremes of buffered values into the range of an adaptive axis.
+	 * The upper boundary is moved just above the largest value, as it is not
+	 * part of the range.
+	 */
+	void setAdaptiveRange(double &min, double &max) {
+		if(min == max) {
+			min -= 0.5;
+			max += 0.5;
+		} else {
+			max = std::nextafter(max, std::numeric_limits<double>::max());
+		}
+	}
+}
+
 namespace Gem {
 namespace Common {
 
@@ -213,6 +297,33 @@ std::istream &operator>>(std::istream &i, tddropt &x) {
 	return i;
 }
 
+/******************************************************************************/
+/**
+ * Puts a dataReductionMode into a stream. Needed also for boost::lexical_cast<>
+ */
+std::ostream &operator<<(std::ostream &o, const dataReductionMode &x) {
+	ENUMBASETYPE tmp = static_cast<ENUMBASETYPE>(x);
+	o << tmp;
+	return o;
+}
+
+/******************************************************************************/
+/**
+ * Reads a dataReductionMode item from a stream. Needed also for boost::lexical_cast<>
+ */
+std::istream &operator>>(std::istream &i, dataReductionMode &x) {
+	ENUMBASETYPE tmp;
+	i >> tmp;
+
+#ifdef DEBUG
+	x = boost::numeric_cast<dataReductionMode>(tmp);
+#else
+	x = static_cast<dataReductionMode>(tmp);
+#endif /* DEBUG */
+
+	return i;
+}
+
 /******************************************************************************/
 ////////////////////////////////////////////////////////////////////////////////
 /******************************************************************************/
@@ -231,6 +342,11 @@ GBasePlotter::GBasePlotter(const GBasePlotter &cp)
 	, m_dsMarker(cp.m_dsMarker)
 	, m_secondaryPlotter()
 	, m_id(cp.m_id)
+	, m_reductionMode(cp.m_reductionMode)
+	, m_maxNDataPoints(cp.m_maxNDataPoints)
+	, m_nDataPointsSeen(cp.m_nDataPointsSeen)
+	, m_decimationStride(cp.m_decimationStride)
+	, m_reservoir_rng(cp.m_reservoir_rng)
 {
 	// Note: Explicit scope needed for name resolution of clone -- compare
 	// https://isocpp.org/wiki/faq/templates#nondependent-name-lookup-members
@@ -256,6 +372,12 @@ GBasePlotter& GBasePlotter::operator=(GBasePlotter const & cp) {
 	m_dsMarker     = cp.m_dsMarker;
 	m_id           = cp.m_id;
 
+	m_reductionMode    = cp.m_reductionMode;
+	m_maxNDataPoints   = cp.m_maxNDataPoints;
+	m_nDataPointsSeen  = cp.m_nDataPointsSeen;
+	m_decimationStride = cp.m_decimationStride;
+	m_reservoir_rng    = cp.m_reservoir_rng;
+
 	Gem::Common::copyCloneableSmartPointerContainer(cp.m_secondaryPlotter, m_secondaryPlotter);
 
 	return *this;
@@ -432,6 +554,67 @@ void GBasePlotter::setId(const std::size_t &id) {
 	m_id = id;
 }
 
+/******************************************************************************/
+/**
+ * Limits the number of data points stored by data collectors. This allows
+ * monitors to run for an unlimited number of iterations with bounded memory.
+ * The setting must be made before the first data point is added, as otherwise
+ * the sampling statistics would be wrong.
+ *
+ * @param mode The desired data reduction mode
+ * @param maxNDataPoints The maximum number of stored data points (ignored for dataReductionMode::NONE)
+ */
+void GBasePlotter::setDataReduction(
+	dataReductionMode mode
+	, std::size_t maxNDataPoints
+) {
+	if(m_nDataPointsSeen > 0) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG, time_and_place)
+				<< "In GBasePlotter::setDataReduction(): Error!" << std::endl
+				<< "The data reduction mode must be set before data is added," << std::endl
+				<< "but " << m_nDataPointsSeen << " data points have already been added" << std::endl
+		);
+	}
+
+	if(dataReductionMode::NONE != mode && maxNDataPoints < 2) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG, time_and_place)
+				<< "In GBasePlotter::setDataReduction(): Error!" << std::endl
+				<< "At least two data points must be retained, got " << maxNDataPoints << std::endl
+		);
+	}
+
+	m_reductionMode = mode;
+	m_maxNDataPoints = maxNDataPoints;
+	m_decimationStride = 1;
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the current data reduction mode
+ */
+dataReductionMode GBasePlotter::getDataReductionMode() const {
+	return m_reductionMode;
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the maximum number of stored data points in reduction modes
+ */
+std::size_t GBasePlotter::getMaxNDataPoints() const {
+	return m_maxNDataPoints;
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the number of data points offered to this object so far. In
+ * reduction modes this may be larger than the number of stored points.
+ */
+std::size_t GBasePlotter::getNDataPointsSeen() const {
+	return m_nDataPointsSeen;
+}
+
 /******************************************************************************/
 /**
  * Returns the name of this class
@@ -467,6 +650,10 @@ void GBasePlotter::compare_(
 	compare_t(IDENTITY(m_dsMarker, p_load->m_dsMarker), token);
 	compare_t(IDENTITY(m_secondaryPlotter, p_load->m_secondaryPlotter), token);
 	compare_t(IDENTITY(m_id, p_load->m_id), token);
+	compare_t(IDENTITY(m_reductionMode, p_load->m_reductionMode), token);
+	compare_t(IDENTITY(m_maxNDataPoints, p_load->m_maxNDataPoints), token);
+	compare_t(IDENTITY(m_nDataPointsSeen, p_load->m_nDataPointsSeen), token);
+	compare_t(IDENTITY(m_decimationStride, p_load->m_decimationStride), token);
 
 	// React on deviations from the expectation
 	token.evaluate();
@@ -490,6 +677,10 @@ void GBasePlotter::load_(const GBasePlotter* cp) {
 	m_plot_label       = p_load->m_plot_label;
 	m_dsMarker         = p_load->m_dsMarker;
 	m_id               = p_load->m_id;
+	m_reductionMode    = p_load->m_reductionMode;
+	m_maxNDataPoints   = p_load->m_maxNDataPoints;
+	m_nDataPointsSeen  = p_load->m_nDataPointsSeen;
+	m_decimationStride = p_load->m_decimationStride;
 
 	copyCloneableSmartPointerContainer(p_load->m_secondaryPlotter, m_secondaryPlotter);
 }
@@ -1764,6 +1955,20 @@ std::string GHistogram1D::bodyData_(
 
 	std::string histName = "histD" + suffix(isSecondary, pId);
 
+	if(m_streaming && !m_binContents.empty()) {
+		body_data << indent << "// Bin contents of a streaming histogram " << comment << std::endl;
+		for(std::size_t bin = 0; bin < m_binContents.size(); bin++) {
+			if(0. == m_binContents[bin]) continue;
+			body_data
+				<< indent << histName << "->SetBinContent(" << bin << ", " << std::showpoint << m_binContents[bin] << ");" << std::endl;
+		}
+		body_data
+			<< indent << histName << "->SetEntries(" << m_nEntries << ");" << std::endl
+			<< std::endl;
+
+		return body_data.str();
+	}
+
 	std::vector<double>::const_iterator it;
 	std::size_t posCounter = 0;
 	for (it = m_data.begin(); it != m_data.end(); ++it) {
@@ -1864,6 +2069,156 @@ double GHistogram1D::getMaxX() const {
 	return maxX_;
 }
 
+/******************************************************************************/
+/**
+ * Switches between storing raw data points and filling them into bins directly.
+ * In streaming mode memory consumption no longer grows with the number of
+ * entries. If no range was specified, the first DEFNHISTWARMUPPOINTS points are
+ * buffered to determine one. Afterwards the range is doubled whenever a value
+ * falls outside of it, merging pairs of bins. Points stored before the switch
+ * are moved into the bins. Streaming mode cannot be left once data has been
+ * binned, as the raw data is then no longer available.
+ *
+ * @param streaming Whether data points should be filled into bins directly
+ */
+void GHistogram1D::setStreaming(bool streaming) {
+	if(streaming == m_streaming) return;
+
+	if(streaming) {
+		if(0 == nBinsX_) {
+			throw gemfony_exception(
+				g_error_streamer(DO_LOG, time_and_place)
+					<< "In GHistogram1D::setStreaming(): Error!" << std::endl
+					<< "Streaming mode requires at least one bin" << std::endl
+			);
+		}
+
+		m_streaming = true;
+		m_adaptiveX = (minX_ == maxX_);
+		m_binContents.clear();
+		m_nEntries = 0;
+
+		if(!m_adaptiveX || m_data.size() >= DEFNHISTWARMUPPOINTS) {
+			this->binBufferedData_();
+		}
+	} else {
+		if(!m_binContents.empty()) {
+			throw gemfony_exception(
+				g_error_streamer(DO_LOG, time_and_place)
+					<< "In GHistogram1D::setStreaming(): Error!" << std::endl
+					<< "Cannot leave streaming mode after data has been binned" << std::endl
+			);
+		}
+
+		m_streaming = false;
+		m_adaptiveX = false;
+	}
+}
+
+/******************************************************************************/
+/**
+ * Checks whether data points are filled into bins directly
+ */
+bool GHistogram1D::isStreaming() const {
+	return m_streaming;
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the content of a bin in streaming mode. Bin 0 is the underflow-
+ * and bin getNBinsX()+1 the overflow-bin, as in ROOT.
+ *
+ * @param bin The number of the bin
+ * @return The number of entries in this bin
+ */
+double GHistogram1D::getBinContent(std::size_t bin) const {
+	if(!m_streaming || bin > nBinsX_ + 1) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG, time_and_place)
+				<< "In GHistogram1D::getBinContent(): Error!" << std::endl
+				<< "Bin contents are only available in streaming mode for bins 0.." << nBinsX_ + 1 << std::endl
+				<< "Got bin " << bin << std::endl
+		);
+	}
+
+	if(m_binContents.empty()) { // Still buffering points in order to determine the range
+		if(m_data.empty()) return 0.;
+
+		GHistogram1D binned(*this);
+		binned.binBufferedData_();
+		return binned.m_binContents.at(bin);
+	}
+
+	return m_binContents.at(bin);
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the number of entries of this histogram
+ */
+std::size_t GHistogram1D::getNEntries() const {
+	return m_binContents.empty()?m_data.size():m_nEntries;
+}
+
+/******************************************************************************/
+/**
+ * Adds a data point. In streaming mode the point is filled into the bins
+ * (or buffered until a range could be determined) rather than stored.
+ *
+ * @param x The data point to be added
+ */
+void GHistogram1D::addDataPoint_(const double &x) {
+	if(!m_streaming) {
+		GDataCollector1T<double>::addDataPoint_(x);
+		return;
+	}
+
+	if(m_binContents.empty()) { // The range is not yet known
+		m_data.push_back(x);
+		if(m_data.size() >= DEFNHISTWARMUPPOINTS) {
+			this->binBufferedData_();
+		}
+		return;
+	}
+
+	this->fillBin_(x);
+}
+
+/******************************************************************************/
+/**
+ * Fixes the range (if it is determined automatically) from the buffered data
+ * points and moves them into the bins
+ */
+void GHistogram1D::binBufferedData_() {
+	if(m_adaptiveX) {
+		std::tie(minX_, maxX_) = this->getMinMaxElements();
+		setAdaptiveRange(minX_, maxX_);
+	}
+
+	m_binContents.assign(nBinsX_ + 2, 0.);
+	m_nEntries = 0;
+
+	for(auto const& x: m_data) {
+		this->fillBin_(x);
+	}
+
+	m_data.clear();
+	m_data.shrink_to_fit();
+}
+
+/******************************************************************************/
+/**
+ * Fills a single value into the bins, widening the range first if needed
+ */
+void GHistogram1D::fillBin_(double x) {
+	if(m_adaptiveX) {
+		widenStreamingAxis(x, minX_, maxX_, nBinsX_, m_binContents, 1, 0, 1);
+	}
+
+	m_binContents[streamingBinNumber(x, minX_, maxX_, nBinsX_)] += 1.;
+	m_nEntries++;
+}
+
 /******************************************************************************/
 /**
  * Retrieves a unique name for this plotter
@@ -1902,6 +2257,10 @@ void GHistogram1D::compare_(
 	compare_t(IDENTITY(nBinsX_, p_load->nBinsX_), token);
 	compare_t(IDENTITY(minX_, p_load->minX_), token);
 	compare_t(IDENTITY(maxX_, p_load->maxX_), token);
+	compare_t(IDENTITY(m_streaming, p_load->m_streaming), token);
+	compare_t(IDENTITY(m_adaptiveX, p_load->m_adaptiveX), token);
+	compare_t(IDENTITY(m_binContents, p_load->m_binContents), token);
+	compare_t(IDENTITY(m_nEntries, p_load->m_nEntries), token);
 
 	// React on deviations from the expectation
 	token.evaluate();
@@ -1930,6 +2289,10 @@ void GHistogram1D::load_(const GBasePlotter* cp) {
 	nBinsX_ = p_load->nBinsX_;
 	minX_     = p_load->minX_;
 	maxX_     = p_load->maxX_;
+	m_streaming   = p_load->m_streaming;
+	m_adaptiveX   = p_load->m_adaptiveX;
+	m_binContents = p_load->m_binContents;
+	m_nEntries    = p_load->m_nEntries;
 }
 
 /******************************************************************************/
@@ -2333,6 +2696,24 @@ std::string GHistogram2D::bodyData_(
 
 	std::string histName = "hist2D" + suffix(isSecondary, pId);
 
+	if(m_streaming && !m_binContents.empty()) {
+		body_data << indent << "// Bin contents of a streaming histogram " << comment << std::endl;
+		const std::size_t rowLength = nBinsX_ + 2;
+		for(std::size_t binY = 0; binY < nBinsY_ + 2; binY++) {
+			for(std::size_t binX = 0; binX < rowLength; binX++) {
+				double content = m_binContents[binY * rowLength + binX];
+				if(0. == content) continue;
+				body_data
+					<< indent << histName << "->SetBinContent(" << binX << ", " << binY << ", " << std::showpoint << content << ");" << std::endl;
+			}
+		}
+		body_data
+			<< indent << histName << "->SetEntries(" << m_nEntries << ");" << std::endl
+			<< std::endl;
+
+		return body_data.str();
+	}
+
 	std::vector<std::tuple<double, double>>::const_iterator it;
 	std::size_t posCounter = 0;
 	for (it = m_data.begin(); it != m_data.end(); ++it) {
@@ -2494,6 +2875,168 @@ tddropt GHistogram2D::get2DOpt() const {
 	return dropt_;
 }
 
+/******************************************************************************/
+/**
+ * Switches between storing raw data points and filling them into bins directly.
+ * Axes without a specified range buffer the first DEFNHISTWARMUPPOINTS points
+ * to determine one and are doubled in size (merging pairs of bins) whenever a
+ * value falls outside of them. Points stored before the switch are moved into
+ * the bins. Streaming mode cannot be left once data has been binned.
+ *
+ * @param streaming Whether data points should be filled into bins directly
+ */
+void GHistogram2D::setStreaming(bool streaming) {
+	if(streaming == m_streaming) return;
+
+	if(streaming) {
+		if(0 == nBinsX_ || 0 == nBinsY_) {
+			throw gemfony_exception(
+				g_error_streamer(DO_LOG, time_and_place)
+					<< "In GHistogram2D::setStreaming(): Error!" << std::endl
+					<< "Streaming mode requires at least one bin in each direction" << std::endl
+			);
+		}
+
+		m_streaming = true;
+		// The header data uses automatic range detection unless both ranges were given
+		m_adaptiveX = (minX_ == maxX_ || minY_ == maxY_);
+		m_adaptiveY = m_adaptiveX;
+		m_binContents.clear();
+		m_nEntries = 0;
+
+		if(!m_adaptiveX || m_data.size() >= DEFNHISTWARMUPPOINTS) {
+			this->binBufferedData_();
+		}
+	} else {
+		if(!m_binContents.empty()) {
+			throw gemfony_exception(
+				g_error_streamer(DO_LOG, time_and_place)
+					<< "In GHistogram2D::setStreaming(): Error!" << std::endl
+					<< "Cannot leave streaming mode after data has been binned" << std::endl
+			);
+		}
+
+		m_streaming = false;
+		m_adaptiveX = false;
+		m_adaptiveY = false;
+	}
+}
+
+/******************************************************************************/
+/**
+ * Checks whether data points are filled into bins directly
+ */
+bool GHistogram2D::isStreaming() const {
+	return m_streaming;
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the content of a bin in streaming mode. Bin 0 is the underflow-
+ * and bin getNBins?()+1 the overflow-bin in each direction, as in ROOT.
+ *
+ * @param binX The number of the bin in x-direction
+ * @param binY The number of the bin in y-direction
+ * @return The number of entries in this bin
+ */
+double GHistogram2D::getBinContent(std::size_t binX, std::size_t binY) const {
+	if(!m_streaming || binX > nBinsX_ + 1 || binY > nBinsY_ + 1) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG, time_and_place)
+				<< "In GHistogram2D::getBinContent(): Error!" << std::endl
+				<< "Bin contents are only available in streaming mode for bins" << std::endl
+				<< "0.." << nBinsX_ + 1 << " / 0.." << nBinsY_ + 1 << std::endl
+				<< "Got bin " << binX << " / " << binY << std::endl
+		);
+	}
+
+	if(m_binContents.empty()) { // Still buffering points in order to determine the ranges
+		if(m_data.empty()) return 0.;
+
+		GHistogram2D binned(*this);
+		binned.binBufferedData_();
+		return binned.m_binContents.at(binY * (nBinsX_ + 2) + binX);
+	}
+
+	return m_binContents.at(binY * (nBinsX_ + 2) + binX);
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the number of entries of this histogram
+ */
+std::size_t GHistogram2D::getNEntries() const {
+	return m_binContents.empty()?m_data.size():m_nEntries;
+}
+
+/******************************************************************************/
+/**
+ * Adds a data point. In streaming mode the point is filled into the bins
+ * (or buffered until the ranges could be determined) rather than stored.
+ *
+ * @param point The data point to be added
+ */
+void GHistogram2D::addDataPoint_(const std::tuple<double, double> &point) {
+	if(!m_streaming) {
+		GDataCollector2T<double, double>::addDataPoint_(point);
+		return;
+	}
+
+	if(m_binContents.empty()) { // The ranges are not yet known
+		m_data.push_back(point);
+		if(m_data.size() >= DEFNHISTWARMUPPOINTS) {
+			this->binBufferedData_();
+		}
+		return;
+	}
+
+	this->fillBin_(std::get<0>(point), std::get<1>(point));
+}
+
+/******************************************************************************/
+/**
+ * Fixes the ranges (if they are determined automatically) from the buffered
+ * data points and moves them into the bins
+ */
+void GHistogram2D::binBufferedData_() {
+	if(m_adaptiveX) {
+		std::tie(minX_, maxX_, minY_, maxY_) = this->getMinMaxElements();
+		setAdaptiveRange(minX_, maxX_);
+		setAdaptiveRange(minY_, maxY_);
+	}
+
+	m_binContents.assign((nBinsX_ + 2) * (nBinsY_ + 2), 0.);
+	m_nEntries = 0;
+
+	for(auto const& point: m_data) {
+		this->fillBin_(std::get<0>(point), std::get<1>(point));
+	}
+
+	m_data.clear();
+	m_data.shrink_to_fit();
+}
+
+/******************************************************************************/
+/**
+ * Fills a single point into the bins, widening the ranges first if needed
+ */
+void GHistogram2D::fillBin_(double x, double y) {
+	const std::size_t rowLength = nBinsX_ + 2;
+
+	if(m_adaptiveX) {
+		widenStreamingAxis(x, minX_, maxX_, nBinsX_, m_binContents, 1, rowLength, nBinsY_ + 2);
+	}
+	if(m_adaptiveY) {
+		widenStreamingAxis(y, minY_, maxY_, nBinsY_, m_binContents, rowLength, 1, rowLength);
+	}
+
+	std::size_t binX = streamingBinNumber(x, minX_, maxX_, nBinsX_);
+	std::size_t binY = streamingBinNumber(y, minY_, maxY_, nBinsY_);
+
+	m_binContents[binY * rowLength + binX] += 1.;
+	m_nEntries++;
+}
+
 /******************************************************************************/
 /**
  * Retrieve the number of bins in x-direction
@@ -2596,6 +3139,11 @@ void GHistogram2D::compare_(
 	compare_t(IDENTITY(minY_, p_load->minY_), token);
 	compare_t(IDENTITY(maxY_, p_load->maxY_), token);
 	compare_t(IDENTITY(dropt_, p_load->dropt_), token);
+	compare_t(IDENTITY(m_streaming, p_load->m_streaming), token);
+	compare_t(IDENTITY(m_adaptiveX, p_load->m_adaptiveX), token);
+	compare_t(IDENTITY(m_adaptiveY, p_load->m_adaptiveY), token);
+	compare_t(IDENTITY(m_binContents, p_load->m_binContents), token);
+	compare_t(IDENTITY(m_nEntries, p_load->m_nEntries), token);
 
 	// React on deviations from the expectation
 	token.evaluate();
@@ -2628,6 +3176,11 @@ void GHistogram2D::load_(const GBasePlotter* cp) {
 	minY_     = p_load->minY_;
 	maxY_     = p_load->maxY_;
 	dropt_    = p_load->dropt_;
+	m_streaming   = p_load->m_streaming;
+	m_adaptiveX   = p_load->m_adaptiveX;
+	m_adaptiveY   = p_load->m_adaptiveY;
+	m_binContents = p_load->m_binContents;
+	m_nEntries    = p_load->m_nEntries;
 }
 
 /******************************************************************************/
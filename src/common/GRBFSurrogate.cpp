@@ -0,0 +1,321 @@
+/********************************************************************************
+ *
+ * This file is part of the Geneva library collection. The following license
+ * applies to this file:
+ *
+ * ------------------------------------------------------------------------------
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * ------------------------------------------------------------------------------
+ *
+ * Note that other files in the Geneva library collection may use a different
+ * license. Please see the licensing information in each file.
+ *
+ ********************************************************************************
+ *
+ * Geneva was started by Dr. Rüdiger Berlich and was later maintained together
+ * with Dr. Ariel Garcia under the auspices of Gemfony scientific. For further
+ * information on Gemfony scientific, see http://www.gemfomy.eu .
+ *
+ * The majority of files in Geneva was released under the Apache license v2.0
+ * in February 2020.
+ *
+ * See the NOTICE file in the top-level directory of the Geneva library
+ * collection for a list of contributors and copyright information.
+ *
+ ********************************************************************************/
+
+#include "common/GRBFSurrogate.hpp"
+
+namespace Gem {
+namespace Common {
+
+/******************************************************************************/
+/**
+ * Initialization with the number of neighbours and the archive size
+ *
+ * @param nNeighbors The number of nearest neighbours taking part in each prediction
+ * @param maxArchiveSize The maximum number of samples stored in the model
+ */
+GRBFSurrogate::GRBFSurrogate(
+	std::size_t nNeighbors
+	, std::size_t maxArchiveSize
+)
+	: m_nNeighbors(nNeighbors)
+	, m_maxArchiveSize(maxArchiveSize)
+{
+	if(0 == m_nNeighbors || m_maxArchiveSize < m_nNeighbors) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG, time_and_place)
+				<< "In GRBFSurrogate::GRBFSurrogate(): Error!" << std::endl
+				<< "Invalid number of neighbours " << m_nNeighbors << " for archive size " << m_maxArchiveSize << std::endl
+		);
+	}
+}
+
+/******************************************************************************/
+/**
+ * Adds a sample to the archive. Once the archive is full, the oldest sample
+ * is replaced. Samples with non-finite values are ignored, as they would
+ * render the interpolation useless.
+ *
+ * @param position The position of the sample
+ * @param value The function value at this position
+ */
+void GRBFSurrogate::addSample(const std::vector<double>& position, double value) {
+	if(0 == m_nDims) {
+		if(position.empty()) {
+			throw gemfony_exception(
+				g_error_streamer(DO_LOG, time_and_place)
+					<< "In GRBFSurrogate::addSample(): Error!" << std::endl
+					<< "Received empty position vector" << std::endl
+			);
+		}
+		m_nDims = position.size();
+	} else if(position.size() != m_nDims) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG, time_and_place)
+				<< "In GRBFSurrogate::addSample(): Error!" << std::endl
+				<< "Invalid dimension " << position.size() << " (expected " << m_nDims << ")" << std::endl
+		);
+	}
+
+	if(not std::isfinite(value)) return;
+
+	if(m_values.size() < m_maxArchiveSize) {
+		m_positions.insert(m_positions.end(), position.begin(), position.end());
+		m_values.push_back(value);
+	} else {
+		std::copy(position.begin(), position.end(), m_positions.begin() + m_oldest*m_nDims);
+		m_values.at(m_oldest) = value;
+		m_oldest = (m_oldest + 1) % m_maxArchiveSize;
+	}
+}
+
+/******************************************************************************/
+/**
+ * Recalculates the per-dimension normalization of the model from the samples
+ * currently held in the archive. Predictions use the normalization of the
+ * last call to this function, so that callers may decide how often the
+ * model should be refreshed.
+ */
+void GRBFSurrogate::update() {
+	if(m_values.empty()) return;
+
+	std::vector<double> lower(m_nDims, std::numeric_limits<double>::max());
+	std::vector<double> upper(m_nDims, std::numeric_limits<double>::lowest());
+
+	for(std::size_t i=0; i<m_values.size(); i++) {
+		const double *row = m_positions.data() + i*m_nDims;
+		for(std::size_t d=0; d<m_nDims; d++) {
+			lower[d] = (std::min)(lower[d], row[d]);
+			upper[d] = (std::max)(upper[d], row[d]);
+		}
+	}
+
+	m_scale.resize(m_nDims);
+	for(std::size_t d=0; d<m_nDims; d++) {
+		double range = upper[d] - lower[d];
+		m_scale[d] = range > 0. ? 1./range : 1.;
+	}
+
+	m_updated = true;
+}
+
+/******************************************************************************/
+/**
+ * Predicts the value of the modelled function at a given position. Only the
+ * m_nNeighbors nearest samples are taken into account, so that the cost of a
+ * prediction is dominated by a single linear pass over the archive.
+ *
+ * @param position The position for which a prediction should be made
+ * @return The predicted function value
+ */
+double GRBFSurrogate::predict(const std::vector<double>& position) const {
+	if(m_values.empty() || position.size() != m_nDims) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG, time_and_place)
+				<< "In GRBFSurrogate::predict(): Error!" << std::endl
+				<< "Got position of dimension " << position.size() << " for a model of dimension " << m_nDims << std::endl
+				<< "holding " << m_values.size() << " samples" << std::endl
+		);
+	}
+
+	const std::size_t nSamples = m_values.size();
+	const bool scaled = (m_scale.size() == m_nDims);
+
+	// Squared normalized distances to all samples
+	std::vector<std::pair<double, std::size_t>> dist(nSamples);
+	for(std::size_t i=0; i<nSamples; i++) {
+		const double *row = m_positions.data() + i*m_nDims;
+		double d2 = 0.;
+		for(std::size_t d=0; d<m_nDims; d++) {
+			double diff = (position[d] - row[d]) * (scaled ? m_scale[d] : 1.);
+			d2 += diff*diff;
+		}
+		dist[i] = std::make_pair(d2, i);
+	}
+
+	const std::size_t k = (std::min)(m_nNeighbors, nSamples);
+	std::nth_element(dist.begin(), dist.begin() + (k-1), dist.end());
+	std::sort(dist.begin(), dist.begin() + k);
+
+	// Exact hit -- no need to interpolate
+	if(0. == dist[0].first) return m_values[dist[0].second];
+
+	// Kernel width and mean of the neighbourhood
+	double sigma = 0., mean = 0.;
+	for(std::size_t i=0; i<k; i++) {
+		sigma += std::sqrt(dist[i].first);
+		mean += m_values[dist[i].second];
+	}
+	sigma /= double(k);
+	mean /= double(k);
+	const double denom = 2.*sigma*sigma;
+
+	// Set up the local interpolation system
+	std::vector<double> phi(k*k);
+	std::vector<double> w(k);
+	for(std::size_t i=0; i<k; i++) {
+		const double *ri = m_positions.data() + dist[i].second*m_nDims;
+		for(std::size_t j=0; j<=i; j++) {
+			const double *rj = m_positions.data() + dist[j].second*m_nDims;
+			double d2 = 0.;
+			for(std::size_t d=0; d<m_nDims; d++) {
+				double diff = (ri[d] - rj[d]) * (scaled ? m_scale[d] : 1.);
+				d2 += diff*diff;
+			}
+			phi[i*k + j] = phi[j*k + i] = std::exp(-d2/denom);
+		}
+		phi[i*k + i] += DEFAULTRBFREGULARIZATION;
+		w[i] = m_values[dist[i].second] - mean;
+	}
+
+	if(choleskySolve(phi, w, k)) {
+		double result = mean;
+		for(std::size_t i=0; i<k; i++) {
+			result += w[i] * std::exp(-dist[i].first/denom);
+		}
+		if(std::isfinite(result)) return result;
+	}
+
+	// Fall back to inverse-distance weighting
+	double wsum = 0., fsum = 0.;
+	for(std::size_t i=0; i<k; i++) {
+		double weight = 1./dist[i].first;
+		wsum += weight;
+		fsum += weight * m_values[dist[i].second];
+	}
+	return fsum/wsum;
+}
+
+/******************************************************************************/
+/**
+ * Removes all samples from the archive
+ */
+void GRBFSurrogate::clear() {
+	m_positions.clear();
+	m_values.clear();
+	m_scale.clear();
+	m_oldest = 0;
+	m_nDims = 0;
+	m_updated = false;
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the number of samples currently stored in the archive
+ */
+std::size_t GRBFSurrogate::size() const {
+	return m_values.size();
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the number of dimensions of the model (0 if no samples were added yet)
+ */
+std::size_t GRBFSurrogate::getNDimensions() const {
+	return m_nDims;
+}
+
+/******************************************************************************/
+/**
+ * Checks whether the model has enough information to make predictions,
+ * i.e. whether it holds at least as many samples as are used for a single
+ * prediction and update() has been called at least once.
+ */
+bool GRBFSurrogate::isReady() const {
+	return m_updated && m_values.size() >= m_nNeighbors;
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the number of neighbours used for each prediction
+ */
+std::size_t GRBFSurrogate::getNNeighbors() const {
+	return m_nNeighbors;
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the maximum number of samples held in the archive
+ */
+std::size_t GRBFSurrogate::getMaxArchiveSize() const {
+	return m_maxArchiveSize;
+}
+
+/******************************************************************************/
+/**
+ * Solves the symmetric positive definite system a*x = b through a Cholesky
+ * decomposition. Both a and b are overwritten, the solution is returned in b.
+ *
+ * @param a The n*n matrix in row-major order
+ * @param b The right-hand side, holding the solution upon return
+ * @param n The dimension of the system
+ * @return false if the matrix was found not to be positive definite
+ */
+bool GRBFSurrogate::choleskySolve(std::vector<double>& a, std::vector<double>& b, std::size_t n) {
+	// Decomposition a = l*l^T, l stored in the lower triangle of a
+	for(std::size_t j=0; j<n; j++) {
+		double s = a[j*n + j];
+		for(std::size_t p=0; p<j; p++) s -= a[j*n + p]*a[j*n + p];
+		if(s <= 0. || not std::isfinite(s)) return false;
+		const double ljj = std::sqrt(s);
+		a[j*n + j] = ljj;
+		for(std::size_t i=j+1; i<n; i++) {
+			double t = a[i*n + j];
+			for(std::size_t p=0; p<j; p++) t -= a[i*n + p]*a[j*n + p];
+			a[i*n + j] = t/ljj;
+		}
+	}
+
+	// Forward substitution l*y = b
+	for(std::size_t i=0; i<n; i++) {
+		double t = b[i];
+		for(std::size_t p=0; p<i; p++) t -= a[i*n + p]*b[p];
+		b[i] = t/a[i*n + i];
+	}
+
+	// Backward substitution l^T*x = y
+	for(std::size_t i=n; i-- > 0;) {
+		double t = b[i];
+		for(std::size_t p=i+1; p<n; p++) t -= a[p*n + i]*b[p];
+		b[i] = t/a[i*n + i];
+	}
+
+	return true;
+}
+
+/******************************************************************************/
+
+} /* namespace Common */
+} /* namespace Gem */
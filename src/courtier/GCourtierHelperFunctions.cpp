@@ -127,6 +127,9 @@ G_API_COURTIER std::string psToStr(const processingStatus& ps) {
 
 		case processingStatus::ERROR_FLAGGED:
 			return "ERROR_FLAGGED";
+
+		case processingStatus::CANCELLED:
+			return "CANCELLED";
 	}
 
 	// Make the compiler happy
@@ -39,6 +39,92 @@
 BOOST_CLASS_EXPORT_IMPLEMENT(Gem::Geneva::GExternalEvaluatorIndividual)
 BOOST_CLASS_EXPORT_IMPLEMENT(Gem::Geneva::GExternalEvaluatorIndividualFactory)
 
+namespace {
+	/**
+	 * Retrieves the persistent evaluator process for a given command line, owned by the
+	 * calling thread. Processes are started lazily and terminated when the thread exits.
+	 */
+	Gem::Common::GExternalProcess& getPersistentEvaluator(std::string const& command) {
+		thread_local std::map<std::string, std::unique_ptr<Gem::Common::GExternalProcess>> processes;
+
+		std::unique_ptr<Gem::Common::GExternalProcess>& process_ptr = processes[command];
+		if (not process_ptr) {
+			process_ptr.reset(new Gem::Common::GExternalProcess(command));
+		}
+		return *process_ptr;
+	}
+
+	/** Appends a little-endian uint32 to a message */
+	void appendUInt32(std::string& message, std::uint32_t value) {
+		for (std::size_t i = 0; i < 4; i++) {
+			message.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+		}
+	}
+
+	/** Appends a little-endian float64 to a message */
+	void appendDouble(std::string& message, double value) {
+		static_assert(sizeof(double) == sizeof(std::uint64_t), "double is expected to be a 64 bit IEEE 754 number");
+
+		std::uint64_t bits;
+		std::memcpy(&bits, &value, sizeof(bits));
+		for (std::size_t i = 0; i < 8; i++) {
+			message.push_back(static_cast<char>((bits >> (8 * i)) & 0xFF));
+		}
+	}
+
+	/** Appends a string, preceded by its length, to a message */
+	void appendString(std::string& message, std::string const& value) {
+		appendUInt32(message, static_cast<std::uint32_t>(value.size()));
+		message += value;
+	}
+
+	/** Checks that a message holds the given number of bytes beyond the current position */
+	void checkMessageSize(std::string const& message, std::size_t pos, std::size_t nBytes) {
+		if (message.size() < pos || message.size() - pos < nBytes) {
+			throw gemfony_exception(
+				g_error_streamer(DO_LOG,  time_and_place)
+					<< "In GExternalEvaluatorIndividual::persistentFitnessCalculation(): Error!" << std::endl
+					<< "Response of size " << message.size() << " ends prematurely at position " << pos << std::endl
+			);
+		}
+	}
+
+	/** Extracts a little-endian uint32 from a message */
+	std::uint32_t readUInt32(std::string const& message, std::size_t& pos) {
+		checkMessageSize(message, pos, 4);
+
+		std::uint32_t value = 0;
+		for (std::size_t i = 0; i < 4; i++) {
+			value |= std::uint32_t(static_cast<unsigned char>(message[pos++])) << (8 * i);
+		}
+		return value;
+	}
+
+	/** Extracts a little-endian float64 from a message */
+	double readDouble(std::string const& message, std::size_t& pos) {
+		checkMessageSize(message, pos, 8);
+
+		std::uint64_t bits = 0;
+		for (std::size_t i = 0; i < 8; i++) {
+			bits |= std::uint64_t(static_cast<unsigned char>(message[pos++])) << (8 * i);
+		}
+
+		double value;
+		std::memcpy(&value, &bits, sizeof(value));
+		return value;
+	}
+
+	/** Extracts a string, preceded by its length, from a message */
+	std::string readString(std::string const& message, std::size_t& pos) {
+		std::size_t size = readUInt32(message, pos);
+		checkMessageSize(message, pos, size);
+
+		std::string value = message.substr(pos, size);
+		pos += size;
+		return value;
+	}
+}
+
 namespace Gem {
 namespace Geneva {
 
@@ -56,6 +142,7 @@ GExternalEvaluatorIndividual::GExternalEvaluatorIndividual()
 	  , m_n_results(GEEI_DEF_NRESULTS)
 	  , runID_(GEEI_DEF_RUNID)
 	  , m_remove_exec_temporaries(GEEI_DEF_REMOVETEMPORARIES)
+	  , m_use_persistent_evaluator(GEEI_DEF_USEPERSISTENTEVALUATOR)
 { /* nothing */ }
 
 /******************************************************************************/
@@ -70,6 +157,7 @@ GExternalEvaluatorIndividual::GExternalEvaluatorIndividual(const GExternalEvalua
 	  , m_n_results(cp.m_n_results)
 	  , runID_(cp.runID_)
 	  , m_remove_exec_temporaries(cp.m_remove_exec_temporaries)
+	  , m_use_persistent_evaluator(cp.m_use_persistent_evaluator)
 { /* nothing */ }
 
 /******************************************************************************/
@@ -105,6 +193,7 @@ void GExternalEvaluatorIndividual::compare_(
 	Gem::Common::compare_t(IDENTITY(m_n_results, p_load->m_n_results), token);
 	Gem::Common::compare_t(IDENTITY(runID_, p_load->runID_), token);
 	Gem::Common::compare_t(IDENTITY(m_remove_exec_temporaries, p_load->m_remove_exec_temporaries), token);
+	Gem::Common::compare_t(IDENTITY(m_use_persistent_evaluator, p_load->m_use_persistent_evaluator), token);
 
 	// React on deviations from the expectation
 	token.evaluate();
@@ -216,6 +305,7 @@ void GExternalEvaluatorIndividual::load_(const GObject *cp) {
 	m_n_results = p_load->m_n_results;
 	runID_ = p_load->runID_;
 	m_remove_exec_temporaries = p_load->m_remove_exec_temporaries;
+	m_use_persistent_evaluator = p_load->m_use_persistent_evaluator;
 }
 
 /******************************************************************************/
@@ -230,12 +320,28 @@ GObject *GExternalEvaluatorIndividual::clone_() const {
 
 /******************************************************************************/
 /**
- * The actual fitness calculation takes place in an external program. Here we just
- * write a file with the required parameters to disk and execute the program.
+ * The actual fitness calculation takes place in an external program. Depending on
+ * the chosen mode, we either send the parameters to a persistent process owned by
+ * the current thread, or write them to a file and execute the program.
  *
  * @return The primary value of this object
  */
 double GExternalEvaluatorIndividual::fitnessCalculation() {
+	if (m_use_persistent_evaluator) {
+		return this->persistentFitnessCalculation();
+	} else {
+		return this->fileExchangeFitnessCalculation();
+	}
+}
+
+/******************************************************************************/
+/**
+ * Writes a file with the required parameters to disk, executes the external
+ * program and reads back the results from a file written by the program.
+ *
+ * @return The primary value of this object
+ */
+double GExternalEvaluatorIndividual::fileExchangeFitnessCalculation() {
 	// Transform this object into a boost property tree
 	boost::property_tree::ptree ptr_out;
 
@@ -290,23 +396,8 @@ double GExternalEvaluatorIndividual::fitnessCalculation() {
 			<< "Program output:" << std::endl
 			<< Gem::Common::loadTextDataFromFile(commandOutputFileName) << std::endl;
 
-#ifdef DEBUG
-		glogger
-			<< error_message.str()
-			<< GWARNING;
-#endif
-
 		// O.k., so the external application crashed or returned an error.
-		// All we can do here is to return the worst case. As long as crashes
-		// do not happen too often, this will have but little influence on
-		// the optimization.
-		main_result = this->getWorstCase();
-		for (std::size_t res = 1; res < m_n_results; res++) {
-			this->setResult(res, this->getWorstCase());
-		}
-
-		// Make sure the individual can be recognized as invalid by Geneva
-		this->force_set_error(error_message.str());
+		main_result = this->markAsFailed(error_message.str());
 	} else { // Everything is o.k., lets retrieve the evaluation
 		// Check that the result file exists
 		if (not bf::exists(resultFileName)) {
@@ -376,19 +467,7 @@ double GExternalEvaluatorIndividual::fitnessCalculation() {
 				<< "In GExternalEvaluatorIndividual::fitnessCalculation():" << std::endl
 				<< "batch.individuals.individual0.isValid is \"false\"" << std::endl;
 
-#ifdef DEBUG
-			glogger
-				<< error_message.str()
-				<< GWARNING;
-#endif
-
-			main_result = this->getWorstCase();
-			for (std::size_t res = 1; res < m_n_results; res++) {
-				this->setResult(res, this->getWorstCase());
-			}
-
-			// Make sure the individual can be recognized as invalid by Geneva
-			this->force_set_error(error_message.str());
+			main_result = this->markAsFailed(error_message.str());
 		} else { // Extract and store all result values
 			// Get the results node
 			pt::ptree resultsNode = ptr_in.get_child("batch.individuals.individual0.results");
@@ -420,6 +499,144 @@ double GExternalEvaluatorIndividual::fitnessCalculation() {
 	return main_result;
 }
 
+/******************************************************************************/
+/**
+ * Sends the parameters of this object to the external program, which stays alive
+ * between evaluations. Each thread owns its own process, which is started with the
+ * --serve switch upon its first evaluation and restarted after crashes. See the
+ * class description for the message format.
+ *
+ * @return The primary value of this object
+ */
+double GExternalEvaluatorIndividual::persistentFitnessCalculation() {
+	// Assemble the request
+	std::vector<double> doubleValues;
+	std::vector<std::int32_t> intValues;
+	std::vector<bool> boolValues;
+	this->streamline<double>(doubleValues, activityMode::ALLPARAMETERS);
+	this->streamline<std::int32_t>(intValues, activityMode::ALLPARAMETERS);
+	this->streamline<bool>(boolValues, activityMode::ALLPARAMETERS);
+
+	std::string request;
+	request.reserve(16 + 64 + 8 * doubleValues.size() + 4 * intValues.size() + boolValues.size());
+
+	appendUInt32(request, this->getAssignedIteration());
+	appendString(request, this->getCurrentEvaluationID());
+	appendUInt32(request, static_cast<std::uint32_t>(doubleValues.size()));
+	for (auto value: doubleValues) {
+		appendDouble(request, value);
+	}
+	appendUInt32(request, static_cast<std::uint32_t>(intValues.size()));
+	for (auto value: intValues) {
+		appendUInt32(request, static_cast<std::uint32_t>(value));
+	}
+	appendUInt32(request, static_cast<std::uint32_t>(boolValues.size()));
+	for (auto value: boolValues) {
+		request.push_back(value ? char(1) : char(0));
+	}
+
+	// Assemble the command line of the external program
+	std::string command = boost::filesystem::path(m_program_name).make_preferred().string();
+	if (m_custom_options != "empty" && not m_custom_options.empty()) {
+		command += std::string(" ") + m_custom_options;
+	}
+	command += std::string(" --serve");
+
+	// Perform the external evaluation
+	std::string response;
+	Gem::Common::GExternalProcess& evaluator = getPersistentEvaluator(command);
+	if (not evaluator.exchange(request, response)) {
+		// The external program crashed. It will be restarted for the next evaluation.
+		std::ostringstream error_message;
+
+		error_message
+			<< "In GExternalEvaluatorIndividual::fitnessCalculation():" << std::endl
+			<< "Evaluation by persistent external program failed:" << std::endl
+			<< evaluator.getLastError() << std::endl;
+
+		return this->markAsFailed(error_message.str());
+	}
+
+	// Parse the response
+	std::size_t pos = 0;
+	checkMessageSize(response, pos, 1);
+	bool isValid = (0 != response[pos++]);
+
+	// Check that the evaluation id matches our local id
+	std::string externalEvaluationID = readString(response, pos);
+	if (externalEvaluationID != this->getCurrentEvaluationID()) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG,  time_and_place)
+				<< "In GExternalEvaluatorIndividual::persistentFitnessCalculation(): Error!" << std::endl
+				<< "Local evaluation id " << this->getCurrentEvaluationID() << " does not match external id " << externalEvaluationID << std::endl
+		);
+	}
+
+	// Check that the number of results matches the number of expected results
+	std::size_t externalNResults = readUInt32(response, pos);
+	if (externalNResults != m_n_results) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG,  time_and_place)
+				<< "In GExternalEvaluatorIndividual::persistentFitnessCalculation(): Error!" << std::endl
+				<< "Response provides nResults = " << externalNResults << std::endl
+				<< "while we expected " << m_n_results << std::endl
+		);
+	}
+
+	std::vector<double> results(m_n_results);
+	for (std::size_t res = 0; res < m_n_results; res++) {
+		results[res] = readDouble(response, pos);
+	}
+
+	if (pos != response.size()) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG,  time_and_place)
+				<< "In GExternalEvaluatorIndividual::persistentFitnessCalculation(): Error!" << std::endl
+				<< "Response holds " << response.size() - pos << " unexpected trailing bytes" << std::endl
+		);
+	}
+
+	if (not isValid) { // Assign worst-case values to all results
+		return this->markAsFailed(
+			"In GExternalEvaluatorIndividual::fitnessCalculation():\nThe external program marked the evaluation as invalid\n"
+		);
+	}
+
+	for (std::size_t res = 0; res < m_n_results; res++) {
+		this->setResult(res, results[res]);
+	}
+
+	// Return the master result (first result returned)
+	return results[0];
+}
+
+/******************************************************************************/
+/**
+ * Assigns the worst case to all secondary results and marks this object as
+ * invalid. This is used when the external program crashed or returned an error.
+ * As long as this does not happen too often, it will have but little influence
+ * on the optimization.
+ *
+ * @param error_message A description of the failure
+ * @return The worst case, to be used as the primary result
+ */
+double GExternalEvaluatorIndividual::markAsFailed(std::string const& error_message) {
+#ifdef DEBUG
+	glogger
+		<< error_message
+		<< GWARNING;
+#endif
+
+	for (std::size_t res = 1; res < m_n_results; res++) {
+		this->setResult(res, this->getWorstCase());
+	}
+
+	// Make sure the individual can be recognized as invalid by Geneva
+	this->force_set_error(error_message);
+
+	return this->getWorstCase();
+}
+
 /******************************************************************************/
 /**
  * Allows to assign a run-id to this individual
@@ -461,6 +678,25 @@ bool GExternalEvaluatorIndividual::getRemoveExecTemporaries() const {
 	return m_remove_exec_temporaries;
 }
 
+/******************************************************************************/
+/**
+ * Allows to specify whether evaluations should be sent to a persistent external
+ * process (true) or whether the external program should be started anew for each
+ * evaluation, exchanging data through files (false). The latter mode is needed
+ * for programs not supporting the --serve switch.
+ */
+void GExternalEvaluatorIndividual::setUsePersistentEvaluator(bool usePersistentEvaluator) {
+	m_use_persistent_evaluator = usePersistentEvaluator;
+}
+
+/******************************************************************************/
+/**
+ * Allows to check whether evaluations are sent to a persistent external process
+ */
+bool GExternalEvaluatorIndividual::getUsePersistentEvaluator() const {
+	return m_use_persistent_evaluator;
+}
+
 /******************************************************************************/
 ////////////////////////////////////////////////////////////////////////////////
 /******************************************************************************/
@@ -483,7 +719,8 @@ GExternalEvaluatorIndividualFactory::GExternalEvaluatorIndividualFactory(
 	m_delta(GEEI_DEF_DELTA), m_sigmaDelta(GEEI_DEF_SIGMADELTA), m_minDelta(GEEI_DEF_MINDELTA),
 	m_maxDelta(GEEI_DEF_MAXDELTA), m_programName(GEEI_DEF_PROGNAME), m_customOptions(GEEI_DEF_CUSTOMOPTIONS),
 	m_parameterFileBaseName(GEEI_DEF_PARFILEBASENAME), m_initValues(GEEI_DEF_STARTMODE),
-	m_removeExecTemporaries(GEEI_DEF_REMOVETEMPORARIES), m_externalEvaluatorQueried(false) { /* nothing */ }
+	m_removeExecTemporaries(GEEI_DEF_REMOVETEMPORARIES), m_usePersistentEvaluator(GEEI_DEF_USEPERSISTENTEVALUATOR),
+	m_externalEvaluatorQueried(false) { /* nothing */ }
 
 /******************************************************************************/
 /**
@@ -499,7 +736,8 @@ GExternalEvaluatorIndividualFactory::GExternalEvaluatorIndividualFactory(
 	m_maxSigma2(cp.m_maxSigma2), m_delta(cp.m_delta), m_sigmaDelta(cp.m_sigmaDelta), m_minDelta(cp.m_minDelta),
 	m_maxDelta(cp.m_maxDelta), m_programName(cp.m_programName), m_customOptions(cp.m_customOptions),
 	m_parameterFileBaseName(cp.m_parameterFileBaseName), m_initValues(cp.m_initValues),
-	m_removeExecTemporaries(cp.m_removeExecTemporaries), m_externalEvaluatorQueried(cp.m_externalEvaluatorQueried),
+	m_removeExecTemporaries(cp.m_removeExecTemporaries), m_usePersistentEvaluator(cp.m_usePersistentEvaluator),
+	m_externalEvaluatorQueried(cp.m_externalEvaluatorQueried),
 	m_ptr(cp.m_ptr) { /* nothing */ }
 
 /******************************************************************************/
@@ -515,7 +753,8 @@ GExternalEvaluatorIndividualFactory::GExternalEvaluatorIndividualFactory()
 	m_delta(GEEI_DEF_DELTA), m_sigmaDelta(GEEI_DEF_SIGMADELTA), m_minDelta(GEEI_DEF_MINDELTA),
 	m_maxDelta(GEEI_DEF_MAXDELTA), m_programName(GEEI_DEF_PROGNAME), m_customOptions(GEEI_DEF_CUSTOMOPTIONS),
 	m_parameterFileBaseName(GEEI_DEF_PARFILEBASENAME), m_initValues(GEEI_DEF_STARTMODE),
-	m_removeExecTemporaries(GEEI_DEF_REMOVETEMPORARIES), m_externalEvaluatorQueried(false) { /* nothing */ }
+	m_removeExecTemporaries(GEEI_DEF_REMOVETEMPORARIES), m_usePersistentEvaluator(GEEI_DEF_USEPERSISTENTEVALUATOR),
+	m_externalEvaluatorQueried(false) { /* nothing */ }
 
 /******************************************************************************/
 /**
@@ -601,6 +840,7 @@ void GExternalEvaluatorIndividualFactory::load(std::shared_ptr < Gem::Common::GF
 	m_parameterFileBaseName = cp_ptr->m_parameterFileBaseName;
 	m_initValues = cp_ptr->m_initValues;
 	m_removeExecTemporaries = cp_ptr->m_removeExecTemporaries;
+	m_usePersistentEvaluator = cp_ptr->m_usePersistentEvaluator;
 	m_externalEvaluatorQueried = cp_ptr->m_externalEvaluatorQueried;
 	m_ptr = cp_ptr->m_ptr;
 }
@@ -1156,6 +1396,22 @@ bool GExternalEvaluatorIndividualFactory::getRemoveExecTemporaries() const {
 	return m_removeExecTemporaries;
 }
 
+/******************************************************************************/
+/**
+ * Allows to specify whether evaluations should be sent to a persistent external process
+ */
+void GExternalEvaluatorIndividualFactory::setUsePersistentEvaluator(bool usePersistentEvaluator) {
+	m_usePersistentEvaluator.setValue(usePersistentEvaluator);
+}
+
+/******************************************************************************/
+/**
+ * Allows to check whether evaluations are sent to a persistent external process
+ */
+bool GExternalEvaluatorIndividualFactory::getUsePersistentEvaluator() const {
+	return m_usePersistentEvaluator;
+}
+
 /******************************************************************************/
 /**
  * Submit work items to the external executable for archiving
@@ -1395,6 +1651,13 @@ void GExternalEvaluatorIndividualFactory::describeLocalOptions_(Gem::Common::GPa
 		"removeExecTemporaries", m_removeExecTemporaries.reference(), GEEI_DEF_REMOVETEMPORARIES
 	)
 		<< "Indicates, whether files created during external execution should be removed";
+
+	gpb.registerFileParameter<bool>(
+		"usePersistentEvaluator", m_usePersistentEvaluator.reference(), GEEI_DEF_USEPERSISTENTEVALUATOR
+	)
+		<< "Indicates, whether each evaluation thread should keep the external program running" << std::endl
+		<< "(started with --serve) and exchange messages with it, instead of starting it" << std::endl
+		<< "and exchanging files for every evaluation";
 }
 
 /******************************************************************************/
@@ -1690,6 +1953,7 @@ void GExternalEvaluatorIndividualFactory::postProcess_(std::shared_ptr < GParame
 		p->setCustomOptions(m_customOptions);
 		p->setNExpectedResults(nResultsExpected);
 		p->setRemoveExecTemporaries(m_removeExecTemporaries);
+		p->setUsePersistentEvaluator(m_usePersistentEvaluator);
 		p->setRunId(runID);
 	} catch (const pt::ptree_bad_path &e) {
 		throw gemfony_exception(
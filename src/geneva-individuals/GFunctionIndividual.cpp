@@ -609,6 +609,111 @@ void GFunctionIndividual::specificTestsNoFailureExpected_GUnitTests_() {
 	// Call the parent classes' functions
 	Gem::Geneva::GParameterSet::specificTestsNoFailureExpected_GUnitTests_();
 
+	//------------------------------------------------------------------------------
+
+	{ // Check that incremental evaluation yields the same results as a full evaluation
+		const std::size_t nParameters = 100;
+		const std::size_t nAdaptions = 20;
+
+		std::vector<solverFunction> separableFunctions {
+			solverFunction::PARABOLA
+			, solverFunction::RASTRIGIN
+			, solverFunction::SCHWEFEL
+			, solverFunction::NEGPARABOLA
+		};
+
+		for(auto const& sf: separableFunctions) {
+			std::shared_ptr<GFunctionIndividual> p_inc = this->clone<GFunctionIndividual>();
+			p_inc->clear();
+			p_inc->setDemoFunction(sf);
+
+			// Few adaptions per call, so that only a small number of parameters changes
+			std::shared_ptr<GDoubleGaussAdaptor> gdga_ptr(new GDoubleGaussAdaptor(0.1, 0.1, 0., 1., 0.05));
+			std::shared_ptr<GDoubleCollection> gdc_ptr(new GDoubleCollection(nParameters, -10., 10.));
+			gdc_ptr->addAdaptor(gdga_ptr);
+			p_inc->push_back(gdc_ptr);
+
+			BOOST_CHECK_NO_THROW(p_inc->setUseIncrementalEvaluation(true));
+			BOOST_CHECK(p_inc->getUseIncrementalEvaluation());
+			BOOST_CHECK(not p_inc->hasDeltaReference());
+
+			p_inc->mark_as_due_for_processing();
+			BOOST_CHECK_NO_THROW(p_inc->process());
+
+			for(std::size_t i=0; i<nAdaptions; i++) {
+				BOOST_CHECK_NO_THROW(p_inc->adapt());
+				BOOST_CHECK(p_inc->hasDeltaReference());
+				BOOST_CHECK(p_inc->getChangedParameterPositions().size() < nParameters);
+
+				// The reference individual is always evaluated from scratch
+				std::shared_ptr<GFunctionIndividual> p_full = p_inc->clone<GFunctionIndividual>();
+				BOOST_CHECK_NO_THROW(p_full->setUseIncrementalEvaluation(false));
+				BOOST_CHECK(not p_full->hasDeltaReference());
+
+				BOOST_CHECK_NO_THROW(p_inc->process());
+				BOOST_CHECK_NO_THROW(p_full->process());
+				BOOST_CHECK(not p_inc->hasDeltaReference());
+
+				double f_inc = p_inc->raw_fitness(0);
+				double f_full = p_full->raw_fitness(0);
+				BOOST_CHECK_MESSAGE(
+					std::fabs(f_inc - f_full) <= 1e-8 * (std::max)(1., std::fabs(f_full))
+					, "\n"
+					<< "Incremental and full evaluation differ for " << getStringRepresentation(sf) << ": "
+					<< f_inc << " / " << f_full << "\n"
+				);
+			}
+		}
+	}
+
+	//------------------------------------------------------------------------------
+
+	{ // Check that batch evaluation yields the same results as the evaluation of individual items
+		const std::size_t nParameters = 10;
+		const std::size_t nItems = 20;
+
+		for(std::size_t f = 0; f <= static_cast<std::size_t>(MAXDEMOFUNCTION); f++) {
+			solverFunction sf = static_cast<solverFunction>(f);
+
+			std::vector<std::shared_ptr<GParameterSet>> batch_cnt;
+			std::vector<std::shared_ptr<GParameterSet>> single_cnt;
+			for(std::size_t i=0; i<nItems; i++) {
+				std::shared_ptr<GFunctionIndividual> p_batch = this->clone<GFunctionIndividual>();
+				p_batch->clear();
+				p_batch->setDemoFunction(sf);
+				p_batch->push_back(std::shared_ptr<GDoubleCollection>(new GDoubleCollection(nParameters, -10., 10.)));
+				BOOST_CHECK_NO_THROW(p_batch->randomInit(activityMode::ALLPARAMETERS));
+				BOOST_CHECK_NO_THROW(p_batch->setUseBatchEvaluation(true));
+				p_batch->mark_as_due_for_processing();
+
+				std::shared_ptr<GFunctionIndividual> p_single = p_batch->clone<GFunctionIndividual>();
+				BOOST_CHECK_NO_THROW(p_single->setUseBatchEvaluation(false));
+
+				batch_cnt.push_back(p_batch);
+				single_cnt.push_back(p_single);
+			}
+
+			// Items without batch support enabled are left to process()
+			BOOST_CHECK(not GParameterSet::batchEvaluation(single_cnt));
+			BOOST_CHECK(not single_cnt.front()->hasPrecomputedFitness());
+
+			BOOST_CHECK(GParameterSet::batchEvaluation(batch_cnt));
+			for(std::size_t i=0; i<nItems; i++) {
+				BOOST_CHECK(batch_cnt[i]->hasPrecomputedFitness());
+				BOOST_CHECK_NO_THROW(batch_cnt[i]->process());
+				BOOST_CHECK_NO_THROW(single_cnt[i]->process());
+				BOOST_CHECK(not batch_cnt[i]->hasPrecomputedFitness());
+
+				BOOST_CHECK_MESSAGE(
+					batch_cnt[i]->raw_fitness(0) == single_cnt[i]->raw_fitness(0)
+					, "\n"
+					<< "Batch and single evaluation differ for " << getStringRepresentation(sf) << ": "
+					<< batch_cnt[i]->raw_fitness(0) << " / " << single_cnt[i]->raw_fitness(0) << "\n"
+				);
+			}
+		}
+	}
+
 	//------------------------------------------------------------------------------
 	//------------------------------------------------------------------------------
 
@@ -647,20 +752,70 @@ void GFunctionIndividual::specificTestsFailuresExpected_GUnitTests_() {
  * @return The value of this object, as calculated with the evaluation function
  */
 double GFunctionIndividual::fitnessCalculation() {
-	double result = 0;
-
 	// Retrieve the parameters
 	std::vector<double> parVec;
 	this->streamline(parVec);
-	std::size_t parameterSize = parVec.size();
+
+	return GFunctionIndividual::functionValue(demoFunction_, parVec.data(), parVec.size());
+}
+
+/******************************************************************************/
+/**
+ * Evaluates the main fitness for an entire population in one go. The parameter
+ * matrix holds one row of active double parameters per individual, so each
+ * row may be evaluated directly from contiguous memory, without the need to
+ * streamline each individual separately.
+ *
+ * @param parameters The parameters of all individuals, one row per individual
+ * @param nParameters The number of parameters in each row
+ * @param results Will hold the raw fitness of each row
+ * @return A boolean indicating whether the batch was evaluated
+ */
+bool GFunctionIndividual::batchFitnessCalculation(
+	std::vector<double> const& parameters
+	, std::size_t nParameters
+	, std::vector<double>& results
+) const {
+	if(0 == nParameters || 0 != parameters.size() % nParameters) {
+		return false;
+	}
+
+	std::size_t nRows = parameters.size() / nParameters;
+	results.resize(nRows);
+	for(std::size_t row = 0; row < nRows; row++) {
+		results[row] = GFunctionIndividual::functionValue(
+			demoFunction_
+			, parameters.data() + row*nParameters
+			, nParameters
+		);
+	}
+
+	return true;
+}
+
+/******************************************************************************/
+/**
+ * Calculates the value of one of the demo functions for a given set of parameters
+ *
+ * @param demoFunction The function to be evaluated
+ * @param x Points to the first of parameterSize parameters
+ * @param parameterSize The number of parameters
+ * @return The function value
+ */
+double GFunctionIndividual::functionValue(
+	solverFunction demoFunction
+	, double const * x
+	, std::size_t parameterSize
+) {
+	double result = 0;
 
 	// Perform the actual calculation
-	switch (demoFunction_) {
+	switch (demoFunction) {
 		//-----------------------------------------------------------
 		// A simple, multi-dimensional parabola
 		case solverFunction::PARABOLA: {
 			for (std::size_t i = 0; i < parameterSize; i++) {
-				result += GSQUARED(parVec[i]);
+				result += GSQUARED(x[i]);
 			}
 		}
 			break;
@@ -670,7 +825,7 @@ double GFunctionIndividual::fitnessCalculation() {
 		case solverFunction::NOISYPARABOLA: {
 			double xsquared = 0.;
 			for (std::size_t i = 0; i < parameterSize; i++) {
-				xsquared += GSQUARED(parVec[i]);
+				xsquared += GSQUARED(x[i]);
 			}
 			result = (cos(xsquared) + 2.) * xsquared;
 		}
@@ -685,14 +840,14 @@ double GFunctionIndividual::fitnessCalculation() {
 			if(parameterSize < 2) {
 				throw gemfony_exception(
 					g_error_streamer(DO_LOG,  time_and_place)
-						<< "In GFunctionIndividual::fitnessCalculation() / ROSENBROCK: Error!" << std::endl
+						<< "In GFunctionIndividual::functionValue() / ROSENBROCK: Error!" << std::endl
 						<< "Need to use at least two input dimensions, but got " << parameterSize << std::endl
 				);
 			}
 #endif /* DEBUG */
 
 			for (std::size_t i = 0; i < (parameterSize - 1); i++) {
-				result += 100. * GSQUARED(GSQUARED(parVec[i]) - parVec[i + 1]) + GSQUARED(1. - parVec[i]);
+				result += 100. * GSQUARED(GSQUARED(x[i]) - x[i + 1]) + GSQUARED(1. - x[i]);
 			}
 		}
 			break;
@@ -705,15 +860,15 @@ double GFunctionIndividual::fitnessCalculation() {
 			if(parameterSize < 2) {
 				throw gemfony_exception(
 					g_error_streamer(DO_LOG,  time_and_place)
-						<< "In GFunctionIndividual::fitnessCalculation() / ACKLEY: Error!" << std::endl
+						<< "In GFunctionIndividual::functionValue() / ACKLEY: Error!" << std::endl
 						<< "Need to use at least two input dimensions, but got " << parameterSize << std::endl
 				);
 			}
 #endif /* DEBUG */
 
 			for (std::size_t i = 0; i < (parameterSize - 1); i++) {
-				result += (exp(-0.2) * sqrt(GSQUARED(parVec[i]) + GSQUARED(parVec[i + 1])) +
-							  3. * (cos(2. * parVec[i]) + sin(2. * parVec[i + 1])));
+				result += (exp(-0.2) * sqrt(GSQUARED(x[i]) + GSQUARED(x[i + 1])) +
+							  3. * (cos(2. * x[i]) + sin(2. * x[i + 1])));
 			}
 		}
 			break;
@@ -724,7 +879,7 @@ double GFunctionIndividual::fitnessCalculation() {
 			result = 10 * double(parameterSize);
 
 			for (std::size_t i = 0; i < parameterSize; i++) {
-				result += (GSQUARED(parVec[i]) - 10. * cos(2 * boost::math::constants::pi<double>() * parVec[i]));
+				result += (GSQUARED(x[i]) - 10. * cos(2 * boost::math::constants::pi<double>() * x[i]));
 			}
 		}
 			break;
@@ -733,7 +888,7 @@ double GFunctionIndividual::fitnessCalculation() {
 			// The Schwefel function (see e.g. http://www.it.lut.fi/ip/evo/functions/node10.html)
 		case solverFunction::SCHWEFEL: {
 			for (std::size_t i = 0; i < parameterSize; i++) {
-				result += -parVec[i] * sin(sqrt(fabs(parVec[i])));
+				result += -x[i] * sin(sqrt(fabs(x[i])));
 			}
 
 			result /= parameterSize;
@@ -745,7 +900,7 @@ double GFunctionIndividual::fitnessCalculation() {
 		case solverFunction::SALOMON: {
 			double sum_root = 0.;
 			for (std::size_t i = 0; i < parameterSize; i++) {
-				sum_root += GSQUARED(parVec[i]);
+				sum_root += GSQUARED(x[i]);
 			}
 			sum_root = sqrt(sum_root);
 
@@ -757,7 +912,7 @@ double GFunctionIndividual::fitnessCalculation() {
 			// A "negative" parabola, used for maximization tests
 		case solverFunction::NEGPARABOLA: {
 			for (std::size_t i = 0; i < parameterSize; i++) {
-				result += GSQUARED(parVec[i]);
+				result += GSQUARED(x[i]);
 			}
 			result *= -1.;
 		}
@@ -770,6 +925,66 @@ double GFunctionIndividual::fitnessCalculation() {
 	return result;
 }
 
+/******************************************************************************/
+/**
+ * Updates the parent's fitness from the changed parameters for the separable
+ * demo functions (parabola, negative parabola, Rastrigin and Schwefel). All
+ * other functions, or deltas covering a large share of the parameters, are
+ * left to the full evaluation in fitnessCalculation().
+ *
+ * @param delta The difference between this individual and its parent
+ * @param main_raw_result Will hold the updated raw fitness
+ * @return A boolean indicating whether the fitness was updated incrementally
+ */
+bool GFunctionIndividual::incrementalFitnessCalculation(
+	parameterset_delta const& delta
+	, double& main_raw_result
+) {
+	std::size_t parameterSize = delta.current_values.size();
+
+	// The delta refers to all double parameters, while fitnessCalculation() only
+	// uses the active ones. Only deal with the case where both are identical.
+	if(parameterSize == 0 || this->countParameters<double>() != parameterSize) {
+		return false;
+	}
+
+	// A full evaluation is just as cheap if most parameters have changed
+	if(2*delta.changed_positions.size() > parameterSize) {
+		return false;
+	}
+
+	// Calculates the contribution of a single parameter to the sum
+	std::function<double(double)> term;
+	switch (demoFunction_) {
+		case solverFunction::PARABOLA:
+			term = [](double x) { return GSQUARED(x); };
+			break;
+
+		case solverFunction::NEGPARABOLA:
+			term = [](double x) { return -GSQUARED(x); };
+			break;
+
+		case solverFunction::RASTRIGIN:
+			term = [](double x) { return GSQUARED(x) - 10. * cos(2 * boost::math::constants::pi<double>() * x); };
+			break;
+
+		case solverFunction::SCHWEFEL:
+			term = [parameterSize](double x) { return -x * sin(sqrt(fabs(x))) / double(parameterSize); };
+			break;
+
+		default:
+			return false;
+	};
+
+	double result = delta.parent_raw_fitness.at(0);
+	for(auto const& pos: delta.changed_positions) {
+		result += term(delta.current_values[pos]) - term(delta.parent_values[pos]);
+	}
+
+	main_raw_result = result;
+	return true;
+}
+
 /******************************************************************************/
 ////////////////////////////////////////////////////////////////////////////////
 /******************************************************************************/
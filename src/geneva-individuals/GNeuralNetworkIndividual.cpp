@@ -264,11 +264,18 @@ void networkData::saveToDisk(const std::string &networkDataFile) const {
 
 /******************************************************************************/
 /**
- * Loads training data from the disc
+ * Loads training data from the disc. Files in the flat binary format (see
+ * saveToBinaryFile()) are detected automatically.
  *
  * @param fileName The name of the file from which data should be loaded
  */
 void networkData::loadFromDisk(const std::string &networkDataFile) {
+	// Binary files are mapped into memory instead of being parsed
+	if (networkData::isBinaryFile(networkDataFile)) {
+		this->loadFromBinaryFile(networkDataFile);
+		return;
+	}
+
 	networkData *nD;
 
 	boost::filesystem::ifstream trDat(networkDataFile.c_str());
@@ -303,6 +310,198 @@ void networkData::loadFromDisk(const std::string &networkDataFile) {
 	Gem::Common::g_delete(nD);
 }
 
+/******************************************************************************/
+/**
+ * Saves the data of this struct to disc in a flat binary format, which may be
+ * loaded without parsing through loadFromBinaryFile(). The layout is
+ * GNN_BINARY_MAGIC, followed by the number of layers and the layer sizes, the
+ * number and values of initialization ranges, the number of training sets and
+ * finally the input and output values of each training set. All counts are
+ * stored as std::uint64_t, all values as double, in host byte order.
+ *
+ * @param networkDataFile The name of the file that data should be saved to
+ */
+void networkData::saveToBinaryFile(const std::string &networkDataFile) const {
+	bf::ofstream trDat(networkDataFile, std::ios::out | std::ios::binary | std::ios::trunc);
+
+	if (not trDat) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG,  time_and_place)
+				<< "In networkData::saveToBinaryFile(const std::string&) : Error!" << std::endl
+				<< "Data file " << networkDataFile << " could not be opened for writing." << std::endl
+		);
+	}
+
+	auto writeCount = [&trDat](std::size_t n) {
+		std::uint64_t n64 = boost::numeric_cast<std::uint64_t>(n);
+		trDat.write(reinterpret_cast<const char *>(&n64), sizeof(std::uint64_t));
+	};
+	auto writeValues = [&trDat](const double *values, std::size_t n) {
+		trDat.write(reinterpret_cast<const char *>(values), n * sizeof(double));
+	};
+
+	trDat.write(GNN_BINARY_MAGIC.data(), GNN_BINARY_MAGIC.size());
+
+	writeCount(this->size());
+	for (auto const &nNodes: *this) {
+		writeCount(nNodes);
+	}
+
+	writeCount(initRange_.size());
+	for (auto const &range: initRange_) {
+		double minmax[2] = {std::get<0>(range), std::get<1>(range)};
+		writeValues(minmax, 2);
+	}
+
+	writeCount(arraySize_);
+	for (std::size_t i = 0; i < arraySize_; i++) {
+		if (not data_[i] || data_[i]->nInputNodes != this->getNInputNodes() || data_[i]->nOutputNodes != this->getNOutputNodes()) {
+			throw gemfony_exception(
+				g_error_streamer(DO_LOG,  time_and_place)
+					<< "In networkData::saveToBinaryFile(const std::string&) : Error!" << std::endl
+					<< "Training set " << i << " is missing or does not match the network architecture" << std::endl
+			);
+		}
+
+		writeValues(data_[i]->Input, data_[i]->nInputNodes);
+		writeValues(data_[i]->Output, data_[i]->nOutputNodes);
+	}
+
+	if (not trDat) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG,  time_and_place)
+				<< "In networkData::saveToBinaryFile(const std::string&) : Error!" << std::endl
+				<< "Writing to data file " << networkDataFile << " failed." << std::endl
+		);
+	}
+
+	trDat.close();
+}
+
+/******************************************************************************/
+/**
+ * Loads training data from a file in the flat binary format written by
+ * saveToBinaryFile(). The file is mapped into memory, so that the training
+ * sets are filled straight from the page cache without any parsing.
+ *
+ * @param networkDataFile The name of the file from which data should be loaded
+ */
+void networkData::loadFromBinaryFile(const std::string &networkDataFile) {
+	namespace bi = boost::interprocess;
+
+	if (not networkData::isBinaryFile(networkDataFile)) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG,  time_and_place)
+				<< "In networkData::loadFromBinaryFile(const std::string&):" << std::endl
+				<< "Data file " << networkDataFile << " does not exist or is not in binary format." << std::endl
+		);
+	}
+
+	bi::file_mapping mappedFile(networkDataFile.c_str(), bi::read_only);
+	bi::mapped_region region(mappedFile, bi::read_only);
+
+	const char *start = static_cast<const char *>(region.get_address());
+	const char *end = start + region.get_size();
+	const char *pos = start + GNN_BINARY_MAGIC.size();
+
+	// Makes sure we do not read beyond the end of the mapped region
+	auto require = [&](std::size_t nBytes) {
+		if (nBytes > static_cast<std::size_t>(end - pos)) {
+			throw gemfony_exception(
+				g_error_streamer(DO_LOG,  time_and_place)
+					<< "In networkData::loadFromBinaryFile(const std::string&):" << std::endl
+					<< "Data file " << networkDataFile << " is truncated." << std::endl
+			);
+		}
+	};
+	auto readCount = [&]() -> std::size_t {
+		require(sizeof(std::uint64_t));
+		std::uint64_t n64;
+		std::memcpy(&n64, pos, sizeof(std::uint64_t));
+		pos += sizeof(std::uint64_t);
+		return boost::numeric_cast<std::size_t>(n64);
+	};
+	auto readValues = [&](double *target, std::size_t n) {
+		require(n * sizeof(double));
+		std::memcpy(target, pos, n * sizeof(double));
+		pos += n * sizeof(double);
+	};
+
+	// The architecture
+	std::size_t nLayers = readCount();
+	if (nLayers < 2) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG,  time_and_place)
+				<< "In networkData::loadFromBinaryFile(const std::string&):" << std::endl
+				<< "Invalid number of layers " << nLayers << " in file " << networkDataFile << std::endl
+		);
+	}
+	this->clear();
+	for (std::size_t i = 0; i < nLayers; i++) {
+		this->push_back(readCount());
+	}
+
+	// The initialization range
+	initRange_.clear();
+	std::size_t nRanges = readCount();
+	for (std::size_t i = 0; i < nRanges; i++) {
+		double minmax[2];
+		readValues(minmax, 2);
+		initRange_.push_back(std::tuple<double, double>(minmax[0], minmax[1]));
+	}
+
+	// The training sets
+	if (data_) {
+		for (std::size_t i = 0; i < arraySize_; i++) {
+			data_[i].reset();
+		}
+	}
+	Gem::Common::g_array_delete(data_);
+	arraySize_ = 0;
+
+	std::size_t nSets = readCount();
+	require(nSets * (this->getNInputNodes() + this->getNOutputNodes()) * sizeof(double));
+
+	data_ = new std::shared_ptr<trainingSet>[nSets];
+	arraySize_ = nSets;
+	for (std::size_t i = 0; i < nSets; i++) {
+		data_[i] = std::shared_ptr<trainingSet>(new trainingSet(this->getNInputNodes(), this->getNOutputNodes()));
+		readValues(data_[i]->Input, data_[i]->nInputNodes);
+		readValues(data_[i]->Output, data_[i]->nOutputNodes);
+	}
+}
+
+/******************************************************************************/
+/**
+ * Checks whether a file holds training data in the flat binary format
+ *
+ * @param networkDataFile The name of the file to be checked
+ * @return A boolean indicating whether the file starts with GNN_BINARY_MAGIC
+ */
+bool networkData::isBinaryFile(const std::string &networkDataFile) {
+	bf::ifstream trDat(networkDataFile, std::ios::in | std::ios::binary);
+	if (not trDat) {
+		return false;
+	}
+
+	std::string magic(GNN_BINARY_MAGIC.size(), '\0');
+	trDat.read(&magic[0], magic.size());
+	return trDat && magic == GNN_BINARY_MAGIC;
+}
+
+/******************************************************************************/
+/**
+ * Converts a training data file (in any format understood by loadFromDisk())
+ * to the flat binary format
+ *
+ * @param inputFile The name of the existing training data file
+ * @param binaryFile The name of the binary file to be written
+ */
+void networkData::convertToBinaryFile(const std::string &inputFile, const std::string &binaryFile) {
+	networkData nD(inputFile);
+	nD.saveToBinaryFile(binaryFile);
+}
+
 /******************************************************************************/
 /**
  * Adds a new training set to the collection. Note that the training set isn't
@@ -1354,6 +1553,89 @@ GObject *GNeuralNetworkIndividual::clone_() const {
 double GNeuralNetworkIndividual::fitnessCalculation() {
 	double result = 0;
 
+	// Retrieve all weights in one go. They are stored layer by layer. The input
+	// layer holds a weight and a bias per node, all other layers hold (nPrevLayerNodes+1)
+	// entries per node, the last one being the bias.
+	std::vector<double> weights;
+	this->streamline<double>(weights, activityMode::ALLPARAMETERS);
+
+	std::size_t nLayers = this->m_data_cnt.size();
+	std::vector<std::size_t> weightOffset(nLayers, 0);
+	std::size_t maxLayerNodes = 0;
+	for (std::size_t layerCounter = 0; layerCounter < nLayers; layerCounter++) {
+		if (layerCounter > 0) {
+			weightOffset[layerCounter] = weightOffset[layerCounter - 1] + (
+				1 == layerCounter
+				? 2 * (*nD_)[0]
+				: (*nD_)[layerCounter - 1] * ((*nD_)[layerCounter - 2] + 1)
+			);
+		}
+		maxLayerNodes = (std::max)(maxLayerNodes, (*nD_)[layerCounter]);
+	}
+
+	// Buffers for the results of the previous and the current layer, reused for all training sets
+	std::vector<double> prevResults(maxLayerNodes, 0.);
+	std::vector<double> currentResults(maxLayerNodes, 0.);
+
+	// Now loop over all data sets
+	std::size_t currentPos = 0;
+	boost::optional<std::shared_ptr < trainingSet>> o;
+	while ((o = nD_->getTrainingSet(currentPos++))) {
+		// Retrieve a constant reference to the training data set for faster access
+		const trainingSet &tS = **o;
+
+		// The input layer
+		std::size_t nLayerNodes = (*nD_)[0];
+		const double *inputWeights = weights.data();
+		for (std::size_t nodeCounter = 0; nodeCounter < nLayerNodes; nodeCounter++) {
+			prevResults[nodeCounter] = transfer(
+				tS.Input[nodeCounter] * inputWeights[2 * nodeCounter] - inputWeights[2 * nodeCounter + 1]
+			);
+		}
+
+		// All other layers amount to a matrix-vector product, followed by the transfer function
+		for (std::size_t layerCounter = 1; layerCounter < nLayers; layerCounter++) {
+			nLayerNodes = (*nD_)[layerCounter];
+			std::size_t nPrevLayerNodes = (*nD_)[layerCounter - 1];
+			const double *layerWeights = weights.data() + weightOffset[layerCounter];
+
+			for (std::size_t nodeCounter = 0; nodeCounter < nLayerNodes; nodeCounter++) {
+				const double *nodeWeights = layerWeights + nodeCounter * (nPrevLayerNodes + 1);
+				double nodeResult = 0.;
+				for (std::size_t prevNodeCounter = 0; prevNodeCounter < nPrevLayerNodes; prevNodeCounter++) {
+					nodeResult += prevResults[prevNodeCounter] * nodeWeights[prevNodeCounter];
+				}
+				nodeResult -= nodeWeights[nPrevLayerNodes];
+				currentResults[nodeCounter] = transfer(nodeResult);
+			}
+
+			std::swap(prevResults, currentResults);
+		}
+
+		// At this point prevResults contains the output values of the output layer
+
+		// Calculate the error made and add it to the result
+		for (std::size_t nodeCounter = 0; nodeCounter < nLayerNodes; nodeCounter++) {
+			result += GSQUARED(prevResults[nodeCounter] - tS.Output[nodeCounter]);
+		}
+	}
+
+	// Let the audience know
+	return result;
+}
+
+#ifdef GEM_TESTING
+/******************************************************************************/
+/**
+ * The original fitness calculation, accessing each weight through the
+ * parameter objects. It is only used to cross-check fitnessCalculation()
+ * in the unit tests.
+ *
+ * @return The fitness of this object
+ */
+double GNeuralNetworkIndividual::perWeightFitnessCalculation() {
+	double result = 0;
+
 	// Now loop over all data sets
 	std::size_t currentPos = 0;
 	boost::optional<std::shared_ptr < trainingSet>> o;
@@ -1396,8 +1678,6 @@ double GNeuralNetworkIndividual::fitnessCalculation() {
 			prevResults = currentResults;
 		}
 
-		// At this point prevResults should contain the output values of the output layer
-
 		// Calculate the error made and add it to the result
 		std::size_t prefResultsSize = prevResults.size();
 		for (std::size_t nodeCounter = 0; nodeCounter < prefResultsSize; nodeCounter++) {
@@ -1405,9 +1685,112 @@ double GNeuralNetworkIndividual::fitnessCalculation() {
 		}
 	}
 
-	// Let the audience know
 	return result;
 }
+#endif /* GEM_TESTING */
+
+/******************************************************************************/
+/**
+ * Performs self tests that are expected to succeed. This is needed for testing purposes
+ */
+void GNeuralNetworkIndividual::specificTestsNoFailureExpected_GUnitTests_() {
+#ifdef GEM_TESTING
+	using boost::unit_test_framework::test_suite;
+	using boost::unit_test_framework::test_case;
+
+	// Call the parent classes' functions
+	Gem::Geneva::GParameterSet::specificTestsNoFailureExpected_GUnitTests_();
+
+	//------------------------------------------------------------------------------
+
+	{ // Check that the flattened forward pass yields the same error as the per-weight loop
+		std::vector<std::vector<std::size_t>> architectures {
+			{2, 1}
+			, {2, 4, 1}
+			, {3, 5, 4, 1}
+		};
+
+		std::vector<transferFunction> transferFunctions {
+			transferFunction::SIGMOID
+			, transferFunction::RBF
+		};
+
+		for(auto const& architecture: architectures) {
+			std::shared_ptr<GNeuralNetworkIndividual> p_test = this->clone<GNeuralNetworkIndividual>();
+			p_test->nD_ = GNeuralNetworkIndividual::createHyperCubeNetworkData(architecture, 50, 0.5);
+			BOOST_CHECK_NO_THROW(p_test->init(
+				GNN_DEF_MINVAR, GNN_DEF_MAXVAR, GNN_DEF_SIGMA, GNN_DEF_SIGMASIGMA, GNN_DEF_MINSIGMA
+				, GNN_DEF_MAXSIGMA, GNN_DEF_ADPROB, GNN_DEF_ADAPTADPROB, GNN_DEF_MINADPROB, GNN_DEF_MAXADPROB
+			));
+
+			for(auto const& tF: transferFunctions) {
+				p_test->setTransferFunction(tF);
+
+				for(std::size_t i=0; i<5; i++) {
+					double f_matrix = p_test->fitnessCalculation();
+					double f_loop = p_test->perWeightFitnessCalculation();
+					BOOST_CHECK_MESSAGE(
+						std::fabs(f_matrix - f_loop) <= 1e-10 * (std::max)(1., std::fabs(f_loop))
+						, "\n"
+						<< "Forward passes differ for architecture " << p_test->nD_->getNetworkGeometryString()
+						<< " and transfer function " << tF << ": " << f_matrix << " / " << f_loop << "\n"
+					);
+
+					BOOST_CHECK_NO_THROW(p_test->adapt());
+				}
+			}
+		}
+	}
+
+	//------------------------------------------------------------------------------
+
+	{ // Check that training data survives a round trip through the binary format
+		std::string xmlFile = "./GNeuralNetworkIndividual_roundtrip.xml";
+		std::string binaryFile = "./GNeuralNetworkIndividual_roundtrip.bin";
+		std::string convertedFile = "./GNeuralNetworkIndividual_converted.bin";
+
+		std::shared_ptr<networkData> nD_orig = GNeuralNetworkIndividual::createHyperCubeNetworkData({3, 5, 1}, 40, 0.5);
+
+		BOOST_CHECK_NO_THROW(nD_orig->saveToBinaryFile(binaryFile));
+		BOOST_CHECK(networkData::isBinaryFile(binaryFile));
+
+		BOOST_CHECK_NO_THROW(nD_orig->saveToDisk(xmlFile));
+		BOOST_CHECK(not networkData::isBinaryFile(xmlFile));
+		BOOST_CHECK_NO_THROW(networkData::convertToBinaryFile(xmlFile, convertedFile));
+		BOOST_CHECK(networkData::isBinaryFile(convertedFile));
+
+		for(auto const& f: std::vector<std::string>{binaryFile, convertedFile}) {
+			// The constructor detects the binary format
+			std::shared_ptr<networkData> nD_loaded;
+			BOOST_REQUIRE_NO_THROW(nD_loaded = std::shared_ptr<networkData>(new networkData(f)));
+			BOOST_CHECK_NO_THROW(nD_loaded->compare(*nD_orig, Gem::Common::expectation::EQUALITY, 0.));
+			BOOST_CHECK(nD_loaded->getNetworkGeometryString() == nD_orig->getNetworkGeometryString());
+
+			std::size_t pos = 0;
+			boost::optional<std::shared_ptr<trainingSet>> o_orig, o_loaded;
+			while ((o_orig = nD_orig->getTrainingSet(pos))) {
+				BOOST_REQUIRE(o_loaded = nD_loaded->getTrainingSet(pos));
+				BOOST_CHECK_NO_THROW((*o_loaded)->compare(**o_orig, Gem::Common::expectation::EQUALITY, 0.));
+				pos++;
+			}
+			BOOST_CHECK(not nD_loaded->getTrainingSet(pos));
+		}
+
+		// Loading from XML does not retain the init range, so only check the direct binary copy
+		std::shared_ptr<networkData> nD_binary(new networkData(binaryFile));
+		BOOST_CHECK(nD_binary->getInitRange() == nD_orig->getInitRange());
+
+		bf::remove(xmlFile);
+		bf::remove(binaryFile);
+		bf::remove(convertedFile);
+	}
+
+	//------------------------------------------------------------------------------
+
+#else /* GEM_TESTING */ // If this function is called when GEM_TESTING isn't set, throw
+	Gem::Common::condnotset("GNeuralNetworkIndividual::specificTestsNoFailureExpected_GUnitTests", "GEM_TESTING");
+#endif /* GEM_TESTING */
+}
 
 
 /******************************************************************************/
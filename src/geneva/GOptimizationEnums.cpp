@@ -423,6 +423,111 @@ std::istream &operator>>(std::istream &i, Gem::Geneva::updateRule &ur) {
 	return i;
 }
 
+/******************************************************************************/
+/**
+ * Puts a Gem::Geneva::gradientEstimator item into a stream
+ *
+ * @param o The ostream the item should be added to
+ * @param ge the item to be added to the stream
+ * @return The std::ostream object used to add the item to
+ */
+std::ostream &operator<<(std::ostream &o, const Gem::Geneva::gradientEstimator &ge) {
+	Gem::Common::ENUMBASETYPE tmp = static_cast<Gem::Common::ENUMBASETYPE>(ge);
+	o << tmp;
+	return o;
+}
+
+/******************************************************************************/
+/**
+ * Reads a Gem::Geneva::gradientEstimator item from a stream
+ *
+ * @param i The stream the item should be read from
+ * @param ge The item read from the stream
+ * @return The std::istream object used to read the item from
+ */
+std::istream &operator>>(std::istream &i, Gem::Geneva::gradientEstimator &ge) {
+	Gem::Common::ENUMBASETYPE tmp;
+	i >> tmp;
+
+#ifdef DEBUG
+	ge = boost::numeric_cast<Gem::Geneva::gradientEstimator>(tmp);
+#else
+	ge = static_cast<Gem::Geneva::gradientEstimator>(tmp);
+#endif /* DEBUG */
+
+	return i;
+}
+
+/******************************************************************************/
+/**
+ * Puts a Gem::Geneva::scanSequence item into a stream
+ *
+ * @param o The ostream the item should be added to
+ * @param ss the item to be added to the stream
+ * @return The std::ostream object used to add the item to
+ */
+std::ostream &operator<<(std::ostream &o, const Gem::Geneva::scanSequence &ss) {
+	Gem::Common::ENUMBASETYPE tmp = static_cast<Gem::Common::ENUMBASETYPE>(ss);
+	o << tmp;
+	return o;
+}
+
+/******************************************************************************/
+/**
+ * Reads a Gem::Geneva::scanSequence item from a stream
+ *
+ * @param i The stream the item should be read from
+ * @param ss The item read from the stream
+ * @return The std::istream object used to read the item from
+ */
+std::istream &operator>>(std::istream &i, Gem::Geneva::scanSequence &ss) {
+	Gem::Common::ENUMBASETYPE tmp;
+	i >> tmp;
+
+#ifdef DEBUG
+	ss = boost::numeric_cast<Gem::Geneva::scanSequence>(tmp);
+#else
+	ss = static_cast<Gem::Geneva::scanSequence>(tmp);
+#endif /* DEBUG */
+
+	return i;
+}
+
+/******************************************************************************/
+/**
+ * Puts a Gem::Geneva::migrationTopology item into a stream
+ *
+ * @param o The ostream the item should be added to
+ * @param mt the item to be added to the stream
+ * @return The std::ostream object used to add the item to
+ */
+std::ostream &operator<<(std::ostream &o, const Gem::Geneva::migrationTopology &mt) {
+	Gem::Common::ENUMBASETYPE tmp = static_cast<Gem::Common::ENUMBASETYPE>(mt);
+	o << tmp;
+	return o;
+}
+
+/******************************************************************************/
+/**
+ * Reads a Gem::Geneva::migrationTopology item from a stream
+ *
+ * @param i The stream the item should be read from
+ * @param mt The item read from the stream
+ * @return The std::istream object used to read the item from
+ */
+std::istream &operator>>(std::istream &i, Gem::Geneva::migrationTopology &mt) {
+	Gem::Common::ENUMBASETYPE tmp;
+	i >> tmp;
+
+#ifdef DEBUG
+	mt = boost::numeric_cast<Gem::Geneva::migrationTopology>(tmp);
+#else
+	mt = static_cast<Gem::Geneva::migrationTopology>(tmp);
+#endif /* DEBUG */
+
+	return i;
+}
+
 /******************************************************************************/
 /**
  * Puts a Gem::Geneva::adaptionMode into a stream. Needed also for boost::lexical_cast<>
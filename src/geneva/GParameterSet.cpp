@@ -231,6 +231,13 @@ GParameterSet::GParameterSet(GParameterSet const &cp)
    , m_max_unsuccessful_adaptions(cp.m_max_unsuccessful_adaptions)
    , m_max_retries_until_valid(cp.m_max_retries_until_valid)
    , m_n_adaptions(cp.m_n_adaptions)
+   , m_use_incremental_evaluation(cp.m_use_incremental_evaluation)
+   , m_delta_reference_valid(cp.m_delta_reference_valid)
+   , m_delta_reference_values(cp.m_delta_reference_values)
+   , m_delta_reference_raw_fitness(cp.m_delta_reference_raw_fitness)
+   , m_use_batch_evaluation(cp.m_use_batch_evaluation)
+   , m_precomputed_raw_fitness_valid(cp.m_precomputed_raw_fitness_valid)
+   , m_precomputed_raw_fitness(cp.m_precomputed_raw_fitness)
 {
 	// Copy the personality pointer over
 	Gem::Common::copyCloneableSmartPointer(cp.m_pt_ptr, m_pt_ptr);
@@ -279,6 +286,13 @@ void GParameterSet::compare_(
 	compare_t(IDENTITY(m_max_unsuccessful_adaptions, p_load->m_max_unsuccessful_adaptions), token);
 	compare_t(IDENTITY(m_max_retries_until_valid, p_load->m_max_retries_until_valid), token);
 	compare_t(IDENTITY(m_n_adaptions, p_load->m_n_adaptions), token);
+	compare_t(IDENTITY(m_use_incremental_evaluation, p_load->m_use_incremental_evaluation), token);
+	compare_t(IDENTITY(m_delta_reference_valid, p_load->m_delta_reference_valid), token);
+	compare_t(IDENTITY(m_delta_reference_values, p_load->m_delta_reference_values), token);
+	compare_t(IDENTITY(m_delta_reference_raw_fitness, p_load->m_delta_reference_raw_fitness), token);
+	compare_t(IDENTITY(m_use_batch_evaluation, p_load->m_use_batch_evaluation), token);
+	compare_t(IDENTITY(m_precomputed_raw_fitness_valid, p_load->m_precomputed_raw_fitness_valid), token);
+	compare_t(IDENTITY(m_precomputed_raw_fitness, p_load->m_precomputed_raw_fitness), token);
 
 	// React on deviations from the expectation
 	token.evaluate();
@@ -819,6 +833,17 @@ std::size_t GParameterSet::adapt() {
 	std::size_t nInvalidAdaptions = 0;
 	double validity = 0;
 
+	// Remember the parent's parameters and evaluation, if incremental evaluation
+	// was requested. An individual that was already adapted since its last
+	// evaluation keeps its original reference, so that all changes are covered.
+	if(m_use_incremental_evaluation) {
+		if(this->is_processed()) {
+			this->storeDeltaReference();
+		} else if(not this->is_due_for_processing()) {
+			this->clearDeltaReference();
+		}
+	}
+
 	// Perform adaptions until a valid solution was find. In the context
 	// of evolutionary algorithms, this process is indeed equivalent to
 	// a larger population, if invalid solutions were produced. The downside
@@ -971,6 +996,25 @@ maxMode GParameterSet::getMaxMode() const {
 	return m_maxmode;
 }
 
+/******************************************************************************/
+/**
+ * Allows long-running fitness calculations to report a raw fitness value that
+ * the final result is known not to improve upon, e.g. a partial sum of
+ * non-negative contributions in a minimization problem. The value is translated
+ * into a bound of the minimization-only fitness. The return value tells the
+ * caller whether the evaluation has become hopeless (or was cancelled by the
+ * optimization algorithm) and should be stopped. In this case the fitness
+ * calculation may return any value, as the result will be discarded.
+ *
+ * @param intermediateFitness A raw fitness the final result cannot improve upon
+ * @return A boolean indicating whether the fitness calculation should be stopped
+ */
+bool GParameterSet::reportIntermediateFitness(double intermediateFitness) {
+	return this->reportIntermediateBound(
+		maxMode::MINIMIZE == m_maxmode ? intermediateFitness : -intermediateFitness
+	);
+}
+
 /* ----------------------------------------------------------------------------------
  * Retrieval is tested in GParameterSet::specificTestsNoFailureExpected_GUnitTests()
  * ----------------------------------------------------------------------------------
@@ -1196,6 +1240,156 @@ void GParameterSet::setRandomCrash(
 	m_randomCrashProb = crashProb;
 }
 
+/******************************************************************************/
+/**
+ * Allows to enable or disable incremental (delta) evaluation. When enabled, adapt()
+ * records the parameters and raw fitness of an already evaluated individual before
+ * modifying it, so that the next evaluation may be derived from the parent's result
+ * through incrementalFitnessCalculation(). Note that the reference is serialized
+ * together with the individual, so this increases the amount of data transferred
+ * to remote consumers.
+ */
+void GParameterSet::setUseIncrementalEvaluation(bool useIncrementalEvaluation) {
+	m_use_incremental_evaluation = useIncrementalEvaluation;
+	if(not m_use_incremental_evaluation) {
+		this->clearDeltaReference();
+	}
+}
+
+/******************************************************************************/
+/**
+ * Checks whether incremental (delta) evaluation is enabled
+ */
+bool GParameterSet::getUseIncrementalEvaluation() const {
+	return m_use_incremental_evaluation;
+}
+
+/******************************************************************************/
+/**
+ * Checks whether a parent evaluation is available for incremental evaluation
+ */
+bool GParameterSet::hasDeltaReference() const {
+	return m_delta_reference_valid;
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the positions (in terms of streamline<double>()) of all parameters
+ * that differ from the parent this individual was adapted from. The vector
+ * will be empty if no usable reference exists.
+ */
+std::vector<std::size_t> GParameterSet::getChangedParameterPositions() const {
+	parameterset_delta delta;
+	if(this->buildDelta(delta)) {
+		return delta.changed_positions;
+	}
+
+	return std::vector<std::size_t>();
+}
+
+/******************************************************************************/
+/**
+ * Allows to enable or disable batch evaluation. When enabled, optimization
+ * algorithms hand all individuals due for processing to batchEvaluation()
+ * before submitting them, so that the main fitness may be calculated for the
+ * entire population in a single call to batchFitnessCalculation(). Note that
+ * the batch is evaluated in the calling thread, so this is only useful for
+ * cheap, vectorizable evaluation functions.
+ */
+void GParameterSet::setUseBatchEvaluation(bool useBatchEvaluation) {
+	m_use_batch_evaluation = useBatchEvaluation;
+}
+
+/******************************************************************************/
+/**
+ * Checks whether batch evaluation is enabled
+ */
+bool GParameterSet::getUseBatchEvaluation() const {
+	return m_use_batch_evaluation;
+}
+
+/******************************************************************************/
+/**
+ * Checks whether a fitness value was precomputed by a batch evaluation and is
+ * waiting to be picked up by the next call to process()
+ */
+bool GParameterSet::hasPrecomputedFitness() const {
+	return m_precomputed_raw_fitness_valid;
+}
+
+/******************************************************************************/
+/**
+ * Evaluates all items due for processing in a single call to the
+ * batchFitnessCalculation() function of the first such item. The parameters of
+ * all items are assembled into a row-major matrix (one row per item). Results
+ * are stored as precomputed fitness values, which are picked up by process_(),
+ * so constraint checks, transformations and status flags are applied as usual
+ * when the items pass through the executor. Nothing is done (and false returned)
+ * unless all due items are of the same type, have batch evaluation enabled,
+ * hold the same number of double parameters only and use a single fitness
+ * criterion. The caller then simply processes the items one by one.
+ *
+ * @param workItems The items to be evaluated
+ * @return A boolean indicating whether fitness values were precomputed
+ */
+bool GParameterSet::batchEvaluation(std::vector<std::shared_ptr<GParameterSet>>& workItems) {
+	std::vector<std::shared_ptr<GParameterSet>> due_cnt;
+	for(auto const& item_ptr: workItems) {
+		if(item_ptr && Gem::Courtier::processingStatus::DO_PROCESS == item_ptr->getProcessingStatus()) {
+			due_cnt.push_back(item_ptr);
+		}
+	}
+
+	if(due_cnt.empty() || not due_cnt.front()->m_use_batch_evaluation) {
+		return false;
+	}
+
+	auto const& first = *(due_cnt.front());
+	std::size_t nParameters = first.countParameters<double>(activityMode::DEFAULTACTIVITYMODE);
+	if(0 == nParameters) {
+		return false;
+	}
+
+	for(auto const& item_ptr: due_cnt) {
+		if(
+			typeid(*item_ptr) != typeid(first)
+			|| not item_ptr->m_use_batch_evaluation
+			|| 1 != item_ptr->getNStoredResults()
+			|| nParameters != item_ptr->countParameters<double>(activityMode::DEFAULTACTIVITYMODE)
+			|| 0 != item_ptr->countParameters<float>(activityMode::DEFAULTACTIVITYMODE)
+			|| 0 != item_ptr->countParameters<std::int32_t>(activityMode::DEFAULTACTIVITYMODE)
+			|| 0 != item_ptr->countParameters<bool>(activityMode::DEFAULTACTIVITYMODE)
+		) {
+			return false;
+		}
+	}
+
+	// Assemble the parameter matrix
+	std::vector<double> parameters;
+	parameters.reserve(due_cnt.size() * nParameters);
+	std::vector<double> parVec;
+	for(auto const& item_ptr: due_cnt) {
+		item_ptr->streamline<double>(parVec, activityMode::DEFAULTACTIVITYMODE);
+		parameters.insert(parameters.end(), parVec.begin(), parVec.end());
+	}
+
+	std::vector<double> results;
+	if(
+		not first.batchFitnessCalculation(parameters, nParameters, results)
+		|| results.size() != due_cnt.size()
+	) {
+		return false;
+	}
+
+	for(std::size_t i = 0; i < due_cnt.size(); i++) {
+		due_cnt[i]->m_precomputed_raw_fitness = results[i];
+		due_cnt[i]->m_precomputed_raw_fitness_valid = true;
+	}
+
+	return true;
+}
+
+/******************************************************************************/
 /******************************************************************************/
 /**
  * This function returns the current personality traits base pointer. Note that there
@@ -1362,6 +1556,24 @@ void GParameterSet::addConfigurationOptions_(
 	)
 		<< "Indicates whether random crashes should occur for debugging purposes" << std::endl << Gem::Common::nextComment()
 		<< "The probability of a random crash to occur";
+
+	gpb.registerFileParameter<bool>(
+		"useIncrementalEvaluation" // The name of the variable
+		, GPS_DEF_USE_INCREMENTALEVALUATION // The default value
+		, [this](bool uie) { this->setUseIncrementalEvaluation(uie); }
+	)
+		<< "Indicates whether adapted individuals should try to update the" << std::endl
+		<< "parent's fitness from the changed parameters only. This requires" << std::endl
+		<< "the individual to implement incrementalFitnessCalculation().";
+
+	gpb.registerFileParameter<bool>(
+		"useBatchEvaluation" // The name of the variable
+		, GPS_DEF_USE_BATCHEVALUATION // The default value
+		, [this](bool ube) { this->setUseBatchEvaluation(ube); }
+	)
+		<< "Indicates whether all individuals of a population should be evaluated" << std::endl
+		<< "in a single call before submission. This requires the individual to" << std::endl
+		<< "implement batchFitnessCalculation() and happens in the calling thread.";
 }
 
 /******************************************************************************/
@@ -1526,10 +1738,25 @@ void GParameterSet::process_() {
 		double main_raw_result = 0.;
 
 		try {
-			main_raw_result = this->fitnessCalculation();
+			// Try to update the parent's fitness from the changed parameters first,
+			// if this was requested. Fall back to a full evaluation otherwise.
+			// A value precomputed by batchEvaluation() takes precedence.
+			parameterset_delta delta;
+			if(m_precomputed_raw_fitness_valid) {
+				main_raw_result = m_precomputed_raw_fitness;
+			} else if(
+				not this->buildDelta(delta)
+				|| not this->incrementalFitnessCalculation(delta, main_raw_result)
+			) {
+				main_raw_result = this->fitnessCalculation();
+			}
+			this->clearDeltaReference();
+			m_precomputed_raw_fitness_valid = false;
 		} catch(...) {
 			// Make sure we invalidate all fitness values, if an exception was thrown
 			this->setAllFitnessTo(this->getWorstCase());
+			this->clearDeltaReference();
+			m_precomputed_raw_fitness_valid = false;
 
 			// Rethrow the exception
 			throw;
@@ -1564,6 +1791,10 @@ void GParameterSet::process_() {
 			}
 		}
 	} else { // Some constraints were violated. Act on the chosen policy
+		// The parameters were not evaluated, so a stored reference or batch result is of no further use
+		this->clearDeltaReference();
+		m_precomputed_raw_fitness_valid = false;
+
 		if (evaluationPolicy::USEWORSTCASEFORINVALID == m_eval_policy) {
 			this->setAllFitnessTo(this->getWorstCase());
 		} else if (evaluationPolicy::USESIGMOID == m_eval_policy) {
@@ -1616,6 +1847,13 @@ void GParameterSet::load_(const GObject *cp) {
 	m_max_unsuccessful_adaptions = p_load->m_max_unsuccessful_adaptions;
 	m_max_retries_until_valid = p_load->m_max_retries_until_valid;
 	m_n_adaptions = p_load->m_n_adaptions;
+	m_use_incremental_evaluation = p_load->m_use_incremental_evaluation;
+	m_delta_reference_valid = p_load->m_delta_reference_valid;
+	m_delta_reference_values = p_load->m_delta_reference_values;
+	m_delta_reference_raw_fitness = p_load->m_delta_reference_raw_fitness;
+	m_use_batch_evaluation = p_load->m_use_batch_evaluation;
+	m_precomputed_raw_fitness_valid = p_load->m_precomputed_raw_fitness_valid;
+	m_precomputed_raw_fitness = p_load->m_precomputed_raw_fitness;
 
 	Gem::Common::copyCloneableSmartPointer(p_load->m_pt_ptr, m_pt_ptr);
 	Gem::Common::copyCloneableSmartPointer(p_load->m_individual_constraint_ptr, m_individual_constraint_ptr);
@@ -1669,6 +1907,49 @@ std::size_t GParameterSet::customAdaptions() {
  * ----------------------------------------------------------------------------------
  */
 
+/******************************************************************************/
+/**
+ * Updates the fitness of this individual from the parent's raw fitness and the
+ * set of parameters that were changed by adapt(). Derived classes that can do
+ * this more cheaply than a full evaluation should re-implement this function,
+ * store the main result in the second argument and return true. Secondary
+ * results may be registered through setResult(), as in fitnessCalculation().
+ * Returning false (the default) triggers a full call to fitnessCalculation().
+ *
+ * @param delta The difference between this individual and its parent
+ * @param main_raw_result Will hold the updated main (raw) fitness
+ * @return A boolean indicating whether an incremental update was performed
+ */
+bool GParameterSet::incrementalFitnessCalculation(
+	parameterset_delta const& delta
+	, double& main_raw_result
+) {
+	return false;
+}
+
+/******************************************************************************/
+/**
+ * Calculates the main (raw) fitness for a number of parameter sets in one go.
+ * The parameters are handed over as a row-major matrix with one row of
+ * nParameters values (as obtained through streamline<double>()) per item.
+ * Derived classes able to evaluate a population more efficiently than item by
+ * item should re-implement this function, fill the results vector with one
+ * value per row and return true. Secondary results are not supported. Returning
+ * false (the default) leaves evaluation to process() for each item.
+ *
+ * @param parameters The parameters of all items, one row per item
+ * @param nParameters The number of parameters in each row
+ * @param results Will hold the main raw fitness of each row
+ * @return A boolean indicating whether the batch was evaluated
+ */
+bool GParameterSet::batchFitnessCalculation(
+	std::vector<double> const& parameters
+	, std::size_t nParameters
+	, std::vector<double>& results
+) const {
+	return false;
+}
+
 /******************************************************************************/
 /**
  * Sets the fitness to a given set of values and clears the dirty flag. This is meant
@@ -1894,6 +2175,76 @@ void GParameterSet::setAllFitnessTo(double val) {
 	this->setAllFitnessTo(val,val);
 }
 
+/***************************************************************************/
+/**
+ * Stores the current double parameters and raw fitness values as the reference
+ * for incremental evaluation. This is only done for valid, error-free individuals
+ * whose parameters are all of type double, as other parameter types are not
+ * covered by the delta description.
+ */
+void GParameterSet::storeDeltaReference() {
+	this->clearDeltaReference();
+
+	if(
+		not this->is_processed()
+		|| not this->isValid()
+		|| this->countParameters<float>(activityMode::ALLPARAMETERS) > 0
+		|| this->countParameters<std::int32_t>(activityMode::ALLPARAMETERS) > 0
+		|| this->countParameters<bool>(activityMode::ALLPARAMETERS) > 0
+	) {
+		return;
+	}
+
+	this->streamline<double>(m_delta_reference_values, activityMode::ALLPARAMETERS);
+	m_delta_reference_raw_fitness = this->raw_fitness_vec();
+	m_delta_reference_valid = true;
+}
+
+/***************************************************************************/
+/**
+ * Removes any stored reference for incremental evaluation
+ */
+void GParameterSet::clearDeltaReference() {
+	m_delta_reference_valid = false;
+	m_delta_reference_values.clear();
+	m_delta_reference_raw_fitness.clear();
+}
+
+/***************************************************************************/
+/**
+ * Assembles the difference between the current parameters and the stored
+ * reference. Changed positions are found by comparing values, so that
+ * modifications made after adapt() are taken into account as well.
+ *
+ * @param delta Will hold the description of the difference to the parent
+ * @return A boolean indicating whether a usable delta could be assembled
+ */
+bool GParameterSet::buildDelta(parameterset_delta& delta) const {
+	if(not m_use_incremental_evaluation || not m_delta_reference_valid) {
+		return false;
+	}
+
+	this->streamline<double>(delta.current_values, activityMode::ALLPARAMETERS);
+	if(
+		delta.current_values.size() != m_delta_reference_values.size()
+		|| m_delta_reference_raw_fitness.size() != this->getNStoredResults()
+	) {
+		return false;
+	}
+
+	delta.changed_positions.clear();
+	for(std::size_t pos = 0; pos < delta.current_values.size(); pos++) {
+		if(delta.current_values[pos] != m_delta_reference_values[pos]) {
+			delta.changed_positions.push_back(pos);
+		}
+	}
+
+	delta.parent_values = m_delta_reference_values;
+	delta.parent_raw_fitness = m_delta_reference_raw_fitness;
+
+	return true;
+}
+
 /******************************************************************************/
 /**
  * Applies modifications to this object. This is needed for testing purposes
@@ -2656,6 +3007,49 @@ void GParameterSet::specificTestsNoFailureExpected_GUnitTests_() {
 
 	//---------------------------------------------------------------------
 
+	{ // Check cooperative cancellation of evaluations
+		std::shared_ptr<GParameterSet> p_test = this->clone<GParameterSet>();
+
+		// Items whose cancellation was requested before processing are not evaluated
+		p_test->mark_as_due_for_processing();
+		BOOST_CHECK(not p_test->cancellationRequested());
+		p_test->requestCancellation();
+		BOOST_CHECK(p_test->cancellationRequested());
+		BOOST_CHECK_NO_THROW(p_test->process());
+		BOOST_CHECK(p_test->is_cancelled());
+		BOOST_CHECK(p_test->has_errors());
+		BOOST_CHECK(not p_test->is_processed());
+
+		// A new submission starts without a pending cancellation request
+		BOOST_CHECK_NO_THROW(p_test->set_processing_status(Gem::Courtier::processingStatus::DO_PROCESS));
+		BOOST_CHECK(not p_test->cancellationRequested());
+
+		// Clones do not inherit a pending cancellation request
+		p_test->requestCancellation();
+		BOOST_CHECK(not p_test->clone<GParameterSet>()->cancellationRequested());
+
+		// Intermediate results beyond the cancellation bound render an item hopeless
+		p_test->mark_as_due_for_processing();
+		p_test->setCancellationBound(1.);
+		BOOST_CHECK(p_test->getCancellationBound() == 1.);
+		BOOST_CHECK(not p_test->reportIntermediateFitness(0.5));
+		BOOST_CHECK(p_test->reportIntermediateFitness(2.));
+		BOOST_CHECK(p_test->reportIntermediateFitness(0.)); // Bounds only become tighter
+		BOOST_CHECK(p_test->getIntermediateBound() == 2.);
+		BOOST_CHECK(p_test->cancel_if_requested());
+		BOOST_CHECK(p_test->is_cancelled());
+
+		// Maximization problems report bounds in the same way
+		std::shared_ptr<GParameterSet> p_max = this->clone<GParameterSet>();
+		p_max->setMaxMode(maxMode::MAXIMIZE);
+		p_max->mark_as_due_for_processing();
+		p_max->setCancellationBound(-10.); // i.e. a raw fitness of 10 needs to be beaten
+		BOOST_CHECK(not p_max->reportIntermediateFitness(20.));
+		BOOST_CHECK(p_max->reportIntermediateFitness(5.));
+	}
+
+	//---------------------------------------------------------------------
+
 #else /* GEM_TESTING */  // If this function is called when GEM_TESTING isn't set, throw
 	Gem::Common::condnotset("GParameterSet::specificTestsNoFailureExpected_GUnitTests", "GEM_TESTING");
 #endif /* GEM_TESTING */
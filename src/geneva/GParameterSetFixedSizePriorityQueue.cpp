@@ -116,6 +116,8 @@ Gem::Common::GFixedSizePriorityQueueT<GParameterSet> * GParameterSetFixedSizePri
  * Checks whether no item has the dirty flag set
  */
 bool GParameterSetFixedSizePriorityQueue::allClean(std::size_t &pos) const {
+	this->sortData();
+
 	pos = 0;
 	for(const auto& item_ptr: m_data_deq) {
 		if (not item_ptr->is_processed()) { return false; }
@@ -130,6 +132,8 @@ bool GParameterSetFixedSizePriorityQueue::allClean(std::size_t &pos) const {
  * Emits information about the "dirty flag" of all items
  */
 std::string GParameterSetFixedSizePriorityQueue::getCleanStatus() const {
+	this->sortData();
+
 	std::size_t pos = 0;
 	std::ostringstream oss;
 	for(const auto& item_ptr: m_data_deq) {
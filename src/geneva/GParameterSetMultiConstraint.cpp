@@ -106,6 +106,17 @@ GParameterSetFormulaConstraint::GParameterSetFormulaConstraint(std::string rawFo
 	: rawFormula_(rawFormula)
 { /* nothing */ }
 
+/******************************************************************************/
+/**
+ * The copy constructor. The compiled parser is not shared with the copy, as
+ * it holds mutable evaluation state. The copy will compile its own parser
+ * upon the first check.
+ */
+GParameterSetFormulaConstraint::GParameterSetFormulaConstraint(const GParameterSetFormulaConstraint &cp)
+	: GParameterSetConstraint(cp)
+	, rawFormula_(cp.rawFormula_)
+{ /* nothing */ }
+
 /******************************************************************************/
 /**
  * Searches for compliance with expectations with respect to another object
@@ -149,8 +160,9 @@ void GParameterSetFormulaConstraint::addConfigurationOptions_(
 /******************************************************************************/
 /**
  * This function extracts all double parameter values including their names from the GParameterSet
- * objects. It then initiates replacement of parameter values in the formula string and
- * parsing of the string. If a math error occurs inside of the formula (such as division by 0),
+ * objects and hands them to the formula parser. The formula is only parsed and compiled
+ * once, upon the first call; later calls just fill in the values and execute the
+ * byte code. If a math error occurs inside of the formula (such as division by 0),
  * the worst possible value will be returned (MAX_DOUBLE, taken from a Boost function).
  *
  * TODO: Make this work for all parameter types
@@ -161,10 +173,12 @@ double GParameterSetFormulaConstraint::check_(
 	std::map<std::string, std::vector<double>> parameterValues;
 
 	p->streamline(parameterValues); // Extract the parameter values including names
-	Gem::Common::GFormulaParserT<double> f(rawFormula_); // Create the parser
+	if (not parser_ptr_) { // Create the parser upon the first call
+		parser_ptr_ = std::make_shared<Gem::Common::GFormulaParserT<double>>(rawFormula_);
+	}
 
 	try {
-		return f(parameterValues); // Parse the formula. This may throw a Gem::Common::math_logic_error
+		return parser_ptr_->evaluateCompiled(parameterValues); // This may throw a Gem::Common::math_logic_error
 	} catch (Gem::Common::math_logic_error &m) {
 		glogger
 		<< "In GParameterSetFormulaConstraint::check_(): WARNING" << std::endl
@@ -189,7 +203,10 @@ void GParameterSetFormulaConstraint::load_(const GObject *cp) {
 	GPreEvaluationValidityCheckT<GParameterSet>::load_(cp);
 
 	// ... and then our local data
-	rawFormula_ = p_load->rawFormula_;
+	if (rawFormula_ != p_load->rawFormula_) {
+		rawFormula_ = p_load->rawFormula_;
+		parser_ptr_.reset(); // Triggers re-compilation upon the next check
+	}
 }
 
 /******************************************************************************/
@@ -776,6 +776,122 @@ void GCollectiveMonitor::specificTestsFailuresExpected_GUnitTests_()  {
 ////////////////////////////////////////////////////////////////////////////////
 /******************************************************************************/
 
+/**
+ * Takes a snapshot of an individual. Parameter values are retrieved in the same
+ * order as in GParameterSet::toCSV().
+ *
+ * @param ind The individual to be snapshotted
+ * @param useRawFitness Whether the raw (instead of the transformed) fitness should be stored
+ */
+GSolutionRecord::GSolutionRecord(
+	GParameterSet const & ind
+	, bool useRawFitness
+)
+	: m_nFitness(ind.getNStoredResults())
+	, m_isProcessed(ind.is_processed())
+	, m_hasErrors(ind.has_errors())
+{
+	std::map<std::string, std::vector<double>> dData;
+	std::map<std::string, std::vector<float>> fData;
+	std::map<std::string, std::vector<std::int32_t>> iData;
+	std::map<std::string, std::vector<bool>> bData;
+
+	ind.streamline<double>(dData);
+	ind.streamline<float>(fData);
+	ind.streamline<std::int32_t>(iData);
+	ind.streamline<bool>(bData);
+
+	for(auto const & item: dData) m_dValues.insert(m_dValues.end(), item.second.begin(), item.second.end());
+	for(auto const & item: fData) m_fValues.insert(m_fValues.end(), item.second.begin(), item.second.end());
+	for(auto const & item: iData) m_iValues.insert(m_iValues.end(), item.second.begin(), item.second.end());
+	for(auto const & item: bData) m_bValues.insert(m_bValues.end(), item.second.begin(), item.second.end());
+
+	if(m_isProcessed) {
+		m_fitness.reserve(m_nFitness);
+		for(std::size_t i = 0; i < m_nFitness; i++) {
+			m_fitness.push_back(useRawFitness ? ind.raw_fitness(i) : ind.transformed_fitness(i));
+		}
+		m_isValid = ind.isValid();
+	}
+}
+
+/******************************************************************************/
+/**
+ * Writes the record in the format of GParameterSet::toCSV(), without names and types
+ *
+ * @param out The stream to write to
+ * @param withCommas Whether commas should be printed in-between values
+ * @param showValidity Whether the validity of the solution should be shown
+ */
+void GSolutionRecord::toCSV(
+	std::ostream & out
+	, bool withCommas
+	, bool showValidity
+) const {
+	const char *separator = withCommas ? ",\t" : "\t";
+	bool first = true;
+	auto emit = [&](std::string const & value) {
+		if(not first) out << separator;
+		out << value;
+		first = false;
+	};
+
+	for(auto const & v: m_dValues) emit(Gem::Common::to_string(v));
+	for(auto const & v: m_fValues) emit(Gem::Common::to_string(v));
+	for(auto const & v: m_iValues) emit(Gem::Common::to_string(v));
+	for(auto const v: m_bValues) emit(Gem::Common::to_string(bool(v)));
+
+	for(std::size_t i = 0; i < m_nFitness; i++) {
+		if(m_isProcessed) {
+			emit(Gem::Common::to_string(m_fitness.at(i)));
+		} else {
+			emit(m_hasErrors ? "has_errors" : "dirty");
+		}
+	}
+
+	if(showValidity) emit(Gem::Common::to_string(m_isValid));
+
+	out << std::endl;
+}
+
+/******************************************************************************/
+/**
+ * Retrieves all parameter values, converted to double. Float, integer and
+ * boolean values may be represented exactly.
+ */
+std::vector<double> GSolutionRecord::getParameterValues() const {
+	std::vector<double> result;
+	result.reserve(m_dValues.size() + m_fValues.size() + m_iValues.size() + m_bValues.size());
+
+	result.insert(result.end(), m_dValues.begin(), m_dValues.end());
+	for(auto const & v: m_fValues) result.push_back(double(v));
+	for(auto const & v: m_iValues) result.push_back(double(v));
+	for(auto const v: m_bValues) result.push_back(v ? 1. : 0.);
+
+	return result;
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the fitness values; NaN if the individual wasn't processed
+ */
+std::vector<double> GSolutionRecord::getFitnessValues() const {
+	if(m_isProcessed) return m_fitness;
+	return std::vector<double>(m_nFitness, std::numeric_limits<double>::quiet_NaN());
+}
+
+/******************************************************************************/
+/**
+ * Checks whether the individual represents a valid solution. Unprocessed
+ * individuals are considered invalid.
+ */
+bool GSolutionRecord::isValid() const {
+	return m_isValid;
+}
+
+/******************************************************************************/
+////////////////////////////////////////////////////////////////////////////////
+/******************************************************************************/
 /**
  * Initialization with a file name. Note that some variables may be initialized in the class body.
  */
@@ -797,6 +913,25 @@ GAllSolutionFileLogger::GAllSolutionFileLogger(
 	  , m_boundariesActive(true)
 { /* nothing */ }
 
+/******************************************************************************/
+/**
+ * The copy constructor. Output files are not shared with the copy.
+ */
+GAllSolutionFileLogger::GAllSolutionFileLogger(const GAllSolutionFileLogger& cp)
+	: GBasePluggableOM(cp)
+	  , m_fileName(cp.m_fileName)
+	  , m_boundaries(cp.m_boundaries)
+	  , m_boundariesActive(cp.m_boundariesActive)
+	  , m_withNameAndType(cp.m_withNameAndType)
+	  , m_withCommas(cp.m_withCommas)
+	  , m_useRawFitness(cp.m_useRawFitness)
+	  , m_showValidity(cp.m_showValidity)
+	  , m_printInitial(cp.m_printInitial)
+	  , m_showIterationBoundaries(cp.m_showIterationBoundaries)
+	  , m_binaryFileName(cp.m_binaryFileName)
+	  , m_writeAsync(cp.m_writeAsync)
+{ /* nothing */ }
+
 /******************************************************************************/
 /**
  * Emits a name for this class / object
@@ -839,6 +974,8 @@ void GAllSolutionFileLogger::compare_(
 	compare_t(IDENTITY(m_showValidity, p_load->m_showValidity), token);
 	compare_t(IDENTITY(m_printInitial, p_load->m_printInitial), token);
 	compare_t(IDENTITY(m_showIterationBoundaries, p_load->m_showIterationBoundaries), token);
+	compare_t(IDENTITY(m_binaryFileName, p_load->m_binaryFileName), token);
+	compare_t(IDENTITY(m_writeAsync, p_load->m_writeAsync), token);
 
 	// React on deviations from the expectation
 	token.evaluate();
@@ -995,6 +1132,49 @@ bool GAllSolutionFileLogger::getShowIterationBoundaries() const {
 	return m_showIterationBoundaries;
 }
 
+/******************************************************************************/
+/**
+ * Sets the name of a file to which solutions are additionally written in a
+ * compact binary format. An empty name disables binary output. The file consists
+ * of one block per logged population, in native byte order:
+ *
+ * - the four characters "GSOL"
+ * - the iteration, the number of records, the number of parameters and the
+ *   number of fitness criteria, each as std::uint32_t
+ * - one column of doubles per parameter (float, integer and boolean values are
+ *   converted to double), each holding one value per record
+ * - one column of doubles per fitness criterion (NaN for unprocessed individuals)
+ * - one column of std::uint8_t holding the validity of each record
+ */
+void GAllSolutionFileLogger::setBinaryFileName(const std::string& binaryFileName) {
+	m_binaryFileName = binaryFileName;
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the name of the binary output file
+ */
+std::string GAllSolutionFileLogger::getBinaryFileName() const {
+	return m_binaryFileName;
+}
+
+/******************************************************************************/
+/**
+ * Allows to specify whether output should happen in a background thread. If so,
+ * the optimization thread only takes a snapshot of each logged individual.
+ */
+void GAllSolutionFileLogger::setWriteAsync(bool writeAsync) {
+	m_writeAsync = writeAsync;
+}
+
+/******************************************************************************/
+/**
+ * Allows to check whether output happens in a background thread
+ */
+bool GAllSolutionFileLogger::getWriteAsync() const {
+	return m_writeAsync;
+}
+
 /******************************************************************************/
 /**
  * Allows to emit information in different stages of the information cycle
@@ -1021,6 +1201,22 @@ void GAllSolutionFileLogger::informationFunction_(
 				bf::rename(m_fileName, newFileName);
 			}
 
+			// The same applies to the binary output file
+			if(not m_binaryFileName.empty() && bf::exists(m_binaryFileName)) {
+				std::string newFileName = m_binaryFileName + ".bak_" + Gem::Common::getMSSince1970();
+
+				glogger
+					<< "In GAllSolutionFileLogger::informationFunction_(): Warning!" << std::endl
+					<< "Attempt to output information to file " << m_binaryFileName << std::endl
+					<< "which already exists. We will rename the old file to" << std::endl
+					<< newFileName << std::endl
+					<< GWARNING;
+
+				bf::rename(m_binaryFileName, newFileName);
+			}
+
+			this->openWriters();
+
 			if(m_printInitial) {
 				this->printPopulation("Initial population", goa);
 			}
@@ -1034,7 +1230,10 @@ void GAllSolutionFileLogger::informationFunction_(
 			break;
 
 		case Gem::Geneva::infoMode::INFOEND:
-			// nothing
+		{
+			// Make sure all output has reached the files
+			this->closeWriters();
+		}
 			break;
 	};
 }
@@ -1062,6 +1261,8 @@ void GAllSolutionFileLogger::load_(const GObject* cp) {
 	m_showValidity = p_load->m_showValidity;
 	m_printInitial = p_load->m_printInitial;
 	m_showIterationBoundaries = p_load->m_showIterationBoundaries;
+	m_binaryFileName = p_load->m_binaryFileName;
+	m_writeAsync = p_load->m_writeAsync;
 }
 
 /******************************************************************************/
@@ -1080,34 +1281,155 @@ void GAllSolutionFileLogger::printPopulation(
 	const std::string& iterationDescription
 	, G_OptimizationAlgorithm_Base const * const goa
 ) {
-	// Open the external file
-	boost::filesystem::ofstream data(m_fileName, std::ofstream::app);
-
-	if(m_showIterationBoundaries) {
-		data
-			<< "#" << std::endl
-			<< "# -----------------------------------------------------------------------------" << std::endl
-			<< "# " << iterationDescription << ":" << std::endl
-			<< "#" << std::endl;
+	// Output files are usually opened upon initialization of the optimization run
+	if(not m_csv_writer_ptr || not m_csv_writer_ptr->isOpen()) {
+		this->openWriters();
 	}
 
+	// Take a compact snapshot of all individuals to be logged. Formatting and
+	// output may then happen outside of the optimization thread.
+	auto records_ptr = std::make_shared<std::vector<GSolutionRecord>>();
+	records_ptr->reserve(goa->size());
+	std::string firstLine; // Only filled if names and types need to be output
+
 	// Loop over all individuals of the algorithm.
 	for(std::size_t pos=0; pos<goa->size(); pos++) {
 		std::shared_ptr<GParameterSet> ind = goa->template individual_cast<GParameterSet>(pos);
 
 		// Note that isGoodEnough may throw if loop acts on a "dirty" individual
 		if(not m_boundariesActive || ind->isGoodEnough(m_boundaries)) {
-			// Append the data to the external file
-			if(0 == pos && goa->inFirstIteration()) { // Only output name and type in the very first line (if at all)
-				data << ind->toCSV(m_withNameAndType, m_withCommas, m_useRawFitness, m_showValidity);
-			} else {
-				data << ind->toCSV(false /* withNameAndType */, m_withCommas, m_useRawFitness, m_showValidity);
+			if(0 == pos && goa->inFirstIteration() && m_withNameAndType) { // Only output name and type in the very first line (if at all)
+				firstLine = ind->toCSV(true /* withNameAndType */, m_withCommas, m_useRawFitness, m_showValidity);
+			}
+			records_ptr->emplace_back(*ind, m_useRawFitness);
+		}
+	}
+
+	bool showIterationBoundaries = m_showIterationBoundaries;
+	bool withCommas = m_withCommas;
+	bool showValidity = m_showValidity;
+	m_csv_writer_ptr->write(
+		[records_ptr, firstLine, iterationDescription, showIterationBoundaries, withCommas, showValidity](std::ostream& data) {
+			if(showIterationBoundaries) {
+				data
+					<< "#" << std::endl
+					<< "# -----------------------------------------------------------------------------" << std::endl
+					<< "# " << iterationDescription << ":" << std::endl
+					<< "#" << std::endl;
+			}
+
+			auto it = records_ptr->begin();
+			if(not firstLine.empty()) { // The first record was already formatted, including names and types
+				data << firstLine;
+				++it;
+			}
+			for(; it != records_ptr->end(); ++it) {
+				it->toCSV(data, withCommas, showValidity);
 			}
 		}
+	);
+
+	if(m_binary_writer_ptr) {
+		std::uint32_t iteration = boost::numeric_cast<std::uint32_t>(goa->getIteration());
+		m_binary_writer_ptr->write(
+			[records_ptr, iteration](std::ostream& data) {
+				GAllSolutionFileLogger::writeBinaryBlock(data, iteration, *records_ptr);
+			}
+		);
+	}
+}
+
+/******************************************************************************/
+/**
+ * Opens the output files. Data is appended to existing files.
+ */
+void GAllSolutionFileLogger::openWriters() {
+	m_csv_writer_ptr.reset(new Gem::Common::GAsyncFileWriter(m_writeAsync));
+	m_csv_writer_ptr->open(m_fileName);
+
+	if(m_binaryFileName.empty()) {
+		m_binary_writer_ptr.reset();
+	} else {
+		m_binary_writer_ptr.reset(new Gem::Common::GAsyncFileWriter(m_writeAsync));
+		m_binary_writer_ptr->open(
+			m_binaryFileName
+			, std::ios_base::out | std::ios_base::app | std::ios_base::binary
+		);
+	}
+}
+
+/******************************************************************************/
+/**
+ * Waits for all pending output and closes the output files
+ */
+void GAllSolutionFileLogger::closeWriters() {
+	if(m_csv_writer_ptr) {
+		m_csv_writer_ptr->close();
+		m_csv_writer_ptr.reset();
+	}
+
+	if(m_binary_writer_ptr) {
+		m_binary_writer_ptr->close();
+		m_binary_writer_ptr.reset();
+	}
+}
+
+/******************************************************************************/
+/**
+ * Writes a block of records in binary, column-wise format. See setBinaryFileName()
+ * for a description of the format. All records need to have the same structure.
+ *
+ * @param out The stream to write to
+ * @param iteration The iteration the records belong to
+ * @param records The records to be written
+ */
+void GAllSolutionFileLogger::writeBinaryBlock(
+	std::ostream& out
+	, std::uint32_t iteration
+	, std::vector<GSolutionRecord> const& records
+) {
+	std::vector<std::vector<double>> parameters;
+	std::vector<std::vector<double>> fitness;
+	parameters.reserve(records.size());
+	fitness.reserve(records.size());
+	for(auto const & record: records) {
+		parameters.push_back(record.getParameterValues());
+		fitness.push_back(record.getFitnessValues());
+
+		if(parameters.back().size() != parameters.front().size() || fitness.back().size() != fitness.front().size()) {
+			throw gemfony_exception(
+				g_error_streamer(DO_LOG, time_and_place)
+					<< "In GAllSolutionFileLogger::writeBinaryBlock(): Error!" << std::endl
+					<< "Records of different structure found in iteration " << iteration << std::endl
+			);
+		}
+	}
+
+	std::uint32_t header[4] = {
+		iteration
+		, boost::numeric_cast<std::uint32_t>(records.size())
+		, boost::numeric_cast<std::uint32_t>(records.empty() ? 0 : parameters.front().size())
+		, boost::numeric_cast<std::uint32_t>(records.empty() ? 0 : fitness.front().size())
+	};
+
+	out.write("GSOL", 4);
+	out.write(reinterpret_cast<const char *>(header), sizeof(header));
+
+	// Values are written column-wise, so that they may be read into contiguous arrays
+	std::vector<double> column(records.size());
+	for(std::uint32_t p = 0; p < header[2]; p++) {
+		for(std::size_t r = 0; r < records.size(); r++) column[r] = parameters[r][p];
+		out.write(reinterpret_cast<const char *>(column.data()), std::streamsize(column.size() * sizeof(double)));
+	}
+	for(std::uint32_t f = 0; f < header[3]; f++) {
+		for(std::size_t r = 0; r < records.size(); r++) column[r] = fitness[r][f];
+		out.write(reinterpret_cast<const char *>(column.data()), std::streamsize(column.size() * sizeof(double)));
 	}
 
-	// Close the external file
-	data.close();
+	std::vector<std::uint8_t> validity;
+	validity.reserve(records.size());
+	for(auto const & record: records) validity.push_back(record.isValid() ? 1 : 0);
+	out.write(reinterpret_cast<const char *>(validity.data()), std::streamsize(validity.size()));
 }
 
 /******************************************************************************/
@@ -1183,6 +1505,18 @@ GIterationResultsFileLogger::GIterationResultsFileLogger(const std::string& file
 	: m_fileName(fileName)
 { /* nothing */ }
 
+/******************************************************************************/
+/**
+ * The copy constructor. The output file is not shared with the copy.
+ */
+GIterationResultsFileLogger::GIterationResultsFileLogger(const GIterationResultsFileLogger& cp)
+	: GBasePluggableOM(cp)
+	, m_fileName(cp.m_fileName)
+	, m_withCommas(cp.m_withCommas)
+	, m_useRawFitness(cp.m_useRawFitness)
+	, m_writeAsync(cp.m_writeAsync)
+{ /* nothing */ }
+
 /******************************************************************************/
 /**
  * Emits a name for this class / object
@@ -1220,6 +1554,7 @@ void GIterationResultsFileLogger::compare_(
 	compare_t(IDENTITY(m_fileName, p_load->m_fileName), token);
 	compare_t(IDENTITY(m_withCommas, p_load->m_withCommas), token);
 	compare_t(IDENTITY(m_useRawFitness, p_load->m_useRawFitness), token);
+	compare_t(IDENTITY(m_writeAsync, p_load->m_writeAsync), token);
 
 	// React on deviations from the expectation
 	token.evaluate();
@@ -1273,6 +1608,23 @@ bool GIterationResultsFileLogger::getUseTrueFitness() const {
 	return m_useRawFitness;
 }
 
+/******************************************************************************/
+/**
+ * Allows to specify whether output should happen in a background thread. If so,
+ * the optimization thread only collects the fitness values of each iteration.
+ */
+void GIterationResultsFileLogger::setWriteAsync(bool writeAsync) {
+	m_writeAsync = writeAsync;
+}
+
+/******************************************************************************/
+/**
+ * Allows to check whether output happens in a background thread
+ */
+bool GIterationResultsFileLogger::getWriteAsync() const {
+	return m_writeAsync;
+}
+
 /******************************************************************************/
 /**
  * Allows to emit information in different stages of the information cycle
@@ -1298,35 +1650,55 @@ void GIterationResultsFileLogger::informationFunction_(
 
 				bf::rename(m_fileName, newFileName);
 			}
+
+			m_writer_ptr.reset(new Gem::Common::GAsyncFileWriter(m_writeAsync));
+			m_writer_ptr->open(m_fileName);
 		}
 			break;
 
 		case Gem::Geneva::infoMode::INFOPROCESSING:
 		{
-			// Open the external file
-			boost::filesystem::ofstream data(m_fileName.c_str(), std::ofstream::app);
-			std::vector<double> fitness_cnt;
+			// The output file is usually opened upon initialization of the optimization run
+			if(not m_writer_ptr || not m_writer_ptr->isOpen()) {
+				m_writer_ptr.reset(new Gem::Common::GAsyncFileWriter(m_writeAsync));
+				m_writer_ptr->open(m_fileName);
+			}
 
-			// Loop over all individuals of the algorithm.
+			// Collect the fitness values of all individuals of the algorithm. They
+			// are then formatted and written outside of the optimization thread.
 			std::size_t nIndividuals = goa->size();
+			std::size_t nFitnessCriteria = goa->at(0)->getNStoredResults();
+			auto fitness_ptr = std::make_shared<std::vector<double>>();
+			fitness_ptr->reserve(nIndividuals*nFitnessCriteria);
 			for(std::size_t pos=0; pos<nIndividuals; pos++) {
-				std::shared_ptr<GParameterSet> ind = goa->template individual_cast<GParameterSet>(pos);
-				fitness_cnt = goa->at(pos)->raw_fitness_vec();
-
-				std::size_t nFitnessCriteria = goa->at(0)->getNStoredResults();
+				std::vector<double> fitness_cnt = goa->at(pos)->raw_fitness_vec();
 				for(std::size_t i=0; i<nFitnessCriteria; i++) {
-					data << fitness_cnt.at(i) << ((m_withCommas && (nFitnessCriteria*nIndividuals > (i+1)*(pos+1)))?", ":" ");
+					fitness_ptr->push_back(fitness_cnt.at(i));
 				}
 			}
-			data << std::endl;
 
-			// Close the external file
-			data.close();
+			bool withCommas = m_withCommas;
+			m_writer_ptr->write(
+				[fitness_ptr, nIndividuals, nFitnessCriteria, withCommas](std::ostream& data) {
+					for(std::size_t pos=0; pos<nIndividuals; pos++) {
+						for(std::size_t i=0; i<nFitnessCriteria; i++) {
+							data << (*fitness_ptr)[pos*nFitnessCriteria + i] << ((withCommas && (nFitnessCriteria*nIndividuals > (i+1)*(pos+1)))?", ":" ");
+						}
+					}
+					data << std::endl;
+				}
+			);
 		}
 			break;
 
 		case Gem::Geneva::infoMode::INFOEND:
-			// nothing
+		{
+			// Make sure all output has reached the file
+			if(m_writer_ptr) {
+				m_writer_ptr->close();
+				m_writer_ptr.reset();
+			}
+		}
 			break;
 	};
 }
@@ -1349,6 +1721,7 @@ void GIterationResultsFileLogger::load_(const GObject* cp) {
 	m_fileName = p_load->m_fileName;
 	m_withCommas = p_load->m_withCommas;
 	m_useRawFitness = p_load->m_useRawFitness;
+	m_writeAsync = p_load->m_writeAsync;
 }
 
 /************************************************************************/
@@ -1876,6 +2249,7 @@ void GProcessingTimesLogger::compare_(
 	compare_t(IDENTITY(m_all_processing_times_hist2D, p_load->m_all_processing_times_hist2D), token);
 	compare_t(IDENTITY(m_nBinsX, p_load->m_nBinsX), token);
 	compare_t(IDENTITY(m_nBinsY, p_load->m_nBinsY), token);
+	compare_t(IDENTITY(m_streamingHistograms, p_load->m_streamingHistograms), token);
 
 	// React on deviations from the expectation
 	token.evaluate();
@@ -2029,6 +2403,24 @@ std::size_t GProcessingTimesLogger::getNBinsY() const {
 	return m_nBinsY;
 }
 
+/******************************************************************************/
+/**
+ * Specifies whether the histograms should fill timings into their bins directly
+ * rather than storing every single value. This keeps memory consumption constant
+ * for long runs. Takes effect with the next optimization run.
+ */
+void GProcessingTimesLogger::setStreamingHistograms(bool streamingHistograms) {
+	m_streamingHistograms = streamingHistograms;
+}
+
+/******************************************************************************/
+/**
+ * Checks whether the histograms fill timings into their bins directly
+ */
+bool GProcessingTimesLogger::getStreamingHistograms() const {
+	return m_streamingHistograms;
+}
+
 /******************************************************************************/
 /**
  * Allows to emit information in different stages of the information cycle
@@ -2063,6 +2455,7 @@ void GProcessingTimesLogger::informationFunction_(
 			m_pre_processing_times_hist = std::make_shared<Gem::Common::GHistogram1D>(m_nBinsX);
 			m_pre_processing_times_hist->setXAxisLabel("Pre-processing time [s]");
 			m_pre_processing_times_hist->setYAxisLabel("Number of Entries");
+			m_pre_processing_times_hist->setStreaming(m_streamingHistograms);
 			m_pre_processing_times_hist->setDrawingArguments("hist");
 
 			m_gpd_pth.registerPlotter(m_pre_processing_times_hist);
@@ -2070,6 +2463,7 @@ void GProcessingTimesLogger::informationFunction_(
 			m_processing_times_hist = std::make_shared<Gem::Common::GHistogram1D>(m_nBinsX);
 			m_processing_times_hist->setXAxisLabel("Main processing time [s]");
 			m_processing_times_hist->setYAxisLabel("Number of Entries");
+			m_processing_times_hist->setStreaming(m_streamingHistograms);
 			m_processing_times_hist->setDrawingArguments("hist");
 
 			m_gpd_pth.registerPlotter(m_processing_times_hist);
@@ -2077,6 +2471,7 @@ void GProcessingTimesLogger::informationFunction_(
 			m_post_processing_times_hist = std::make_shared<Gem::Common::GHistogram1D>(m_nBinsX);
 			m_post_processing_times_hist->setXAxisLabel("Post-processing time [s]");
 			m_post_processing_times_hist->setYAxisLabel("Number of Entries");
+			m_post_processing_times_hist->setStreaming(m_streamingHistograms);
 			m_post_processing_times_hist->setDrawingArguments("hist");
 
 			m_gpd_pth.registerPlotter(m_post_processing_times_hist);
@@ -2084,6 +2479,7 @@ void GProcessingTimesLogger::informationFunction_(
 			m_all_processing_times_hist = std::make_shared<Gem::Common::GHistogram1D>(m_nBinsX);
 			m_all_processing_times_hist->setXAxisLabel("Overall processing time for all steps [s]");
 			m_all_processing_times_hist->setYAxisLabel("Number of Entries");
+			m_all_processing_times_hist->setStreaming(m_streamingHistograms);
 			m_all_processing_times_hist->setDrawingArguments("hist");
 
 			m_gpd_pth.registerPlotter(m_all_processing_times_hist);
@@ -2112,6 +2508,7 @@ void GProcessingTimesLogger::informationFunction_(
 			m_pre_processing_times_hist2D->setXAxisLabel("Iteration");
 			m_pre_processing_times_hist2D->setYAxisLabel("Pre-processing time [s]");
 			m_pre_processing_times_hist2D->setZAxisLabel("Number of Entries");
+			m_pre_processing_times_hist2D->setStreaming(m_streamingHistograms);
 			m_pre_processing_times_hist2D->setDrawingArguments("box");
 
 			m_gpd_pth2.registerPlotter(m_pre_processing_times_hist2D);
@@ -2121,6 +2518,7 @@ void GProcessingTimesLogger::informationFunction_(
 			m_processing_times_hist2D->setXAxisLabel("Iteration");
 			m_processing_times_hist2D->setYAxisLabel("Main processing time [s]");
 			m_processing_times_hist2D->setZAxisLabel("Number of Entries");
+			m_processing_times_hist2D->setStreaming(m_streamingHistograms);
 			m_processing_times_hist2D->setDrawingArguments("box");
 
 			m_gpd_pth2.registerPlotter(m_processing_times_hist2D);
@@ -2129,6 +2527,7 @@ void GProcessingTimesLogger::informationFunction_(
 			m_post_processing_times_hist2D->setXAxisLabel("Iteration");
 			m_post_processing_times_hist2D->setYAxisLabel("Post-processing time [s]");
 			m_post_processing_times_hist2D->setZAxisLabel("Number of Entries");
+			m_post_processing_times_hist2D->setStreaming(m_streamingHistograms);
 			m_post_processing_times_hist2D->setDrawingArguments("box");
 
 			m_gpd_pth2.registerPlotter(m_post_processing_times_hist2D);
@@ -2137,6 +2536,7 @@ void GProcessingTimesLogger::informationFunction_(
 			m_all_processing_times_hist2D->setXAxisLabel("Iteration");
 			m_all_processing_times_hist2D->setYAxisLabel("Overall processing time [s]");
 			m_all_processing_times_hist2D->setZAxisLabel("Number of Entries");
+			m_all_processing_times_hist2D->setStreaming(m_streamingHistograms);
 			m_all_processing_times_hist2D->setDrawingArguments("box");
 
 			m_gpd_pth2.registerPlotter(m_all_processing_times_hist2D);
@@ -2260,6 +2660,7 @@ void GProcessingTimesLogger::load_(const GObject* cp) {
 	Gem::Common::copyCloneableSmartPointer(p_load->m_all_processing_times_hist2D, m_all_processing_times_hist2D);
 
 	m_nBinsX = p_load->m_nBinsX;
+	m_streamingHistograms = p_load->m_streamingHistograms;
 }
 
 /************************************************************************/
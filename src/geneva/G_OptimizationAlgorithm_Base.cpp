@@ -208,6 +208,10 @@ G_OptimizationAlgorithm_Base::G_OptimizationAlgorithm_Base(const G_OptimizationA
 	  , m_cp_last(cp.m_cp_last)
 	  , m_cp_remove(cp.m_cp_remove)
 	  , m_cp_serialization_mode(cp.m_cp_serialization_mode)
+	  , m_cp_async(cp.m_cp_async)
+	  , m_cp_full_interval(cp.m_cp_full_interval)
+	  , m_cp_delta_base(cp.m_cp_delta_base)
+	  , m_cp_delta_ids(cp.m_cp_delta_ids)
 	  , m_qualityThreshold(cp.m_qualityThreshold)
 	  , m_hasQualityThreshold(cp.m_hasQualityThreshold)
 	  , m_maxDuration(cp.m_maxDuration)
@@ -260,20 +264,125 @@ void G_OptimizationAlgorithm_Base::checkpoint(bool is_better) const {
 		do_save = true;
 	} // Save the final result
 
+	if(not do_save) return;
+
+	// Collect any errors from checkpoints written in the background
+	this->collectFinishedCheckpoints();
+
+	// In delta mode only every m_cp_full_interval-th checkpoint is complete.
+	// The first checkpoint of an optimization run always is.
+	bool is_full =
+		m_cp_full_interval <= 1
+		|| m_cp_last_full == "empty"
+		|| 0 == m_cp_counter % m_cp_full_interval;
+	m_cp_counter++;
+
+	// Files that become obsolete once the new checkpoint has been written. A
+	// delta checkpoint does not replace the complete checkpoint it refers to.
+	std::vector<bf::path> obsolete_files;
+	if(m_cp_remove) {
+		if(m_cp_last != "empty" && m_cp_last != m_cp_last_full && m_cp_last != output_file.string()) {
+			obsolete_files.push_back(bf::path(m_cp_last));
+		}
+		if(is_full && m_cp_last_full != "empty" && m_cp_last_full != output_file.string()) {
+			obsolete_files.push_back(bf::path(m_cp_last_full));
+		}
+	}
 
-	if(do_save) {
-		saveCheckpoint(output_file);
+	// Take a snapshot of the current state, unless we write synchronously and completely
+	std::shared_ptr<G_OptimizationAlgorithm_Base> snapshot_ptr;
+	if(m_cp_async || not is_full) {
+		snapshot_ptr = this->clone<G_OptimizationAlgorithm_Base>();
+	}
 
-		// Remove the last checkoint file if requested by the user
-		if(m_cp_remove && m_cp_last != "empty") {
-			if(boost::filesystem::exists(boost::filesystem::path(m_cp_last))) {
-				boost::filesystem::remove(boost::filesystem::path(m_cp_last));
+	if(is_full) {
+		m_cp_full_ids.clear();
+		for(auto const & ind_ptr: *this) {
+			if(ind_ptr->is_processed()) m_cp_full_ids.insert(ind_ptr->getCurrentEvaluationID());
+		}
+		m_cp_last_full = output_file.string();
+	} else {
+		// Only keep individuals that have changed since the last complete checkpoint
+		std::vector<std::shared_ptr<GParameterSet>> population(snapshot_ptr->begin(), snapshot_ptr->end());
+		snapshot_ptr->clear();
+		snapshot_ptr->m_cp_delta_ids.clear();
+		snapshot_ptr->m_cp_delta_base = output_file.parent_path() == bf::path(m_cp_last_full).parent_path()
+			? bf::path(m_cp_last_full).filename().string()
+			: m_cp_last_full;
+
+		for(auto const & ind_ptr: population) {
+			if(ind_ptr->is_processed() && m_cp_full_ids.count(ind_ptr->getCurrentEvaluationID())) {
+				snapshot_ptr->m_cp_delta_ids.push_back(ind_ptr->getCurrentEvaluationID());
+			} else {
+				snapshot_ptr->m_cp_delta_ids.push_back(std::string());
+				snapshot_ptr->push_back(ind_ptr);
 			}
 		}
+	}
+
+	// Record the name of the last known checkpoint file
+	m_cp_last = output_file.string();
+
+	auto write_checkpoint = [this, snapshot_ptr, output_file, obsolete_files]() {
+		if(snapshot_ptr) {
+			snapshot_ptr->saveCheckpoint(output_file);
+		} else {
+			this->saveCheckpoint(output_file);
+		}
+
+		// Remove old checkpoint files if requested by the user
+		for(auto const & obsolete_file: obsolete_files) {
+			if(bf::exists(obsolete_file)) bf::remove(obsolete_file);
+		}
+	};
+
+	if(m_cp_async) {
+		// A single thread makes sure files are written and removed in order
+		if(not m_cp_writer_ptr) {
+			m_cp_writer_ptr = std::make_shared<Gem::Common::GThreadPool>(1);
+		}
+		m_cp_futures_cnt.push_back(m_cp_writer_ptr->async_schedule(write_checkpoint));
+	} else {
+		write_checkpoint();
+	}
+}
+
+/******************************************************************************/
+/**
+ * Passes on errors of checkpoints that have already been written in the background
+ */
+void G_OptimizationAlgorithm_Base::collectFinishedCheckpoints() const {
+	auto it = m_cp_futures_cnt.begin();
+	while(it != m_cp_futures_cnt.end()) {
+		if(std::future_status::ready == it->wait_for(std::chrono::seconds(0))) {
+			std::future<void> f = std::move(*it);
+			it = m_cp_futures_cnt.erase(it);
+			f.get(); // Throws, if writing the checkpoint has failed
+		} else {
+			++it;
+		}
+	}
+}
+
+/******************************************************************************/
+/**
+ * Waits until all checkpoint files scheduled for writing have been written.
+ * The first error encountered while writing is passed on.
+ */
+void G_OptimizationAlgorithm_Base::waitForCheckpoints() const {
+	std::vector<std::future<void>> futures_cnt;
+	futures_cnt.swap(m_cp_futures_cnt);
 
-		// Record the name of the last known checkpoint file
-		m_cp_last = output_file.string();
+	std::exception_ptr e_ptr;
+	for(auto& f: futures_cnt) {
+		try {
+			f.get();
+		} catch(...) {
+			if(not e_ptr) e_ptr = std::current_exception();
+		}
 	}
+
+	if(e_ptr) std::rethrow_exception(e_ptr);
 }
 
 /******************************************************************************/
@@ -296,6 +405,53 @@ void G_OptimizationAlgorithm_Base::loadCheckpoint(bf::path const & cpFile) {
 	}
 
 	this->fromFile(cpFile, this->getCheckpointSerializationMode());
+
+	// Delta checkpoints only hold the individuals that changed since the
+	// complete checkpoint they refer to. Reassemble the population from both.
+	if(not m_cp_delta_base.empty()) {
+		bf::path base_file(m_cp_delta_base);
+		if(not base_file.has_parent_path()) {
+			base_file = cpFile.parent_path() / base_file;
+		}
+
+		std::shared_ptr<G_OptimizationAlgorithm_Base> base_ptr = this->clone<G_OptimizationAlgorithm_Base>();
+		base_ptr->loadCheckpoint(base_file);
+
+		std::map<std::string, std::shared_ptr<GParameterSet>> base_individuals;
+		for(auto const & ind_ptr: *base_ptr) {
+			if(ind_ptr->is_processed()) base_individuals[ind_ptr->getCurrentEvaluationID()] = ind_ptr;
+		}
+
+		std::vector<std::shared_ptr<GParameterSet>> changed(this->begin(), this->end());
+		auto changed_it = changed.begin();
+		this->clear();
+
+		for(auto const & id: m_cp_delta_ids) {
+			if(id.empty()) {
+				if(changed_it == changed.end()) {
+					throw gemfony_exception(
+						g_error_streamer(DO_LOG,  time_and_place)
+							<< "In G_OptimizationAlgorithm_Base<>::loadCheckpoint(): Error!" << std::endl
+							<< "Delta checkpoint file " << cpFile << " holds too few individuals" << std::endl
+					);
+				}
+				this->push_back(*changed_it++);
+			} else {
+				auto base_it = base_individuals.find(id);
+				if(base_it == base_individuals.end()) {
+					throw gemfony_exception(
+						g_error_streamer(DO_LOG,  time_and_place)
+							<< "In G_OptimizationAlgorithm_Base<>::loadCheckpoint(): Error!" << std::endl
+							<< "Individual " << id << " was not found in checkpoint file " << base_file << std::endl
+					);
+				}
+				this->push_back(base_it->second->clone<GParameterSet>());
+			}
+		}
+
+		m_cp_delta_base.clear();
+		m_cp_delta_ids.clear();
+	}
 }
 
 /******************************************************************************/
@@ -455,6 +611,45 @@ bool G_OptimizationAlgorithm_Base::checkpointFilesAreRemoved() const {
 	return m_cp_remove;
 }
 
+/******************************************************************************/
+/**
+ * Specifies whether checkpoint files should be written by a background thread.
+ * The state of the algorithm is then copied in memory, and serialization and
+ * file output happen outside of the optimization cycle. Files are first
+ * written under a temporary name and then renamed.
+ */
+void G_OptimizationAlgorithm_Base::setCheckpointAsync(bool cp_async) {
+	m_cp_async = cp_async;
+}
+
+/******************************************************************************/
+/**
+ * Checks whether checkpoint files are written by a background thread
+ */
+bool G_OptimizationAlgorithm_Base::getCheckpointAsync() const {
+	return m_cp_async;
+}
+
+/******************************************************************************/
+/**
+ * Sets how often complete checkpoints are written. With a value n > 1, only every
+ * n-th checkpoint (as well as the first and the final one) holds the entire
+ * population. The checkpoints in between only hold the individuals that changed
+ * since the last complete checkpoint and refer to it. 0 or 1 means that all
+ * checkpoints are complete.
+ */
+void G_OptimizationAlgorithm_Base::setCheckpointFullInterval(std::uint32_t cp_full_interval) {
+	m_cp_full_interval = cp_full_interval;
+}
+
+/******************************************************************************/
+/**
+ * Retrieves how often complete checkpoints are written
+ */
+std::uint32_t G_OptimizationAlgorithm_Base::getCheckpointFullInterval() const {
+	return m_cp_full_interval;
+}
+
 /******************************************************************************/
 /**
  * Searches for compliance with expectations with respect to another object
@@ -501,6 +696,10 @@ void G_OptimizationAlgorithm_Base::compare_(
 	compare_t(IDENTITY(m_cp_last, p_load->m_cp_last), token);
 	compare_t(IDENTITY(m_cp_remove, p_load->m_cp_remove), token);
 	compare_t(IDENTITY(m_cp_serialization_mode, p_load->m_cp_serialization_mode), token);
+	compare_t(IDENTITY(m_cp_async, p_load->m_cp_async), token);
+	compare_t(IDENTITY(m_cp_full_interval, p_load->m_cp_full_interval), token);
+	compare_t(IDENTITY(m_cp_delta_base, p_load->m_cp_delta_base), token);
+	compare_t(IDENTITY(m_cp_delta_ids, p_load->m_cp_delta_ids), token);
 	compare_t(IDENTITY(m_qualityThreshold, p_load->m_qualityThreshold), token);
 	compare_t(IDENTITY(m_hasQualityThreshold, p_load->m_hasQualityThreshold), token);
 	compare_t(IDENTITY(m_maxDuration.count(), p_load->m_maxDuration.count()), token); // Cannot directly compare std::chrono::duration<double>
@@ -705,6 +904,12 @@ G_OptimizationAlgorithm_Base const * const G_OptimizationAlgorithm_Base::optimiz
 			actOnStalls_();
 		}
 
+		// Give external code (e.g. concurrently running islands) an opportunity
+		// to exchange individuals with this population
+		if(m_migration_hook) {
+			m_migration_hook(*this);
+		}
+
 		// We want to provide feedback to the user in regular intervals.
 		// Set the reportGeneration_ variable to 0 in order not to emit
 		// any information at all.
@@ -1282,6 +1487,23 @@ void G_OptimizationAlgorithm_Base::addConfigurationOptions_ (
 		<< "Determines whether check-pointing should be done in" << std::endl
 		<< "text- (0), XML- (1), or binary-mode (2)";
 
+	gpb.registerFileParameter<bool>(
+		"cpAsync" // The name of the variable
+		, DEFAULTCPASYNC // The default value
+		, [this](bool cp_async){ this->setCheckpointAsync(cp_async); }
+	)
+		<< "When set to \"true\", checkpoint files are written by a background" << std::endl
+		<< "thread from a copy of the algorithm's state";
+
+	gpb.registerFileParameter<std::uint32_t>(
+		"cpFullInterval" // The name of the variable
+		, DEFAULTCPFULLINTERVAL // The default value
+		, [this](std::uint32_t cp_full_interval){ this->setCheckpointFullInterval(cp_full_interval); }
+	)
+		<< "Only every n-th checkpoint holds the entire population. The others" << std::endl
+		<< "only hold individuals changed since the last complete checkpoint." << std::endl
+		<< "0 or 1 means: All checkpoints are complete";
+
 	gpb.registerFileParameter<double, bool>(
 		"threshold" // The name of the variable
 		, "thresholdActive"
@@ -1440,6 +1662,166 @@ bool G_OptimizationAlgorithm_Base::cp_personality_fits(const boost::filesystem::
 	return opt_desc == this->getAlgorithmPersonalityType();
 }
 
+/******************************************************************************/
+/**
+ * Registers a function to be called at the end of each iteration, after all
+ * book-keeping for this iteration has been done. Go2 uses this facility to
+ * exchange individuals between concurrently running islands. The hook is
+ * neither serialized nor copied.
+ *
+ * @param migrationHook The function to be called at the end of each iteration
+ */
+void G_OptimizationAlgorithm_Base::registerMigrationHook(
+	std::function<void(G_OptimizationAlgorithm_Base &)> migrationHook
+) {
+	if(not migrationHook) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG,  time_and_place)
+				<< "In G_OptimizationAlgorithm_Base::registerMigrationHook(): Error!" << std::endl
+				<< "Received empty migration hook" << std::endl
+		);
+	}
+
+	m_migration_hook = migrationHook;
+}
+
+/******************************************************************************/
+/**
+ * Removes a registered migration hook
+ */
+void G_OptimizationAlgorithm_Base::resetMigrationHook() {
+	m_migration_hook = std::function<void(G_OptimizationAlgorithm_Base &)>();
+}
+
+/******************************************************************************/
+/**
+ * Checks whether a migration hook has been registered
+ */
+bool G_OptimizationAlgorithm_Base::hasMigrationHook() const {
+	return bool(m_migration_hook);
+}
+
+/******************************************************************************/
+/**
+ * Retrieves copies of the best processed individuals of the current population,
+ * e.g. so they may be sent to other populations. Fewer individuals are returned
+ * if the population does not hold enough processed individuals.
+ *
+ * @param nEmigrants The desired number of individuals
+ * @return Copies of the best processed individuals, best first
+ */
+std::vector<std::shared_ptr<GParameterSet>> G_OptimizationAlgorithm_Base::getEmigrants(
+	std::size_t nEmigrants
+) const {
+	std::vector<std::shared_ptr<GParameterSet>> candidates;
+	for(auto const & ind_ptr: *this) {
+		if(ind_ptr->is_processed()) candidates.push_back(ind_ptr);
+	}
+
+	nEmigrants = (std::min)(nEmigrants, candidates.size());
+	std::partial_sort(
+		candidates.begin()
+		, candidates.begin() + nEmigrants
+		, candidates.end()
+		, [](std::shared_ptr<GParameterSet> const & x_ptr, std::shared_ptr<GParameterSet> const & y_ptr) -> bool {
+			return minOnly_transformed_fitness(x_ptr) < minOnly_transformed_fitness(y_ptr);
+		}
+	);
+
+	std::vector<std::shared_ptr<GParameterSet>> emigrants;
+	for(std::size_t i=0; i<nEmigrants; i++) {
+		emigrants.push_back(candidates.at(i)->clone<GParameterSet>());
+	}
+
+	return emigrants;
+}
+
+/******************************************************************************/
+/**
+ * Lets individuals from other populations replace local individuals. Which
+ * individuals may be replaced is up to the optimization algorithm. Only
+ * immigrants better than the individuals they replace are accepted.
+ *
+ * @param immigrants Processed individuals from other populations
+ * @return The number of immigrants that were accepted
+ */
+std::size_t G_OptimizationAlgorithm_Base::integrateImmigrants(
+	std::vector<std::shared_ptr<GParameterSet>> const & immigrants
+) {
+	return this->integrateImmigrants_(immigrants);
+}
+
+/******************************************************************************/
+/**
+ * Lets immigrants replace the worst individuals of the entire population.
+ * Derived classes may restrict this to parts of their population.
+ *
+ * @param immigrants Processed individuals from other populations
+ * @return The number of immigrants that were accepted
+ */
+std::size_t G_OptimizationAlgorithm_Base::integrateImmigrants_(
+	std::vector<std::shared_ptr<GParameterSet>> const & immigrants
+) {
+	return this->replaceWorstIndividuals(immigrants, 0, this->size());
+}
+
+/******************************************************************************/
+/**
+ * Replaces the worst individuals in the range [first, last[ with copies of
+ * better immigrants. The replaced individuals' personalities are retained,
+ * so that algorithm-specific information (such as the position in the
+ * population) remains valid. Unprocessed immigrants are ignored.
+ *
+ * @param immigrants Processed individuals from other populations
+ * @param first The first position that may be replaced
+ * @param last The position after the last one that may be replaced
+ * @return The number of immigrants that were accepted
+ */
+std::size_t G_OptimizationAlgorithm_Base::replaceWorstIndividuals(
+	std::vector<std::shared_ptr<GParameterSet>> const & immigrants
+	, std::size_t first
+	, std::size_t last
+) {
+	last = (std::min)(last, this->size());
+	if(first >= last) return 0;
+
+	std::size_t nAccepted = 0;
+	for(auto const & imm_ptr: immigrants) {
+		if(not imm_ptr || not imm_ptr->is_processed()) continue;
+
+		// Find the worst individual in the range. Unprocessed individuals count as worst
+		std::size_t worstPos = first;
+		for(std::size_t pos=first; pos<last; pos++) {
+			if(not this->at(pos)->is_processed()) {
+				worstPos = pos;
+				break;
+			}
+
+			if(
+				this->at(worstPos)->is_processed()
+				&& minOnly_transformed_fitness(this->at(pos)) > minOnly_transformed_fitness(this->at(worstPos))
+			) {
+				worstPos = pos;
+			}
+		}
+
+		if(
+			this->at(worstPos)->is_processed()
+			&& minOnly_transformed_fitness(imm_ptr) >= minOnly_transformed_fitness(this->at(worstPos))
+		) {
+			continue;
+		}
+
+		std::shared_ptr<GPersonalityTraits> pt_ptr = this->at(worstPos)->getPersonalityTraits();
+		this->at(worstPos) = imm_ptr->clone<GParameterSet>();
+		if(pt_ptr) this->at(worstPos)->setPersonality(pt_ptr);
+
+		nAccepted++;
+	}
+
+	return nAccepted;
+}
+
 /******************************************************************************/
 /**
  * Loads the data of another GOptimizationAlgorithm object
@@ -1475,6 +1857,10 @@ void G_OptimizationAlgorithm_Base::load_(const GObject* cp) {
 	m_cp_last = p_load->m_cp_last;
 	m_cp_remove = p_load->m_cp_remove;
 	m_cp_serialization_mode = p_load->m_cp_serialization_mode;
+	m_cp_async = p_load->m_cp_async;
+	m_cp_full_interval = p_load->m_cp_full_interval;
+	m_cp_delta_base = p_load->m_cp_delta_base;
+	m_cp_delta_ids = p_load->m_cp_delta_ids;
 	m_qualityThreshold = p_load->m_qualityThreshold;
 	m_hasQualityThreshold = p_load->m_hasQualityThreshold;
 	m_terminationFile = p_load->m_terminationFile;
@@ -1495,23 +1881,34 @@ void G_OptimizationAlgorithm_Base::load_(const GObject* cp) {
  * Delegation of work to be performed to the private executor object. Note that
  * the return values "is_complete" and "has_errors" may both be true, i.e. all items
  * may have returned, but there were errors in some or all of them. The function
- * will also make the executor use this objects iteration counter.
+ * will by default make the executor use this objects iteration counter. Algorithms
+ * submitting more than once per iteration need to let the executor count submissions
+ * itself, as the external counter must increase with every call. Where supported
+ * and requested by the individuals, their main fitness is precomputed for the entire
+ * set of work items through GParameterSet::batchEvaluation().
  *
  * @param workItems The set of work items to be processed
  * @param resubmitUnprocessed Indicates whether unprocessed work items should be resubmitted after a timeout
  * @param caller The name of the caller (used for error messages and logs)
+ * @param useIterationCounter Whether the executor should use this object's iteration counter
  * @return A struct which indicates whether all items have returned ("is_complete") and whether there were errors ("has_errors")
  */
 Gem::Courtier::executor_status_t G_OptimizationAlgorithm_Base::workOn(
 	std::vector<std::shared_ptr<GParameterSet>>& workItems
 	, bool resubmitUnprocessed
 	, const std::string &caller
+	, bool useIterationCounter
 ) {
 	auto iterationCounter = std::make_tuple<Gem::Courtier::ITERATION_COUNTER_TYPE, bool>(
 		boost::numeric_cast<Gem::Courtier::ITERATION_COUNTER_TYPE>(this->getIteration())
-		, true
+		, bool(useIterationCounter)
 	);
 
+	// Let the individuals calculate their fitness in a single batch, if they support
+	// this. The executor then only needs to apply the precomputed values. Otherwise
+	// items are evaluated one by one inside of the executor.
+	GParameterSet::batchEvaluation(workItems);
+
 	return m_executor_ptr->workOn(
 		workItems
 		, resubmitUnprocessed
@@ -1533,7 +1930,12 @@ std::vector<std::shared_ptr<GParameterSet>> G_OptimizationAlgorithm_Base::getOld
  * Saves the state of the class to disc
  */
 void G_OptimizationAlgorithm_Base::saveCheckpoint(bf::path const& outputFile) const {
-	this->toFile(outputFile, this->getCheckpointSerializationMode());
+	// Write to a temporary file first, so an existing file is only replaced by a complete one
+	bf::path tmpFile = outputFile;
+	tmpFile += ".tmp";
+
+	this->toFile(tmpFile, this->getCheckpointSerializationMode());
+	bf::rename(tmpFile, outputFile);
 }
 
 /******************************************************************************/
@@ -1727,6 +2129,11 @@ void G_OptimizationAlgorithm_Base::init() {
 
 	// Initialize the executor
 	m_executor_ptr->init();
+
+	// Each optimization run starts with a complete checkpoint
+	m_cp_counter = 0;
+	m_cp_last_full = "empty";
+	m_cp_full_ids.clear();
 }
 
 /******************************************************************************/
@@ -1738,6 +2145,9 @@ void G_OptimizationAlgorithm_Base::init() {
 void G_OptimizationAlgorithm_Base::finalize() {
 	// Finalize the broker connector
 	m_executor_ptr->finalize();
+
+	// Make sure all checkpoint files have been written
+	this->waitForCheckpoints();
 }
 
 /******************************************************************************/
@@ -88,6 +88,13 @@ void GEvolutionaryAlgorithm::compare_(
 // ... and then the local data
 	compare_t(IDENTITY(m_sorting_mode, p_load->m_sorting_mode), token);
 	compare_t(IDENTITY(m_n_threads, p_load->m_n_threads), token);
+	compare_t(IDENTITY(m_use_steady_state, p_load->m_use_steady_state), token);
+	compare_t(IDENTITY(m_steady_state_batch_size, p_load->m_steady_state_batch_size), token);
+	compare_t(IDENTITY(m_cancel_hopeless_children, p_load->m_cancel_hopeless_children), token);
+	compare_t(IDENTITY(m_use_surrogate, p_load->m_use_surrogate), token);
+	compare_t(IDENTITY(m_surrogate_overgeneration, p_load->m_surrogate_overgeneration), token);
+	compare_t(IDENTITY(m_surrogate_refresh_interval, p_load->m_surrogate_refresh_interval), token);
+	compare_t(IDENTITY(m_surrogate_archive_size, p_load->m_surrogate_archive_size), token);
 
 // React on deviations from the expectation
 	token.evaluate();
@@ -299,6 +306,63 @@ void GEvolutionaryAlgorithm::addConfigurationOptions_ (
 		<< "   unless a better individual has been found" << std::endl
 		<< "3: MUPLUSNU mode for multiple evaluation criteria, pareto selection" << std::endl
 		<< "4: MUCOMMANU mode for multiple evaluation criteria, pareto selection";
+
+	gpb.registerFileParameter<bool>(
+		"useSteadyState" // The name of the variable
+		, DEFAULTEASTEADYSTATE // The default value
+		, [this](bool uss) { this->setUseSteadyState(uss); }
+	)
+		<< "Evaluates children in batches. Each batch competes with the" << std::endl
+		<< "parents as soon as it returns, later batches are bred from" << std::endl
+		<< "the updated parents. Requires sortingMethod 0 (MUPLUSNU)";
+
+	gpb.registerFileParameter<std::size_t>(
+		"steadyStateBatchSize" // The name of the variable
+		, DEFAULTEASTEADYSTATEBATCHSIZE // The default value
+		, [this](std::size_t bs) { this->setSteadyStateBatchSize(bs); }
+	)
+		<< "The number of children evaluated together in steady-state mode." << std::endl
+		<< "Should roughly match the number of available evaluation slots";
+
+	gpb.registerFileParameter<bool>(
+		"cancelHopelessChildren" // The name of the variable
+		, DEFAULTEACANCELHOPELESSCHILDREN // The default value
+		, [this](bool chc) { this->setCancelHopelessChildren(chc); }
+	)
+		<< "Lets children stop their evaluation as soon as they report an" << std::endl
+		<< "intermediate fitness that cannot beat the worst parent." << std::endl
+		<< "Only used with sortingMethod 0 (MUPLUSNU)";
+
+	gpb.registerFileParameter<bool>(
+		"useSurrogate" // The name of the variable
+		, DEFAULTEAUSESURROGATE // The default value
+		, [this](bool us) { this->setUseSurrogate(us); }
+	)
+		<< "Creates surplus children and submits only those a cheap" << std::endl
+		<< "surrogate model of the evaluation function considers most" << std::endl
+		<< "promising. Useful for expensive evaluation functions";
+
+	gpb.registerFileParameter<double>(
+		"surrogateOvergeneration" // The name of the variable
+		, DEFAULTEASURROGATEOVERGENERATION // The default value
+		, [this](double og) { this->setSurrogateOvergeneration(og); }
+	)
+		<< "The number of candidates created per child for surrogate" << std::endl
+		<< "pre-screening. Must be >= 1";
+
+	gpb.registerFileParameter<std::uint32_t>(
+		"surrogateRefreshInterval" // The name of the variable
+		, DEFAULTEASURROGATEREFRESHINTERVAL // The default value
+		, [this](std::uint32_t ri) { this->setSurrogateRefreshInterval(ri); }
+	)
+		<< "The number of iterations after which the surrogate model is refreshed";
+
+	gpb.registerFileParameter<std::size_t>(
+		"surrogateArchiveSize" // The name of the variable
+		, DEFAULTEASURROGATEARCHIVESIZE // The default value
+		, [this](std::size_t as) { this->setSurrogateArchiveSize(as); }
+	)
+		<< "The number of evaluated individuals kept by the surrogate model";
 }
 
 /******************************************************************************/
@@ -342,6 +406,214 @@ std::uint16_t GEvolutionaryAlgorithm::getNThreads() const {
 	return m_n_threads;
 }
 
+/******************************************************************************/
+/**
+ * Switches the asynchronous steady-state mode on or off. In this mode children
+ * are evaluated in batches of m_steady_state_batch_size items. Each batch competes
+ * with the parents as soon as it has returned, and later batches are bred from
+ * the updated parents. The mode requires MUPLUSNU_SINGLEEVAL sorting.
+ *
+ * @param useSteadyState Whether the steady-state mode should be used
+ */
+void GEvolutionaryAlgorithm::setUseSteadyState(bool useSteadyState) {
+	m_use_steady_state = useSteadyState;
+}
+
+/******************************************************************************/
+/**
+ * Checks whether the asynchronous steady-state mode is used
+ *
+ * @return A boolean indicating whether the steady-state mode is used
+ */
+bool GEvolutionaryAlgorithm::getUseSteadyState() const {
+	return m_use_steady_state;
+}
+
+/******************************************************************************/
+/**
+ * Sets the number of children evaluated together in steady-state mode
+ *
+ * @param batchSize The number of children evaluated together
+ */
+void GEvolutionaryAlgorithm::setSteadyStateBatchSize(std::size_t batchSize) {
+	if (0 == batchSize) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG,  time_and_place)
+				<< "In GEvolutionaryAlgorithm::setSteadyStateBatchSize(): Error!" << std::endl
+				<< "Batch size must not be 0" << std::endl
+		);
+	}
+
+	m_steady_state_batch_size = batchSize;
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the number of children evaluated together in steady-state mode
+ *
+ * @return The number of children evaluated together
+ */
+std::size_t GEvolutionaryAlgorithm::getSteadyStateBatchSize() const {
+	return m_steady_state_batch_size;
+}
+
+/******************************************************************************/
+/**
+ * Allows children to stop their evaluation once they cannot beat the worst
+ * parent. Children are told the fitness of the worst parent as their
+ * cancellation bound. Fitness calculations that report intermediate results
+ * through GParameterSet::reportIntermediateFitness() may then give up early.
+ * Cancelled children are treated like children with errors. As only
+ * MUPLUSNU_SINGLEEVAL selection guarantees that such children would not have
+ * been selected, the setting is ignored for other sorting schemes.
+ *
+ * @param cancelHopelessChildren Whether hopeless children may stop their evaluation
+ */
+void GEvolutionaryAlgorithm::setCancelHopelessChildren(bool cancelHopelessChildren) {
+	m_cancel_hopeless_children = cancelHopelessChildren;
+}
+
+/******************************************************************************/
+/**
+ * Checks whether children may stop their evaluation once they cannot beat the worst parent
+ *
+ * @return A boolean indicating whether hopeless children may stop their evaluation
+ */
+bool GEvolutionaryAlgorithm::getCancelHopelessChildren() const {
+	return m_cancel_hopeless_children;
+}
+
+/******************************************************************************/
+/**
+ * Tells children in a given range which (minimization-only) fitness they need
+ * to beat in order to have a chance of being selected. Where hopeless children
+ * may not be cancelled, the bound is removed.
+ *
+ * @param first The first child to be submitted
+ * @param last The position after the last child to be submitted
+ */
+void GEvolutionaryAlgorithm::setChildCancellationBounds(std::size_t first, std::size_t last) {
+	double bound = std::numeric_limits<double>::max();
+	if (
+		m_cancel_hopeless_children
+		&& sortingMode::MUPLUSNU_SINGLEEVAL == m_sorting_mode
+		&& not this->inFirstIteration()
+	) {
+		bound = minOnly_transformed_fitness(this->at(this->getNParents() - 1));
+	}
+
+	for (auto it = this->begin() + first; it != this->begin() + last; ++it) {
+		(*it)->setCancellationBound(bound);
+	}
+}
+
+/******************************************************************************/
+/**
+ * Switches surrogate pre-screening of children on or off. In this mode
+ * m_surrogate_overgeneration candidates are created per child. A surrogate
+ * model, trained on all individuals evaluated so far, predicts their (primary)
+ * fitness, and only the most promising candidates are submitted for evaluation.
+ *
+ * @param useSurrogate Whether children should be pre-screened with a surrogate model
+ */
+void GEvolutionaryAlgorithm::setUseSurrogate(bool useSurrogate) {
+	m_use_surrogate = useSurrogate;
+}
+
+/******************************************************************************/
+/**
+ * Checks whether children are pre-screened with a surrogate model
+ *
+ * @return A boolean indicating whether surrogate pre-screening is used
+ */
+bool GEvolutionaryAlgorithm::getUseSurrogate() const {
+	return m_use_surrogate;
+}
+
+/******************************************************************************/
+/**
+ * Sets the number of candidates created per child for surrogate pre-screening
+ *
+ * @param overgeneration The number of candidates per child (must be >= 1)
+ */
+void GEvolutionaryAlgorithm::setSurrogateOvergeneration(double overgeneration) {
+	if (not (overgeneration >= 1.)) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG,  time_and_place)
+				<< "In GEvolutionaryAlgorithm::setSurrogateOvergeneration(): Error!" << std::endl
+				<< "Invalid overgeneration factor " << overgeneration << " (must be >= 1)" << std::endl
+		);
+	}
+
+	m_surrogate_overgeneration = overgeneration;
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the number of candidates created per child for surrogate pre-screening
+ *
+ * @return The number of candidates per child
+ */
+double GEvolutionaryAlgorithm::getSurrogateOvergeneration() const {
+	return m_surrogate_overgeneration;
+}
+
+/******************************************************************************/
+/**
+ * Sets the number of iterations after which the surrogate model is refreshed
+ *
+ * @param refreshInterval The number of iterations between two refreshes of the model
+ */
+void GEvolutionaryAlgorithm::setSurrogateRefreshInterval(std::uint32_t refreshInterval) {
+	if (0 == refreshInterval) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG,  time_and_place)
+				<< "In GEvolutionaryAlgorithm::setSurrogateRefreshInterval(): Error!" << std::endl
+				<< "Refresh interval must not be 0" << std::endl
+		);
+	}
+
+	m_surrogate_refresh_interval = refreshInterval;
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the number of iterations after which the surrogate model is refreshed
+ *
+ * @return The number of iterations between two refreshes of the model
+ */
+std::uint32_t GEvolutionaryAlgorithm::getSurrogateRefreshInterval() const {
+	return m_surrogate_refresh_interval;
+}
+
+/******************************************************************************/
+/**
+ * Sets the number of evaluated individuals kept by the surrogate model
+ *
+ * @param archiveSize The number of individuals kept by the model
+ */
+void GEvolutionaryAlgorithm::setSurrogateArchiveSize(std::size_t archiveSize) {
+	if (archiveSize < Gem::Common::DEFAULTRBFNNEIGHBORS) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG,  time_and_place)
+				<< "In GEvolutionaryAlgorithm::setSurrogateArchiveSize(): Error!" << std::endl
+				<< "Archive size " << archiveSize << " is smaller than the minimum of " << Gem::Common::DEFAULTRBFNNEIGHBORS << std::endl
+		);
+	}
+
+	m_surrogate_archive_size = archiveSize;
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the number of evaluated individuals kept by the surrogate model
+ *
+ * @return The number of individuals kept by the model
+ */
+std::size_t GEvolutionaryAlgorithm::getSurrogateArchiveSize() const {
+	return m_surrogate_archive_size;
+}
+
 /******************************************************************************/
 /**
   * Loads the data of another GEvolutionaryAlgorithm object, camouflaged as a GObject.
@@ -359,6 +631,13 @@ void GEvolutionaryAlgorithm::load_(const GObject *cp) {
 	// ... and then our own data
 	m_sorting_mode = p_load->m_sorting_mode;
 	m_n_threads = p_load->m_n_threads;
+	m_use_steady_state = p_load->m_use_steady_state;
+	m_steady_state_batch_size = p_load->m_steady_state_batch_size;
+	m_cancel_hopeless_children = p_load->m_cancel_hopeless_children;
+	m_use_surrogate = p_load->m_use_surrogate;
+	m_surrogate_overgeneration = p_load->m_surrogate_overgeneration;
+	m_surrogate_refresh_interval = p_load->m_surrogate_refresh_interval;
+	m_surrogate_archive_size = p_load->m_surrogate_archive_size;
 }
 
 /******************************************************************************/
@@ -426,6 +705,15 @@ void GEvolutionaryAlgorithm::populationSanityChecks_() const {
 				<< error.str()
 		);
 	}
+
+	// The steady-state mode keeps the best individuals of parents and children
+	if (m_use_steady_state && m_sorting_mode != sortingMode::MUPLUSNU_SINGLEEVAL) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG,  time_and_place)
+				<< "In G_OA_EvolutionaryAlgorithm::populationSanityChecks(): Error!" << std::endl
+				<< "The steady-state mode requires MUPLUSNU_SINGLEEVAL sorting" << std::endl
+		);
+	}
 }
 
 /******************************************************************************/
@@ -433,6 +721,12 @@ void GEvolutionaryAlgorithm::populationSanityChecks_() const {
   * Adapt all children in parallel. Evaluation is done in a separate function (runFitnessCalculation).
   */
 void GEvolutionaryAlgorithm::adaptChildren_() {
+	// Candidates are pre-screened as soon as the surrogate model knows enough about the evaluation function
+	if (m_surrogate_ptr && m_surrogate_ptr->isReady()) {
+		this->surrogatePreScreening();
+		return;
+	}
+
 	// Retrieve the range of individuals to be adapted
 	std::tuple<std::size_t, std::size_t> range = this->getAdaptionRange();
 
@@ -476,11 +770,101 @@ void GEvolutionaryAlgorithm::adaptChildren_() {
 #endif
 }
 
+/******************************************************************************/
+/**
+ * Creates ceil(nChildren * m_surrogate_overgeneration) candidates from the
+ * recombined children, adapts all of them and keeps the nChildren candidates
+ * with the best fitness predicted by the surrogate model. Only these are
+ * subsequently submitted for evaluation. Predictions refer to the primary
+ * evaluation criterion. Candidates are compared through their active
+ * floating point parameters.
+ */
+void GEvolutionaryAlgorithm::surrogatePreScreening() {
+	std::size_t np = this->getNParents();
+	std::size_t nChildren = this->size() - np;
+	std::size_t nCandidates = static_cast<std::size_t>(std::ceil(double(nChildren) * m_surrogate_overgeneration));
+
+	// Surplus candidates start from the recombined children, so they follow the chosen recombination scheme
+	std::vector<std::shared_ptr<GParameterSet>> candidates(this->begin() + np, this->end());
+	for (std::size_t i = nChildren; i < nCandidates; i++) {
+		candidates.push_back(candidates.at(i % nChildren)->clone<GParameterSet>());
+	}
+
+	// Adapt all candidates in parallel
+	std::vector<std::future<std::size_t>> futures_cnt;
+	for (auto const& c_ptr: candidates) {
+		futures_cnt.push_back(m_tp_ptr->async_schedule([c_ptr]() { return c_ptr->adapt(); }));
+	}
+	m_tp_ptr->wait();
+
+	for(auto& f: futures_cnt) {
+		f.get(); // Re-throws exceptions raised during adaption
+	}
+
+	// Predict the fitness of each candidate
+	std::vector<std::pair<double, std::size_t>> predictions;
+	std::vector<double> position;
+	for (std::size_t i = 0; i < candidates.size(); i++) {
+		candidates[i]->streamline<double>(position, activityMode::ACTIVEONLY);
+		if (position.size() != m_surrogate_ptr->getNDimensions()) {
+			// The model cannot describe this individual. The original children
+			// have already been adapted and remain in place.
+			return;
+		}
+		predictions.push_back(std::make_pair(m_surrogate_ptr->predict(position), i));
+	}
+
+	// Keep the most promising candidates in the child positions
+	std::partial_sort(predictions.begin(), predictions.begin() + nChildren, predictions.end());
+	for (std::size_t i = 0; i < nChildren; i++) {
+		this->at(np + i) = candidates.at(predictions[i].second);
+	}
+
+	this->markIndividualPositions();
+}
+
+/******************************************************************************/
+/**
+ * Adds the individuals evaluated in this iteration to the surrogate model and
+ * refreshes the model every m_surrogate_refresh_interval iterations. Individuals
+ * with errors and unprocessed items are ignored.
+ */
+void GEvolutionaryAlgorithm::updateSurrogate() {
+	if (not m_surrogate_ptr) return;
+
+	std::vector<double> position;
+	for (auto it = this->begin() + (this->inFirstIteration() ? 0 : this->getNParents()); it != this->end(); ++it) {
+		if (not (*it)->is_processed() || (*it)->has_errors()) continue;
+
+		(*it)->streamline<double>(position, activityMode::ACTIVEONLY);
+		if (position.empty()) continue;
+
+		if (m_surrogate_ptr->getNDimensions() != 0 && position.size() != m_surrogate_ptr->getNDimensions()) {
+			// The structure of the individuals has changed -- start a new model
+			m_surrogate_ptr->clear();
+		}
+
+		m_surrogate_ptr->addSample(position, minOnly_transformed_fitness(*it));
+	}
+
+	if (this->inFirstIteration() || 0 == this->getIteration() % m_surrogate_refresh_interval) {
+		m_surrogate_ptr->update();
+	}
+}
+
 /******************************************************************************/
 /**
   * We submit individuals to the broker connector and wait for processed items.
  */
 void GEvolutionaryAlgorithm::runFitnessCalculation_() {
+	// In steady-state mode children are evaluated in batches. The first iteration
+	// evaluates the entire population, so that parents have a valid fitness.
+	if (m_use_steady_state && not this->inFirstIteration()) {
+		this->runSteadyStateFitnessCalculation();
+		this->updateSurrogate();
+		return;
+	}
+
 	//--------------------------------------------------------------------------------
 	// Start by marking the work to be done in the individuals.
 	// "range" will hold the start- and end-points of the range
@@ -517,6 +901,9 @@ void GEvolutionaryAlgorithm::runFitnessCalculation_() {
 
 	setProcessingFlag(this->m_data_cnt, range);
 
+	// Let children know when they are no longer competitive
+	this->setChildCancellationBounds(std::get<0>(range), std::get<1>(range));
+
 	//--------------------------------------------------------------------------------
 	// Now submit work items and wait for results.
 	auto status = this->workOn(
@@ -563,6 +950,76 @@ void GEvolutionaryAlgorithm::runFitnessCalculation_() {
 	//--------------------------------------------------------------------------------
 	// Now fix the population -- it may be smaller than its nominal size
 	fixAfterJobSubmission();
+
+	// Let the surrogate model learn from the new evaluations
+	this->updateSurrogate();
+}
+
+/******************************************************************************/
+/**
+ * Evaluates children in batches of m_steady_state_batch_size items. As soon as
+ * a batch has returned, the best individuals among parents and all children
+ * evaluated so far move into the parent positions. Children of later batches
+ * are bred anew from these updated parents, so that no child has to wait for
+ * the slowest evaluation of the entire generation. Items that do not return
+ * in time do not hold up the cycle: they are replaced by clones of the worst
+ * parent, and late arrivals are merged through the old work items in
+ * fixAfterJobSubmission().
+ */
+void GEvolutionaryAlgorithm::runSteadyStateFitnessCalculation() {
+	std::size_t np = this->getNParents();
+	std::size_t popSize = this->size();
+
+	auto bestFirst = [](std::shared_ptr<GParameterSet> x_ptr, std::shared_ptr<GParameterSet> y_ptr) -> bool {
+		return minOnly_transformed_fitness(x_ptr) < minOnly_transformed_fitness(y_ptr);
+	};
+
+	for (std::size_t first = np; first < popSize; first += m_steady_state_batch_size) {
+		std::size_t last = (std::min)(first + m_steady_state_batch_size, popSize);
+
+		// The first batch was bred by recombine() and adaptChildren_(). Later batches
+		// are bred from the parents as updated by the previous batches.
+		if (first > np) {
+			for (auto it = this->begin() + first; it != this->begin() + last; ++it) {
+				this->randomRecombine(*it);
+				(*it)->template getPersonalityTraits<GEvolutionaryAlgorithm_PersonalityTraits>()->setIsChild();
+				(*it)->adapt();
+			}
+		}
+
+		// Only the current batch is submitted. The executor counts the submissions itself,
+		// so that late arrivals from earlier batches are recognized as old work items.
+		setProcessingFlag(this->m_data_cnt, std::make_tuple(first, last));
+		this->setChildCancellationBounds(first, last);
+		this->workOn(
+			this->m_data_cnt
+			, false // do not resubmit unprocessed items
+			, "GEvolutionaryAlgorithm::runSteadyStateFitnessCalculation()"
+			, false // do not use the iteration counter of the algorithm
+		);
+
+		// Children that did not return or that had errors are replaced by the worst parent
+		for (auto it = this->begin() + first; it != this->begin() + last; ++it) {
+			if (not (*it)->is_processed() || (*it)->has_errors()) {
+				(*it)->GObject::load(*(this->begin() + (np - 1)));
+				(*it)->template getPersonalityTraits<GEvolutionaryAlgorithm_PersonalityTraits>()->setIsChild();
+			}
+		}
+
+		// Steady-state replacement: the best of parents and evaluated children become the new parents
+		std::partial_sort(this->begin(), this->begin() + np, this->begin() + last, bestFirst);
+	}
+
+	// Make the parent / child tags match the positions again, as fixAfterJobSubmission() sorts by them
+	for (auto it = this->begin(); it != this->begin() + np; ++it) {
+		(*it)->template getPersonalityTraits<GEvolutionaryAlgorithm_PersonalityTraits>()->setIsParent();
+	}
+	for (auto it = this->begin() + np; it != this->end(); ++it) {
+		(*it)->template getPersonalityTraits<GEvolutionaryAlgorithm_PersonalityTraits>()->setIsChild();
+	}
+
+	// Integrate late arrivals and repair the population, if necessary
+	fixAfterJobSubmission();
 }
 
 /******************************************************************************/
@@ -782,6 +1239,11 @@ void GEvolutionaryAlgorithm::init() {
 
 	// Initialize our thread pool
 	m_tp_ptr.reset(new Gem::Common::GThreadPool(m_n_threads));
+
+	// Initialize the surrogate model, if requested
+	if (m_use_surrogate) {
+		m_surrogate_ptr.reset(new Gem::Common::GRBFSurrogate(Gem::Common::DEFAULTRBFNNEIGHBORS, m_surrogate_archive_size));
+	}
 }
 
 /******************************************************************************/
@@ -792,6 +1254,9 @@ void GEvolutionaryAlgorithm::finalize() {
 	// Terminate our thread pool
 	m_tp_ptr.reset();
 
+	// Get rid of the surrogate model
+	m_surrogate_ptr.reset();
+
 	// Last action. Place any "local" finalization action before this call.
 	G_OptimizationAlgorithm_ParChild::finalize();
 }
@@ -963,87 +1428,14 @@ void GEvolutionaryAlgorithm::sortMunu1pretainMode() {
   * http://en.wikipedia.org/wiki/Pareto_efficiency for a discussion of this topic.
   */
 void GEvolutionaryAlgorithm::sortMuPlusNuParetoMode() {
-	typename GEvolutionaryAlgorithm::iterator it, it_cmp;
-
 	// We fall back to the single-eval MUPLUSNU mode if there is just one evaluation criterion
-	it = this->begin();
-	if (not (*it)->hasMultipleFitnessCriteria()) {
+	if (not this->front()->hasMultipleFitnessCriteria()) {
 		this->sortMuPlusNuMode();
 		return;
 	}
 
-	// Mark all individuals as being on the pareto front initially
-	for (it = this->begin(); it != this->end(); ++it) {
-		(*it)->template getPersonalityTraits<GEvolutionaryAlgorithm_PersonalityTraits>()->resetParetoTag();
-	}
-
-	// Compare all parameters
-	for (it = this->begin(); it != this->end(); ++it) {
-		for (it_cmp = it + 1; it_cmp != this->end(); ++it_cmp) {
-			// If we already know that this individual is *not*
-			// on the front we do not have to do any tests
-			if (not (*it_cmp)->template getPersonalityTraits<GEvolutionaryAlgorithm_PersonalityTraits>()->isOnParetoFront()) continue;
-
-			// Check if it dominates it_cmp. If so, mark it accordingly
-			if (aDominatesB(*it, *it_cmp)) {
-				(*it_cmp)->template getPersonalityTraits<GEvolutionaryAlgorithm_PersonalityTraits>()->setIsNotOnParetoFront();
-			}
-
-			// If a it dominated by it_cmp, we mark it accordingly and break the loop
-			if (aDominatesB(*it_cmp, *it)) {
-				(*it)->template getPersonalityTraits<GEvolutionaryAlgorithm_PersonalityTraits>()->setIsNotOnParetoFront();
-				break;
-			}
-		}
-	}
-
-	// At this point we have tagged all individuals according to whether or not they are
-	// on the pareto front. Lets sort them accordingly, bringing individuals with the
-	// pareto tag to the front of the collection.
-	sort(
-		this->begin()
-		, this->end()
-		, [](std::shared_ptr<GParameterSet> x, std::shared_ptr<GParameterSet> y) {
-			return x->getPersonalityTraits<GEvolutionaryAlgorithm_PersonalityTraits>()->isOnParetoFront() > y->getPersonalityTraits<GEvolutionaryAlgorithm_PersonalityTraits>()->isOnParetoFront();
-		}
-	);
-
-	// Count the number of individuals on the pareto front
-	std::size_t nIndividualsOnParetoFront = 0;
-	for (it = this->begin(); it != this->end(); ++it) {
-		if ((*it)->template getPersonalityTraits<GEvolutionaryAlgorithm_PersonalityTraits>()->isOnParetoFront()) nIndividualsOnParetoFront++;
-	}
-
-	// If the number of individuals on the pareto front exceeds the number of parents, we
-	// do not want to introduce a bias by selecting only the first nParent individuals. Hence
-	// we randomly shuffle them. Note that not all individuals on the pareto front might survive,
-	// as subsequent iterations will only take into account parents for the reproduction step.
-	// If fewer individuals are on the pareto front than there are parents, then we want the
-	// remaining parent positions to be filled up with the non-pareto-front individuals with
-	// the best minOnly_fitness(0), i.e. with the best "master" fitness (transformed to take into
-	// account minimization and maximization).
-	if (nIndividualsOnParetoFront > this->getNParents()) {
-		// randomly shuffle pareto-front individuals to avoid a bias
-		std::shuffle(this->begin(), this->begin() + nIndividualsOnParetoFront, this->m_gr);
-	} else if (nIndividualsOnParetoFront < this->getNParents()) {
-		// Sort the non-pareto-front individuals according to their master fitness
-		std::partial_sort(
-			this->begin() + nIndividualsOnParetoFront, this->begin() + this->m_n_parents, this->end(),
-			[](std::shared_ptr <GParameterSet> x_ptr, std::shared_ptr <GParameterSet> y_ptr) -> bool {
-				return minOnly_transformed_fitness(x_ptr) < minOnly_transformed_fitness(y_ptr);
-			}
-		);
-	}
-
-	// Finally, we sort the parents only according to their master fitness. This is meant
-	// to give some sense to the value recombination scheme. It won't change much in case of the
-	// random recombination scheme.
-	std::sort(
-		this->begin(), this->begin() + this->m_n_parents,
-		[](std::shared_ptr <GParameterSet> x_ptr, std::shared_ptr <GParameterSet> y_ptr) -> bool {
-			return minOnly_transformed_fitness(x_ptr) < minOnly_transformed_fitness(y_ptr);
-		}
-	);
+	// Parents and children compete for the pareto front
+	this->sortParetoFronts(0);
 }
 
 /******************************************************************************/
@@ -1053,86 +1445,88 @@ void GEvolutionaryAlgorithm::sortMuPlusNuParetoMode() {
   * http://en.wikipedia.org/wiki/Pareto_efficiency for a discussion of this topic.
   */
 void GEvolutionaryAlgorithm::sortMuCommaNuParetoMode() {
-	typename GEvolutionaryAlgorithm::iterator it, it_cmp;
-
 	// We fall back to the single-eval MUCOMMANU mode if there is just one evaluation criterion
-	it = this->begin();
-	if (not (*it)->hasMultipleFitnessCriteria()) {
+	if (not this->front()->hasMultipleFitnessCriteria()) {
 		this->sortMuCommaNuMode();
 		return;
 	}
 
-	// Mark the last iterations parents as not being on the pareto front
-	for (it = this->begin(); it != this->begin() + this->m_n_parents; ++it) {
-		(*it)->template getPersonalityTraits<GEvolutionaryAlgorithm_PersonalityTraits>()->setIsNotOnParetoFront();
-	}
+	// Only the children compete for the pareto front. The last iteration's parents
+	// are moved behind all children.
+	this->sortParetoFronts(this->m_n_parents);
+}
 
-	// Mark all children as being on the pareto front initially
-	for (it = this->begin() + this->m_n_parents; it != this->end(); ++it) {
-		(*it)->template getPersonalityTraits<GEvolutionaryAlgorithm_PersonalityTraits>()->resetParetoTag();
+/******************************************************************************/
+/**
+ * Sorts the population according to pareto fronts. Individuals before position
+ * firstCandidate (i.e. the last iteration's parents in MUCOMMANU mode) are tagged
+ * as not being on the pareto front and are moved behind all other individuals.
+ * The fitness vectors and personality traits are extracted once per individual,
+ * so the O(M*N^2) dominance comparisons only deal with plain vectors of doubles.
+ *
+ * If the number of individuals on the pareto front exceeds the number of parents, we
+ * do not want to introduce a bias by selecting only the first nParent individuals. Hence
+ * we randomly shuffle them. If fewer individuals are on the pareto front than there are
+ * parents, then the remaining parent positions are filled up from the subsequent fronts,
+ * and inside of each front with the individuals with the best "master" fitness
+ * (transformed to take into account minimization and maximization).
+ *
+ * @param firstCandidate The position of the first individual eligible for the pareto front
+ */
+void GEvolutionaryAlgorithm::sortParetoFronts(std::size_t firstCandidate) {
+	std::size_t nCriteria = this->front()->getNStoredResults();
+
+	// Cache the minimization-only fitness vectors of all eligible individuals
+	std::vector<std::vector<double>> fitness_cnt(this->size() - firstCandidate, std::vector<double>(nCriteria));
+	for (std::size_t i = firstCandidate; i < this->size(); i++) {
+		for (std::size_t c = 0; c < nCriteria; c++) {
+			fitness_cnt[i - firstCandidate][c] = minOnly_transformed_fitness(this->at(i), c);
+		}
 	}
 
-	// Compare all parameters of all children
-	for (it = this->begin() + this->m_n_parents; it != this->end(); ++it) {
-		for (it_cmp = it + 1; it_cmp != this->end(); ++it_cmp) {
-			// If we already know that this individual is *not*
-			// on the front we do not have to do any tests
-			if (not (*it_cmp)->template getPersonalityTraits<GEvolutionaryAlgorithm_PersonalityTraits>()->isOnParetoFront()) continue;
-
-			// Check if it dominates it_cmp. If so, mark it accordingly
-			if (aDominatesB(*it, *it_cmp)) {
-				(*it_cmp)->template getPersonalityTraits<GEvolutionaryAlgorithm_PersonalityTraits>()->setIsNotOnParetoFront();
-			}
+	std::vector<std::size_t> fronts = GEvolutionaryAlgorithm::fastNonDominatedSort(fitness_cnt);
 
-			// If a it dominated by it_cmp, we mark it accordingly and break the loop
-			if (aDominatesB(*it_cmp, *it)) {
-				(*it)->template getPersonalityTraits<GEvolutionaryAlgorithm_PersonalityTraits>()->setIsNotOnParetoFront();
-				break;
-			}
+	// Tag the individuals according to whether they are on the pareto front and
+	// attach the front and master fitness to each of them
+	std::size_t nIndividualsOnParetoFront = 0;
+	std::vector<std::tuple<std::size_t, double, std::shared_ptr<GParameterSet>>> ranked_cnt;
+	ranked_cnt.reserve(this->size());
+	for (std::size_t i = 0; i < this->size(); i++) {
+		std::shared_ptr<GParameterSet> ind_ptr = this->at(i);
+		std::shared_ptr<GEvolutionaryAlgorithm_PersonalityTraits> pt_ptr
+			= ind_ptr->template getPersonalityTraits<GEvolutionaryAlgorithm_PersonalityTraits>();
+
+		std::size_t front = (i < firstCandidate) ? std::numeric_limits<std::size_t>::max() : fronts[i - firstCandidate];
+		if (0 == front) {
+			pt_ptr->resetParetoTag();
+			nIndividualsOnParetoFront++;
+		} else {
+			pt_ptr->setIsNotOnParetoFront();
 		}
+
+		ranked_cnt.emplace_back(front, minOnly_transformed_fitness(ind_ptr), ind_ptr);
 	}
 
-	// At this point we have tagged all children according to whether or not they are
-	// on the pareto front. Lets sort them accordingly, bringing individuals with the
-	// pareto tag to the front of the population. Note that parents have been manually
-	// tagged as not being on the pareto front in the beginning of this function, so
-	// sorting the individuals according to the pareto tag will move former parents out
-	// of the parents section.
-	sort(
-		this->begin()
-		, this->end()
-		, [](std::shared_ptr<GParameterSet> x, std::shared_ptr<GParameterSet> y) {
-			return x->getPersonalityTraits<GEvolutionaryAlgorithm_PersonalityTraits>()->isOnParetoFront() > y->getPersonalityTraits<GEvolutionaryAlgorithm_PersonalityTraits>()->isOnParetoFront();
+	// Bring the pareto front to the beginning of the population, followed by the later fronts
+	std::sort(
+		ranked_cnt.begin()
+		, ranked_cnt.end()
+		, [](
+			std::tuple<std::size_t, double, std::shared_ptr<GParameterSet>> const& x
+			, std::tuple<std::size_t, double, std::shared_ptr<GParameterSet>> const& y
+		) -> bool {
+			if (std::get<0>(x) != std::get<0>(y)) return std::get<0>(x) < std::get<0>(y);
+			return std::get<1>(x) < std::get<1>(y);
 		}
 	);
 
-	// Count the number of individuals on the pareto front
-	std::size_t nIndividualsOnParetoFront = 0;
-	for (it = this->begin(); it != this->end(); ++it) {
-		if ((*it)->template getPersonalityTraits<GEvolutionaryAlgorithm_PersonalityTraits>()->isOnParetoFront()) nIndividualsOnParetoFront++;
-	}
-
-	// If the number of individuals on the pareto front exceeds the number of parents, we
-	// do not want to introduce a bias by selecting only the first nParent individuals. Hence
-	// we randomly shuffle them. Note that not all individuals on the pareto front might survive,
-	// as subsequent iterations will only take into account parents for the reproduction step.
-	// If fewer individuals are on the pareto front than there are parents, then we want the
-	// remaining parent positions to be filled up with the non-pareto-front individuals with
-	// the best minOnly_fitness(0), i.e. with the best "master" fitness, transformed to take into account
-	// minimization and maximization. Note that, unlike MUCOMMANU_SINGLEEVAL
-	// this implies the possibility that former parents are "elected" as new parents again. This
-	// might be changed in subsequent versions of Geneva (TODO).
+	for (std::size_t i = 0; i < ranked_cnt.size(); i++) {
+		G_OptimizationAlgorithm_Base::m_data_cnt[i] = std::get<2>(ranked_cnt[i]);
+	}
+
 	if (nIndividualsOnParetoFront > this->getNParents()) {
 		// randomly shuffle pareto-front individuals to avoid a bias
 		std::shuffle(this->begin(), this->begin() + nIndividualsOnParetoFront, this->m_gr);
-	} else if (nIndividualsOnParetoFront < this->getNParents()) {
-		// Sort the non-pareto-front individuals according to their master fitness
-		std::partial_sort(
-			this->begin() + nIndividualsOnParetoFront, this->begin() + this->m_n_parents, this->end(),
-			[](std::shared_ptr <GParameterSet> x_ptr, std::shared_ptr <GParameterSet> y_ptr) -> bool {
-				return minOnly_transformed_fitness(x_ptr) < minOnly_transformed_fitness(y_ptr);
-			}
-		);
 	}
 
 	// Finally, we sort the parents only according to their master fitness. This is meant
@@ -1171,13 +1565,91 @@ bool GEvolutionaryAlgorithm::aDominatesB(
 	}
 #endif
 
-	// x dominates y, if none of its fitness criteria is worse than the
-	// corresponding criterion from y
+	std::vector<double> x_fitness(nCriteriaX), y_fitness(nCriteriaX);
 	for (std::size_t i = 0; i < nCriteriaX; i++) {
-		if(isWorse(x_ptr, y_ptr)) return false;
+		x_fitness[i] = minOnly_transformed_fitness(x_ptr, i);
+		y_fitness[i] = minOnly_transformed_fitness(y_ptr, i);
+	}
+
+	return GEvolutionaryAlgorithm::aDominatesB(x_fitness, y_fitness);
+}
+
+/******************************************************************************/
+/**
+  * Determines whether the first fitness vector dominates the second. Both vectors
+  * are expected to hold minimization-only (i.e. transformed) fitness values.
+  * x dominates y, if none of its fitness criteria is worse than the corresponding
+  * criterion from y and at least one of them is better.
+  *
+  * @param x The fitness vector that is assumed to dominate
+  * @param y The fitness vector that is assumed to be dominated
+  * @return A boolean indicating whether the first fitness vector dominates the second
+  */
+bool GEvolutionaryAlgorithm::aDominatesB(
+	std::vector<double> const& x
+	, std::vector<double> const& y
+) {
+	bool betterInOneCriterion = false;
+	for (std::size_t i = 0; i < x.size(); i++) {
+		if (x[i] > y[i]) return false;
+		if (x[i] < y[i]) betterInOneCriterion = true;
+	}
+
+	return betterInOneCriterion;
+}
+
+/******************************************************************************/
+/**
+  * Assigns a pareto front to each of the (minimization-only) fitness vectors,
+  * following the fast non-dominated sorting scheme by Deb et al. (NSGA-II).
+  * Front 0 holds all non-dominated vectors, front 1 the vectors that are only
+  * dominated by members of front 0, and so on. Each pair of vectors is only
+  * compared once.
+  *
+  * @param fitness_cnt The fitness vectors of all individuals taking part in the sorting
+  * @return The front of each fitness vector, in the same order as fitness_cnt
+  */
+std::vector<std::size_t> GEvolutionaryAlgorithm::fastNonDominatedSort(
+	std::vector<std::vector<double>> const& fitness_cnt
+) {
+	std::size_t nItems = fitness_cnt.size();
+
+	std::vector<std::size_t> dominationCount(nItems, 0); // By how many vectors a given vector is dominated
+	std::vector<std::vector<std::size_t>> dominatedItems(nItems); // The vectors dominated by a given vector
+
+	for (std::size_t p = 0; p < nItems; p++) {
+		for (std::size_t q = p + 1; q < nItems; q++) {
+			if (aDominatesB(fitness_cnt[p], fitness_cnt[q])) {
+				dominatedItems[p].push_back(q);
+				dominationCount[q]++;
+			} else if (aDominatesB(fitness_cnt[q], fitness_cnt[p])) {
+				dominatedItems[q].push_back(p);
+				dominationCount[p]++;
+			}
+		}
+	}
+
+	std::vector<std::size_t> fronts(nItems, 0);
+	std::vector<std::size_t> currentFront, nextFront;
+	for (std::size_t p = 0; p < nItems; p++) {
+		if (0 == dominationCount[p]) currentFront.push_back(p);
 	}
 
-	return true;
+	std::size_t frontCounter = 0;
+	while (not currentFront.empty()) {
+		nextFront.clear();
+		for (auto p: currentFront) {
+			fronts[p] = frontCounter;
+			for (auto q: dominatedItems[p]) {
+				if (0 == --dominationCount[q]) nextFront.push_back(q);
+			}
+		}
+
+		currentFront.swap(nextFront);
+		frontCounter++;
+	}
+
+	return fronts;
 }
 
 /******************************************************************************/
@@ -1288,6 +1760,304 @@ void GEvolutionaryAlgorithm::specificTestsNoFailureExpected_GUnitTests_() {
 
 	//------------------------------------------------------------------------------
 
+	{ // Check the asynchronous steady-state mode
+		std::shared_ptr<GEvolutionaryAlgorithm> p_test = this->template clone<GEvolutionaryAlgorithm>();
+		boost::filesystem::path executorConfig("./GEvolutionaryAlgorithm_steadyStateTest_executor.json");
+
+		p_test->fillWithObjects(20);
+		BOOST_CHECK_NO_THROW(p_test->setPopulationSizes(20, 4));
+		p_test->setSortingScheme(sortingMode::MUPLUSNU_SINGLEEVAL);
+		p_test->setUseSteadyState(true);
+		BOOST_CHECK_NO_THROW(p_test->setSteadyStateBatchSize(3));
+		BOOST_CHECK(p_test->getUseSteadyState());
+		BOOST_CHECK(p_test->getSteadyStateBatchSize() == 3);
+		p_test->setMaxIteration(10);
+		p_test->registerExecutor(
+			std::shared_ptr<Gem::Courtier::GBaseExecutorT<GParameterSet>>(new Gem::Courtier::GSerialExecutorT<GParameterSet>())
+			, executorConfig
+		);
+
+		BOOST_CHECK_NO_THROW(p_test->optimize());
+
+		// All individuals must be processed, and the first parent must be the best individual
+		BOOST_CHECK(p_test->size() == 20);
+		for (std::size_t i = 0; i < p_test->size(); i++) {
+			BOOST_CHECK(p_test->at(i)->is_processed());
+			BOOST_CHECK(minOnly_transformed_fitness(p_test->at(0)) <= minOnly_transformed_fitness(p_test->at(i)));
+		}
+
+		boost::filesystem::remove(executorConfig);
+	}
+
+	//------------------------------------------------------------------------------
+
+	{ // Check surrogate pre-screening of children
+		std::shared_ptr<GEvolutionaryAlgorithm> p_test = this->template clone<GEvolutionaryAlgorithm>();
+		boost::filesystem::path executorConfig("./GEvolutionaryAlgorithm_surrogateTest_executor.json");
+
+		p_test->fillWithObjects(20);
+		BOOST_CHECK_NO_THROW(p_test->setPopulationSizes(20, 4));
+		p_test->setUseSurrogate(true);
+		BOOST_CHECK_NO_THROW(p_test->setSurrogateOvergeneration(2.5));
+		BOOST_CHECK_NO_THROW(p_test->setSurrogateRefreshInterval(2));
+		BOOST_CHECK_NO_THROW(p_test->setSurrogateArchiveSize(100));
+		BOOST_CHECK(p_test->getUseSurrogate());
+		BOOST_CHECK(p_test->getSurrogateOvergeneration() == 2.5);
+		BOOST_CHECK(p_test->getSurrogateRefreshInterval() == 2);
+		BOOST_CHECK(p_test->getSurrogateArchiveSize() == 100);
+		p_test->setMaxIteration(10);
+		p_test->registerExecutor(
+			std::shared_ptr<Gem::Courtier::GBaseExecutorT<GParameterSet>>(new Gem::Courtier::GSerialExecutorT<GParameterSet>())
+			, executorConfig
+		);
+
+		BOOST_CHECK_NO_THROW(p_test->optimize());
+
+		// The population must have its nominal size, and all individuals must be processed
+		BOOST_CHECK(p_test->size() == 20);
+		for (std::size_t i = 0; i < p_test->size(); i++) {
+			BOOST_CHECK(p_test->at(i)->is_processed());
+		}
+
+		boost::filesystem::remove(executorConfig);
+	}
+
+	//------------------------------------------------------------------------------
+
+	{ // Check the exchange of individuals between populations
+		std::shared_ptr<GEvolutionaryAlgorithm> p_test = this->template clone<GEvolutionaryAlgorithm>();
+		boost::filesystem::path executorConfig("./GEvolutionaryAlgorithm_migrationTest_executor.json");
+
+		p_test->fillWithObjects(20);
+		BOOST_CHECK_NO_THROW(p_test->setPopulationSizes(20, 4));
+		p_test->setMaxIteration(5);
+		p_test->registerExecutor(
+			std::shared_ptr<Gem::Courtier::GBaseExecutorT<GParameterSet>>(new Gem::Courtier::GSerialExecutorT<GParameterSet>())
+			, executorConfig
+		);
+
+		// The migration hook is called once in each iteration
+		std::size_t nHookCalls = 0;
+		BOOST_CHECK(not p_test->hasMigrationHook());
+		BOOST_CHECK_NO_THROW(p_test->registerMigrationHook([&nHookCalls](G_OptimizationAlgorithm_Base &) { nHookCalls++; }));
+		BOOST_CHECK(p_test->hasMigrationHook());
+		BOOST_CHECK_NO_THROW(p_test->optimize());
+		BOOST_CHECK(nHookCalls == p_test->getIteration()); // The counter was incremented after each iteration, starting at 0
+		p_test->resetMigrationHook();
+		BOOST_CHECK(not p_test->hasMigrationHook());
+
+		// Emigrants are sorted copies of the best individuals
+		std::vector<std::shared_ptr<GParameterSet>> emigrants = p_test->getEmigrants(3);
+		BOOST_CHECK(emigrants.size() == 3);
+		BOOST_CHECK(emigrants.at(0) != p_test->at(0));
+		for (std::size_t i = 0; i < p_test->size(); i++) {
+			BOOST_CHECK(minOnly_transformed_fitness(emigrants.at(0)) <= minOnly_transformed_fitness(p_test->at(i)));
+		}
+		BOOST_CHECK(minOnly_transformed_fitness(emigrants.at(0)) <= minOnly_transformed_fitness(emigrants.at(1)));
+		BOOST_CHECK(minOnly_transformed_fitness(emigrants.at(1)) <= minOnly_transformed_fitness(emigrants.at(2)));
+		BOOST_CHECK(p_test->getEmigrants(100).size() == p_test->size());
+
+		// Unprocessed immigrants are ignored
+		std::shared_ptr<GParameterSet> unprocessed_ptr = emigrants.at(0)->clone<GParameterSet>();
+		unprocessed_ptr->mark_as_due_for_processing();
+		BOOST_CHECK(p_test->integrateImmigrants(std::vector<std::shared_ptr<GParameterSet>>(1, unprocessed_ptr)) == 0);
+
+		// Better immigrants replace the worst parent, children are left alone
+		double worstParentFitness = minOnly_transformed_fitness(p_test->at(0));
+		for (std::size_t i = 1; i < p_test->getNParents(); i++) {
+			worstParentFitness = (std::max)(worstParentFitness, minOnly_transformed_fitness(p_test->at(i)));
+		}
+		std::shared_ptr<GParameterSet> firstChild_ptr = p_test->at(p_test->getNParents());
+		std::size_t nAccepted = p_test->integrateImmigrants(std::vector<std::shared_ptr<GParameterSet>>(1, emigrants.at(0)));
+		BOOST_CHECK(nAccepted == ((minOnly_transformed_fitness(emigrants.at(0)) < worstParentFitness) ? 1 : 0));
+		BOOST_CHECK(p_test->at(p_test->getNParents()) == firstChild_ptr);
+
+		boost::filesystem::remove(executorConfig);
+	}
+
+	//------------------------------------------------------------------------------
+
+	{ // Check ordering and duplicate rejection of the bounded best-individual queue
+		std::shared_ptr<GEvolutionaryAlgorithm> p_test = this->template clone<GEvolutionaryAlgorithm>();
+		boost::filesystem::path executorConfig("./GEvolutionaryAlgorithm_queueTest_executor.json");
+
+		p_test->fillWithObjects(20);
+		BOOST_CHECK_NO_THROW(p_test->setPopulationSizes(20, 4));
+		p_test->setMaxIteration(3);
+		p_test->registerExecutor(
+			std::shared_ptr<Gem::Courtier::GBaseExecutorT<GParameterSet>>(new Gem::Courtier::GSerialExecutorT<GParameterSet>())
+			, executorConfig
+		);
+		BOOST_CHECK_NO_THROW(p_test->optimize());
+
+		// The fitness of each distinct evaluation in the population, best first
+		std::vector<std::shared_ptr<GParameterSet>> population(p_test->begin(), p_test->end());
+		std::map<std::string, double> fitness_map;
+		for (auto const & ind_ptr: population) {
+			fitness_map[ind_ptr->getCurrentEvaluationID()] = minOnly_transformed_fitness(ind_ptr);
+		}
+		std::vector<double> fitness_cnt;
+		for (auto const & f: fitness_map) fitness_cnt.push_back(f.second);
+		std::sort(fitness_cnt.begin(), fitness_cnt.end());
+
+		const std::size_t MAXQUEUESIZE = 5;
+		BOOST_REQUIRE(fitness_cnt.size() > MAXQUEUESIZE);
+
+		GParameterSetFixedSizePriorityQueue queue(MAXQUEUESIZE);
+		BOOST_CHECK_NO_THROW(queue.add(population, true /* clone */, false /* replace */));
+
+		// Only the best items are kept, sorted best first
+		BOOST_CHECK(queue.size() == MAXQUEUESIZE);
+		std::vector<std::shared_ptr<GParameterSet>> queued = queue.toVector();
+		for (std::size_t i = 0; i < queued.size(); i++) {
+			BOOST_CHECK(minOnly_transformed_fitness(queued.at(i)) == fitness_cnt.at(i));
+		}
+		BOOST_CHECK(minOnly_transformed_fitness(queue.best()) == fitness_cnt.front());
+		BOOST_CHECK(minOnly_transformed_fitness(queue.worst()) == fitness_cnt.at(MAXQUEUESIZE - 1));
+
+		// Adding the same items again does not create duplicates
+		BOOST_CHECK_NO_THROW(queue.add(population, true /* clone */, false /* replace */));
+		BOOST_CHECK_NO_THROW(queue.add(queued.front()->clone<GParameterSet>(), true));
+		BOOST_CHECK(queue.size() == MAXQUEUESIZE);
+		std::unordered_set<std::string> id_set;
+		for (auto const & item_ptr: queue.toVector()) {
+			BOOST_CHECK(id_set.insert(item_ptr->getCurrentEvaluationID()).second);
+		}
+
+		// Items that are not accepted are not stored
+		std::shared_ptr<GParameterSet> worst_ptr;
+		for (auto const & ind_ptr: population) {
+			if (minOnly_transformed_fitness(ind_ptr) == fitness_cnt.back()) worst_ptr = ind_ptr;
+		}
+		BOOST_CHECK_NO_THROW(queue.add(worst_ptr, false));
+		for (auto const & item_ptr: queue.toVector()) {
+			BOOST_CHECK(item_ptr != worst_ptr);
+		}
+
+		// Copies and popped items retain the ordering
+		GParameterSetFixedSizePriorityQueue queue_copy(queue);
+		BOOST_CHECK(queue_copy.size() == MAXQUEUESIZE);
+		for (std::size_t i = 0; i < MAXQUEUESIZE; i++) {
+			BOOST_CHECK(minOnly_transformed_fitness(queue_copy.pop()) == fitness_cnt.at(i));
+		}
+		BOOST_CHECK(queue_copy.empty());
+
+		// An unlimited queue keeps each distinct evaluation exactly once
+		GParameterSetFixedSizePriorityQueue unlimited_queue(0);
+		BOOST_CHECK_NO_THROW(unlimited_queue.add(population, false /* clone */, false /* replace */));
+		BOOST_CHECK_NO_THROW(unlimited_queue.add(population, false /* clone */, false /* replace */));
+		BOOST_CHECK(unlimited_queue.size() == fitness_cnt.size());
+
+		boost::filesystem::remove(executorConfig);
+	}
+
+	//------------------------------------------------------------------------------
+
+	{ // Check that asynchronous and delta checkpoints can be restored
+		std::shared_ptr<GEvolutionaryAlgorithm> p_test = this->template clone<GEvolutionaryAlgorithm>();
+		boost::filesystem::path executorConfig("./GEvolutionaryAlgorithm_checkpointTest_executor.json");
+		boost::filesystem::path cpDirectory("./GEvolutionaryAlgorithm_checkpointTest");
+
+		p_test->fillWithObjects(20);
+		BOOST_CHECK_NO_THROW(p_test->setPopulationSizes(20, 4));
+		p_test->setMaxIteration(7);
+		BOOST_CHECK_NO_THROW(p_test->setCheckpointBaseName(cpDirectory.string(), "cpTest"));
+		p_test->setCheckpointInterval(1);
+		p_test->setRemoveCheckpointFiles(false);
+		p_test->setCheckpointSerializationMode(Gem::Common::serializationMode::BINARY);
+		p_test->setCheckpointAsync(true);
+		p_test->setCheckpointFullInterval(3);
+		p_test->registerExecutor(
+			std::shared_ptr<Gem::Courtier::GBaseExecutorT<GParameterSet>>(new Gem::Courtier::GSerialExecutorT<GParameterSet>())
+			, executorConfig
+		);
+		BOOST_CHECK_NO_THROW(p_test->optimize());
+
+		// All files have been written when optimize() returns
+		std::vector<boost::filesystem::path> cp_files;
+		for (auto const & entry: boost::filesystem::directory_iterator(cpDirectory)) {
+			BOOST_CHECK(entry.path().extension() != ".tmp");
+			cp_files.push_back(entry.path());
+		}
+		BOOST_CHECK(cp_files.size() > 3);
+
+		// Each checkpoint, complete or not, restores the entire population
+		for (auto const & cp_file: cp_files) {
+			std::shared_ptr<GEvolutionaryAlgorithm> p_load = this->template clone<GEvolutionaryAlgorithm>();
+			BOOST_CHECK_NO_THROW(p_load->loadCheckpoint(cp_file));
+			BOOST_CHECK(p_load->size() == p_test->size());
+			for (auto const & ind_ptr: *p_load) {
+				BOOST_CHECK(ind_ptr);
+			}
+
+			// The last checkpoint holds the population found at the end of the optimization
+			std::string last_prefix =
+				"checkpoint-" + p_test->getAlgorithmPersonalityType() + "-"
+				+ Gem::Common::to_string(p_test->getIteration() - 1) + "-";
+			if (0 == cp_file.filename().string().find(last_prefix)) {
+				for (std::size_t i = 0; i < p_test->size(); i++) {
+					BOOST_CHECK(
+						p_load->at(i)->getCurrentEvaluationID() == p_test->at(i)->getCurrentEvaluationID()
+					);
+				}
+			}
+		}
+
+		boost::filesystem::remove_all(cpDirectory);
+		boost::filesystem::remove(executorConfig);
+	}
+
+	//------------------------------------------------------------------------------
+
+	{ // Check that fast non-dominated sorting finds the same pareto front as a pairwise tagging of all individuals
+		std::uniform_real_distribution<double> uniform_real_distribution(0., 10.);
+
+		for (std::size_t nCriteria = 2; nCriteria <= 4; nCriteria++) {
+			for (std::size_t trial = 0; trial < 10; trial++) {
+				// Coarse values, so that ties and duplicates occur
+				std::vector<std::vector<double>> fitness_cnt(100, std::vector<double>(nCriteria));
+				for (auto &f: fitness_cnt) {
+					for (auto &v: f) v = std::floor(uniform_real_distribution(this->m_gr));
+				}
+
+				std::vector<std::size_t> fronts = GEvolutionaryAlgorithm::fastNonDominatedSort(fitness_cnt);
+
+				// Pairwise tagging, as previously done in sortMuPlusNuParetoMode()
+				std::vector<bool> onFront(fitness_cnt.size(), true);
+				for (std::size_t i = 0; i < fitness_cnt.size(); i++) {
+					for (std::size_t j = i + 1; j < fitness_cnt.size(); j++) {
+						if (not onFront[j]) continue;
+						if (aDominatesB(fitness_cnt[i], fitness_cnt[j])) onFront[j] = false;
+						if (aDominatesB(fitness_cnt[j], fitness_cnt[i])) {
+							onFront[i] = false;
+							break;
+						}
+					}
+				}
+
+				for (std::size_t i = 0; i < fitness_cnt.size(); i++) {
+					BOOST_CHECK_MESSAGE(
+						onFront[i] == (0 == fronts[i])
+						, "Pareto front mismatch at position " << i << ": " << onFront[i] << " / " << fronts[i]
+					);
+
+					for (std::size_t j = 0; j < fitness_cnt.size(); j++) {
+						// Members of the same front must not dominate each other
+						if (fronts[i] == fronts[j]) {
+							BOOST_CHECK(not aDominatesB(fitness_cnt[i], fitness_cnt[j]));
+						}
+						// A dominating vector always sits in an earlier front
+						if (aDominatesB(fitness_cnt[i], fitness_cnt[j])) {
+							BOOST_CHECK(fronts[i] < fronts[j]);
+						}
+					}
+				}
+			}
+		}
+	}
+
+	//------------------------------------------------------------------------------
+
 #else /* GEM_TESTING */ // If this function is called when GEM_TESTING isn't set, throw
 	Gem::Common::condnotset("GEvolutionaryAlgorithm::specificTestsNoFailureExpected_GUnitTests", "GEM_TESTING");
 #endif /* GEM_TESTING */
@@ -1302,6 +2072,17 @@ void GEvolutionaryAlgorithm::specificTestsFailuresExpected_GUnitTests_() {
 	// Call the parent class'es function
 	G_OptimizationAlgorithm_ParChild::specificTestsFailuresExpected_GUnitTests_();
 
+	//------------------------------------------------------------------------------
+
+	{ // Invalid surrogate settings are rejected
+		std::shared_ptr<GEvolutionaryAlgorithm> p_test = this->template clone<GEvolutionaryAlgorithm>();
+		BOOST_CHECK_THROW(p_test->setSurrogateOvergeneration(0.5), gemfony_exception);
+		BOOST_CHECK_THROW(p_test->setSurrogateRefreshInterval(0), gemfony_exception);
+		BOOST_CHECK_THROW(p_test->setSurrogateArchiveSize(1), gemfony_exception);
+	}
+
+	//------------------------------------------------------------------------------
+
 #else /* GEM_TESTING */
 	Gem::Common::condnotset("GEvolutionaryAlgorithm::specificTestsFailuresExpected_GUnitTests", "GEM_TESTING");
 #endif /* GEM_TESTING */
@@ -157,6 +157,56 @@ double GGradientDescent::getStepSize() const {
 	return stepSize_;
 }
 
+/******************************************************************************/
+/**
+ * Specifies how the gradient is estimated. Forward differences need one evaluation
+ * per parameter, central differences two, and SPSA two evaluations per starting
+ * point, independent of the number of parameters.
+ *
+ * @param ge The desired method for the estimation of the gradient
+ */
+void GGradientDescent::setGradientEstimator(gradientEstimator ge) {
+	if (ge > gradientEstimator::GRADIENTESTIMATOR_LAST) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG,  time_and_place)
+				<< "In GGradientDescent::setGradientEstimator(gradientEstimator): Error!" << std::endl
+				<< "Invalid gradient estimator " << ge << std::endl
+		);
+	}
+
+	gradientEstimator_ = ge;
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the method used for the estimation of the gradient
+ *
+ * @return The method used for the estimation of the gradient
+ */
+gradientEstimator GGradientDescent::getGradientEstimator() const {
+	return gradientEstimator_;
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the number of evaluations needed for the gradient of each starting point
+ *
+ * @return The number of "child" individuals belonging to each starting point
+ */
+std::size_t GGradientDescent::getNChildrenPerStartingPoint() const {
+	switch (gradientEstimator_) {
+		case gradientEstimator::GD_CENTRALDIFFERENCE:
+			return 2 * nFPParmsFirst_;
+
+		case gradientEstimator::GD_SPSA:
+			return 2;
+
+		case gradientEstimator::GD_FORWARDDIFFERENCE:
+		default:
+			return nFPParmsFirst_;
+	}
+}
+
 /******************************************************************************/
 /**
  * Retrieve the number of processable items in the current iteration.
@@ -215,6 +265,8 @@ void GGradientDescent::compare_(
 	compare_t(IDENTITY(nFPParmsFirst_, p_load->nFPParmsFirst_), token);
 	compare_t(IDENTITY(finiteStep_, p_load->finiteStep_), token);
 	compare_t(IDENTITY(stepSize_, p_load->stepSize_), token);
+	compare_t(IDENTITY(gradientEstimator_, p_load->gradientEstimator_), token);
+	compare_t(IDENTITY(spsaPerturbations_, p_load->spsaPerturbations_), token);
 	compare_t(IDENTITY(stepRatio_, p_load->stepRatio_), token);
 	compare_t(IDENTITY(dblLowerParameterBoundaries_, p_load->dblLowerParameterBoundaries_), token);
 	compare_t(IDENTITY(dblUpperParameterBoundaries_, p_load->dblUpperParameterBoundaries_), token);
@@ -234,6 +286,7 @@ void GGradientDescent::resetToOptimizationStart_() {
 	dblLowerParameterBoundaries_.clear(); // Holds lower boundaries of double parameters; Will be extracted in init()
 	dblUpperParameterBoundaries_.clear(); // Holds upper boundaries of double parameters; Will be extracted in init()
 	adjustedFiniteStep_.clear(); // A step-size normalized to each parameter range; Will be recalculated in init()
+	spsaPerturbations_.clear(); // The random directions of the SPSA perturbation; Will be drawn in updateChildParameters()
 
 	// There is no more work to be done here, so we simply call the
 	// function of the parent class
@@ -267,6 +320,8 @@ void GGradientDescent::load_(const GObject *cp) {
 	nFPParmsFirst_ = p_load->nFPParmsFirst_;
 	finiteStep_ = p_load->finiteStep_;
 	stepSize_ = p_load->stepSize_;
+	gradientEstimator_ = p_load->gradientEstimator_;
+	spsaPerturbations_ = p_load->spsaPerturbations_;
 	// stepRatio_ = p_load->stepRatio_; // temporary parameter
 	// m_dbl_lower_parameter_boundaries_cnt = p_load->m_dbl_lower_parameter_boundaries_cnt; // temporary parameter
 	// m_dbl_upper_parameter_boundaries_cnt = p_load->m_dbl_upper_parameter_boundaries_cnt; // temporary parameter
@@ -324,47 +379,88 @@ std::tuple<double, double> GGradientDescent::cycleLogic_() {
 
 /******************************************************************************/
 /**
- * Updates the individual parameters of children
+ * Updates the individual parameters of children. Depending on the gradient estimator,
+ * each starting point is followed by one child per parameter (forward differences),
+ * two children per parameter (central differences, x+h and x-h), or two children
+ * for all parameters (SPSA, x+h*delta and x-h*delta with random signs delta).
  */
 void GGradientDescent::updateChildParameters() {
+	std::size_t nChildren = this->getNChildrenPerStartingPoint();
+
+	// Loads the current "parent" into a "child" and attaches a feature vector to it
+	auto setChild = [this](std::size_t parentPos, std::size_t childPos, const std::vector<double>& parmVec) {
+		this->at(childPos)->GObject::load(this->at(parentPos));
+		this->at(childPos)->getPersonalityTraits<GGradientDescent_PersonalityTraits>()->setPopulationPosition(childPos);
+		this->at(childPos)->assignValueVector<double>(parmVec, activityMode::ACTIVEONLY);
+	};
+
+	if (gradientEstimator::GD_SPSA == gradientEstimator_) {
+		spsaPerturbations_.resize(nStartingPoints_ * nFPParmsFirst_);
+	}
+
 	// Loop over all starting points
 	for (std::size_t i = 0; i < nStartingPoints_; i++) {
 		// Extract the fp vector
 		std::vector<double> parmVec;
 		this->at(i)->streamline<double>(parmVec, activityMode::ACTIVEONLY); // Only extract active parameters
 
-		// Loop over all directions
-		for (std::size_t j = 0; j < nFPParmsFirst_; j++) {
-			// Calculate the position of the child
-			std::size_t childPos = nStartingPoints_ + i * nFPParmsFirst_ + j;
-
-			// Load the current "parent" into the "child"
-			this->at(childPos)->GObject::load(this->at(i));
+		// The position of the first child of this starting point
+		std::size_t firstChild = nStartingPoints_ + i * nChildren;
 
-			// Update the child's position in the population
-			this->at(childPos)->getPersonalityTraits<GGradientDescent_PersonalityTraits>()->setPopulationPosition(childPos);
+		switch (gradientEstimator_) {
+			case gradientEstimator::GD_FORWARDDIFFERENCE:
+			case gradientEstimator::GD_CENTRALDIFFERENCE: {
+				bool central = (gradientEstimator::GD_CENTRALDIFFERENCE == gradientEstimator_);
 
-			// Make a note of the current parameter's value
-			double origParmVal = parmVec[j];
+				// Loop over all directions
+				for (std::size_t j = 0; j < nFPParmsFirst_; j++) {
+					// Make a note of the current parameter's value
+					double origParmVal = parmVec[j];
 
-			// Add the finite step to the feature vector's current parameter
-			parmVec[j] += adjustedFiniteStep_[j];
+					// Add the finite step to the feature vector's current parameter
+					parmVec[j] = origParmVal + adjustedFiniteStep_[j];
+					setChild(i, central ? (firstChild + 2 * j) : (firstChild + j), parmVec);
 
-			// Attach the feature vector to the child individual
-			this->at(childPos)->assignValueVector<double>(parmVec, activityMode::ACTIVEONLY);
+					// Central differences also need a step into the opposite direction
+					if (central) {
+						parmVec[j] = origParmVal - adjustedFiniteStep_[j];
+						setChild(i, firstChild + 2 * j + 1, parmVec);
+					}
 
-			// Restore the original value in the feature vector
-			parmVec[j] = origParmVal;
+					// Restore the original value in the feature vector
+					parmVec[j] = origParmVal;
+				}
+			}
+				break;
+
+			case gradientEstimator::GD_SPSA: {
+				// Perturb all parameters at once in randomly chosen directions
+				std::vector<double> plusVec(parmVec), minusVec(parmVec);
+				for (std::size_t j = 0; j < nFPParmsFirst_; j++) {
+					double delta = (G_OptimizationAlgorithm_Base::m_uniform_real_distribution(m_gr, std::uniform_real_distribution<double>::param_type(0., 1.)) < 0.5) ? -1. : 1.;
+					spsaPerturbations_[i * nFPParmsFirst_ + j] = delta;
+					plusVec[j] += delta * adjustedFiniteStep_[j];
+					minusVec[j] -= delta * adjustedFiniteStep_[j];
+				}
+
+				setChild(i, firstChild, plusVec);
+				setChild(i, firstChild + 1, minusVec);
+			}
+				break;
 		}
 	}
 }
 
 /**********************************************************************************************************/
 /**
- * Performs a step of the parent individuals.
+ * Performs a step of the parent individuals. The step in each direction is proportional to the
+ * estimated change of the fitness over one finite step, i.e. f(x+h)-f(x) for forward differences,
+ * (f(x+h)-f(x-h))/2 for central differences and (f(x+h*delta)-f(x-h*delta))/(2*delta) for SPSA.
  * TODO: keep going in the same direction as long as there is an improvement
  */
 void GGradientDescent::updateParentIndividuals() {
+	std::size_t nChildren = this->getNChildrenPerStartingPoint();
+
 	for (std::size_t i = 0; i < nStartingPoints_; i++) {
 		// Extract the fp vector
 		std::vector<double> parmVec;
@@ -384,20 +480,38 @@ void GGradientDescent::updateParentIndividuals() {
 		// Retrieve the fitness of the individual again
 		double parentFitness = minOnly_transformed_fitness(this->at(i));
 
+		// The position of the first child of this starting point
+		std::size_t firstChild = nStartingPoints_ + i * nChildren;
+
 		// Calculate the adaption of each parameter
-		// double gradient = 0.;
 		for (std::size_t j = 0; j < nFPParmsFirst_; j++) {
-			// Calculate the position of the child
-			std::size_t childPos = nStartingPoints_ + i * nFPParmsFirst_ + j;
-
 			// Calculate the step to be performed in a given direction and
 			// adjust the parameter vector of each parent
 			try {
-				parmVec[j] -= boost::numeric_cast<double>(
-					stepRatio_ *
-					(boost::numeric_cast<long double>(
-						minOnly_transformed_fitness(this->at(childPos)) - boost::numeric_cast<long double>(parentFitness)))
-				);
+				long double fitnessDifference = 0.;
+				switch (gradientEstimator_) {
+					case gradientEstimator::GD_FORWARDDIFFERENCE:
+						fitnessDifference =
+							boost::numeric_cast<long double>(minOnly_transformed_fitness(this->at(firstChild + j)))
+							- boost::numeric_cast<long double>(parentFitness);
+						break;
+
+					case gradientEstimator::GD_CENTRALDIFFERENCE:
+						fitnessDifference = (
+							boost::numeric_cast<long double>(minOnly_transformed_fitness(this->at(firstChild + 2 * j)))
+							- boost::numeric_cast<long double>(minOnly_transformed_fitness(this->at(firstChild + 2 * j + 1)))
+						) / 2.;
+						break;
+
+					case gradientEstimator::GD_SPSA:
+						fitnessDifference = (
+							boost::numeric_cast<long double>(minOnly_transformed_fitness(this->at(firstChild)))
+							- boost::numeric_cast<long double>(minOnly_transformed_fitness(this->at(firstChild + 1)))
+						) / (2. * spsaPerturbations_.at(i * nFPParmsFirst_ + j));
+						break;
+				}
+
+				parmVec[j] -= boost::numeric_cast<double>(stepRatio_ * fitnessDifference);
 			} catch (boost::bad_numeric_cast &e) {
 				throw gemfony_exception(
 					g_error_streamer(DO_LOG,  time_and_place)
@@ -450,6 +564,16 @@ void GGradientDescent::addConfigurationOptions_(
 		<< "direction of steepest descent," << std::endl
 		<< "specified in per mill of the allowed or expected value" << std::endl
 		<< "range of a parameter";
+
+	gpb.registerFileParameter<gradientEstimator>(
+		"gradientEstimator" // The name of the variable
+		, DEFAULTGRADIENTESTIMATOR // The default value
+		, [this](gradientEstimator ge) { this->setGradientEstimator(ge); }
+	)
+		<< "Specifies how the gradient is estimated:" << std::endl
+		<< "0: forward differences (one evaluation per parameter)" << std::endl
+		<< "1: central differences (two evaluations per parameter)" << std::endl
+		<< "2: SPSA (two evaluations, independent of the number of parameters)";
 }
 
 /******************************************************************************/
@@ -644,7 +768,8 @@ void GGradientDescent::adjustPopulation_() {
 #endif
 
 	// Set the default size of the population
-	G_OptimizationAlgorithm_Base::setDefaultPopulationSize(nStartingPoints_ * (nFPParmsFirst_ + 1));
+	std::size_t nChildren = this->getNChildrenPerStartingPoint();
+	G_OptimizationAlgorithm_Base::setDefaultPopulationSize(nStartingPoints_ * (nChildren + 1));
 
 	// First create a suitable number of start individuals and initialize them as required
 	if (nStart < nStartingPoints_) {
@@ -662,20 +787,20 @@ void GGradientDescent::adjustPopulation_() {
 	// Add the required number of clones for each starting point. These will be
 	// used for the calculation of the difference quotient for each parameter
 	for (std::size_t i = 0; i < nStartingPoints_; i++) {
-		for (std::size_t j = 0; j < nFPParmsFirst_; j++) {
+		for (std::size_t j = 0; j < nChildren; j++) {
 			this->push_back(this->at(i)->clone<GParameterSet>());
 		}
 	}
 
 	// We now should have nStartingPoints_ sets of individuals,
-	// each of size nFPParmsFirst_.
+	// each of size nChildren + 1.
 #ifdef DEBUG
-	if(this->size() != nStartingPoints_*(nFPParmsFirst_ + 1)) {
+	if(this->size() != nStartingPoints_*(nChildren + 1)) {
 		throw gemfony_exception(
 			g_error_streamer(DO_LOG,  time_and_place)
 				<< "In GGradientDescent::adjustPopulation():" << std::endl
 				<< "Population size is " << this->size() << std::endl
-				<< "but expected " << nStartingPoints_*(nFPParmsFirst_ + 1) << std::endl
+				<< "but expected " << nStartingPoints_*(nChildren + 1) << std::endl
 		);
 	}
 #endif /* DEBUG */
@@ -718,6 +843,63 @@ void GGradientDescent::specificTestsNoFailureExpected_GUnitTests_() {
 #ifdef GEM_TESTING
 	// Call the parent class'es function
 	G_OptimizationAlgorithm_Base::specificTestsNoFailureExpected_GUnitTests_();
+
+	//------------------------------------------------------------------------------
+
+	{ // Check that all gradient estimators descend on a quadratic function
+		boost::filesystem::path executorConfig("./GGradientDescent_estimatorTest_executor.json");
+
+		// Sum of squares of all parameters, i.e. the fitness of GTestIndividual1
+		auto sumOfSquares = [](std::shared_ptr<GParameterSet> p) -> double {
+			std::vector<double> parmVec;
+			p->streamline<double>(parmVec, activityMode::ACTIVEONLY);
+			double result = 0.;
+			for(auto x: parmVec) result += x*x;
+			return result;
+		};
+
+		std::shared_ptr<GParameterSet> start_ptr(new Gem::Tests::GTestIndividual1());
+		start_ptr->randomInit(activityMode::ALLPARAMETERS);
+		double startValue = sumOfSquares(start_ptr);
+
+		std::vector<gradientEstimator> estimators {
+			gradientEstimator::GD_FORWARDDIFFERENCE
+			, gradientEstimator::GD_CENTRALDIFFERENCE
+			, gradientEstimator::GD_SPSA
+		};
+
+		for(auto ge: estimators) {
+			std::shared_ptr<GGradientDescent> p_test = this->clone<GGradientDescent>();
+
+			BOOST_CHECK_NO_THROW(p_test->clear());
+			p_test->push_back(start_ptr->clone<GParameterSet>());
+			BOOST_CHECK_NO_THROW(p_test->setNStartingPoints(1));
+			BOOST_CHECK_NO_THROW(p_test->setGradientEstimator(ge));
+			BOOST_CHECK(p_test->getGradientEstimator() == ge);
+			p_test->setMaxIteration(10);
+			p_test->registerExecutor(
+				std::shared_ptr<Gem::Courtier::GBaseExecutorT<GParameterSet>>(new Gem::Courtier::GSerialExecutorT<GParameterSet>())
+				, executorConfig
+			);
+
+			BOOST_CHECK_NO_THROW(p_test->optimize());
+
+			// The population size depends on the estimator
+			BOOST_CHECK(p_test->size() == 1 + p_test->getNChildrenPerStartingPoint());
+
+			// The starting point must have moved downhill
+			double endValue = sumOfSquares(p_test->at(0));
+			BOOST_CHECK_MESSAGE(
+				endValue < startValue
+				, "Gradient estimator " << ge << " did not descend: " << endValue << " / " << startValue
+			);
+		}
+
+		boost::filesystem::remove(executorConfig);
+	}
+
+	//------------------------------------------------------------------------------
+
 #else /* GEM_TESTING */ // If this function is called when GEM_TESTING isn't set, throw
 	Gem::Common::condnotset("GGradientDescent::specificTestsNoFailureExpected_GUnitTests", "GEM_TESTING");
 #endif /* GEM_TESTING */
@@ -408,6 +408,20 @@ void G_OptimizationAlgorithm_ParChild::actOnStalls_() {
 	}
 }
 
+/******************************************************************************/
+/**
+ * Lets immigrants replace the worst parents. Only parents are considered, as
+ * children are recreated from them in the next iteration.
+ *
+ * @param immigrants Processed individuals from other populations
+ * @return The number of immigrants that were accepted
+ */
+std::size_t G_OptimizationAlgorithm_ParChild::integrateImmigrants_(
+	std::vector<std::shared_ptr<GParameterSet>> const & immigrants
+) {
+	return this->replaceWorstIndividuals(immigrants, 0, this->getNParents());
+}
+
 /******************************************************************************/
 /**
  * Emits a name for this class / object
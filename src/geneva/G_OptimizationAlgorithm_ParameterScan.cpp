@@ -320,6 +320,14 @@ GParameterScan::GParameterScan(const GParameterScan &cp)
 	  , m_nMonitorInds(cp.m_nMonitorInds)
 	  , m_simpleScanItems(cp.m_simpleScanItems)
 	  , m_scansPerformed(cp.m_scansPerformed)
+	  , m_nShards(cp.m_nShards)
+	  , m_shardIndex(cp.m_shardIndex)
+	  , m_nextCombination(cp.m_nextCombination)
+	  , m_endCombination(cp.m_endCombination)
+	  , m_scanSequence(cp.m_scanSequence)
+	  , m_scrambleSequence(cp.m_scrambleSequence)
+	  , m_scrambleSeed(cp.m_scrambleSeed)
+	  , m_sequence_ptr(cp.m_sequence_ptr) // The sequence is immutable and may be shared
 {
 	// Copying / setting of the optimization algorithm id is done by the parent class. The same
 	// applies to the copying of the optimization monitor.
@@ -405,6 +413,11 @@ void GParameterScan::compare_(
 	compare_t(IDENTITY(m_nMonitorInds,    p_load->m_nMonitorInds),    token);
 	compare_t(IDENTITY(m_simpleScanItems, p_load->m_simpleScanItems), token);
 	compare_t(IDENTITY(m_scansPerformed,  p_load->m_scansPerformed),  token);
+	compare_t(IDENTITY(m_nShards,         p_load->m_nShards),         token);
+	compare_t(IDENTITY(m_shardIndex,      p_load->m_shardIndex),      token);
+	compare_t(IDENTITY(m_scanSequence,    p_load->m_scanSequence),    token);
+	compare_t(IDENTITY(m_scrambleSequence, p_load->m_scrambleSequence), token);
+	compare_t(IDENTITY(m_scrambleSeed,    p_load->m_scrambleSeed),    token);
 
 	// React on deviations from the expectation
 	token.evaluate();
@@ -479,6 +492,11 @@ void GParameterScan::load_(const GObject *cp) {
 	m_nMonitorInds = p_load->m_nMonitorInds;
 	m_simpleScanItems = p_load->m_simpleScanItems;
 	m_scansPerformed = p_load->m_scansPerformed;
+	m_nShards = p_load->m_nShards;
+	m_shardIndex = p_load->m_shardIndex;
+	m_scanSequence = p_load->m_scanSequence;
+	m_scrambleSequence = p_load->m_scrambleSequence;
+	m_scrambleSeed = p_load->m_scrambleSeed;
 
 	// Load the parameter objects
 	m_b_cnt.clear();
@@ -575,7 +593,7 @@ void GParameterScan::updateSelectedParameters() {
 		//------------------------------------------------------------------------
 		// Retrieve a work item
 		std::size_t mode = 0;
-		std::shared_ptr <parSet> pS = getParameterSet(mode);
+		std::shared_ptr <parSet> pS = getParameterSet(m_nextCombination, mode);
 
 		switch (mode) {
 			//---------------------------------------------------------------------
@@ -701,7 +719,7 @@ void GParameterScan::updateSelectedParameters() {
 
 		//------------------------------------------------------------------------
 		// Make sure we continue with the next parameter set in the next iteration
-		if (not this->switchToNextParameterSet()) {
+		if (++m_nextCombination >= m_endCombination) {
 			// Let the audience know that the optimization may be stopped
 			this->m_cycleLogicHalt = true;
 
@@ -894,7 +912,50 @@ std::shared_ptr <parSet> GParameterScan::getParameterSet(std::size_t &mode) {
 
 /******************************************************************************/
 /**
- * Switches to the next parameter set
+ * Retrieves the parameter set with a given combination index. The index is decoded
+ * like a mixed-radix number, with the first parameter object in m_all_par_cnt being
+ * the fastest-changing digit. This is the same order in which switchToNextParameterSet()
+ * enumerates the combinations, but does not require visiting all preceding combinations,
+ * so that any range of combinations may be scanned independently. When a quasi-random
+ * sequence is used, the combination index selects the sequence point instead, whose
+ * coordinates are assigned to the parameter objects in the same order. The origin
+ * of the sequence is skipped.
+ *
+ * @param index The index of the desired parameter combination
+ * @param mode Indicates whether parameters are identified by name or by id
+ */
+std::shared_ptr <parSet> GParameterScan::getParameterSet(std::size_t index, std::size_t &mode) {
+	std::size_t remainder = index;
+	for(const auto& par_ptr: m_all_par_cnt) {
+		std::size_t nSteps = par_ptr->getNSteps();
+		par_ptr->setPosition(remainder % nSteps);
+		remainder /= nSteps;
+	}
+
+	if (0 != remainder) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG,  time_and_place)
+				<< "In GParameterScan::getParameterSet(index): Error!" << std::endl
+				<< "Combination index " << index << " exceeds the number of combinations " << this->getNCombinations() << std::endl
+		);
+	}
+
+	if (m_sequence_ptr) {
+		std::size_t dim = 0;
+		for(const auto& par_ptr: m_all_par_cnt) {
+			par_ptr->setUnitPosition(m_sequence_ptr->value(std::uint64_t(index) + 1, dim++));
+		}
+	}
+
+	return this->getParameterSet(mode);
+}
+
+/******************************************************************************/
+/**
+ * Switches to the next parameter set, treating the parameter objects like an
+ * odometer. The scan itself addresses combinations by index (see
+ * getParameterSet(std::size_t, std::size_t&)); this sequential enumeration
+ * defines the order the index decoding must reproduce.
  *
  * @return A boolean indicating whether there indeed is a following
  * parameter set (true) or whether we have reached the end of the
@@ -940,6 +1001,93 @@ void GParameterScan::clearAllParVec() {
 	m_all_par_cnt.clear();
 }
 
+/******************************************************************************/
+/**
+ * Retrieves the overall number of parameter combinations to be scanned, i.e. the
+ * product of the number of values of all parameters
+ *
+ * @return The number of parameter combinations
+ */
+std::size_t GParameterScan::getNCombinations() const {
+	std::size_t nCombinations = 1;
+
+	auto multiply = [&nCombinations](std::size_t nSteps) {
+		if (0 == nSteps) {
+			nCombinations = 0;
+		} else if (nCombinations > (std::numeric_limits<std::size_t>::max)() / nSteps) {
+			throw gemfony_exception(
+				g_error_streamer(DO_LOG,  time_and_place)
+					<< "In GParameterScan::getNCombinations(): Error!" << std::endl
+					<< "The number of parameter combinations exceeds the range of std::size_t" << std::endl
+			);
+		} else {
+			nCombinations *= nSteps;
+		}
+	};
+
+	for(const auto& item_ptr: m_b_cnt)     { multiply(item_ptr->getNSteps()); }
+	for(const auto& item_ptr: m_int32_cnt) { multiply(item_ptr->getNSteps()); }
+	for(const auto& item_ptr: m_f_cnt)     { multiply(item_ptr->getNSteps()); }
+	for(const auto& item_ptr: m_d_cnt)     { multiply(item_ptr->getNSteps()); }
+
+	return nCombinations;
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the first and (exclusive) last combination index of the shard
+ * assigned to this object. The sizes of all shards differ by at most one.
+ *
+ * @param nCombinations The overall number of parameter combinations
+ * @return The range of combination indices to be scanned
+ */
+std::tuple<std::size_t, std::size_t> GParameterScan::getShardRange(std::size_t nCombinations) const {
+	std::size_t baseSize = nCombinations / m_nShards;
+	std::size_t nLarger = nCombinations % m_nShards;
+
+	std::size_t first = m_shardIndex * baseSize + (std::min)(m_shardIndex, nLarger);
+	std::size_t last = first + baseSize + ((m_shardIndex < nLarger) ? 1 : 0);
+
+	return std::make_tuple(first, last);
+}
+
+/******************************************************************************/
+/**
+ * Restricts the scan to one of a number of equally sized ranges of parameter
+ * combinations. This allows to split a grid among several independent runs.
+ *
+ * @param nShards The number of ranges the parameter combinations are split into
+ * @param shardIndex The range to be scanned by this object
+ */
+void GParameterScan::setShard(std::size_t nShards, std::size_t shardIndex) {
+	if (0 == nShards || shardIndex >= nShards) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG,  time_and_place)
+				<< "In GParameterScan::setShard(): Error!" << std::endl
+				<< "Invalid shard " << shardIndex << " of " << nShards << std::endl
+		);
+	}
+
+	m_nShards = nShards;
+	m_shardIndex = shardIndex;
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the number of ranges the parameter combinations are split into
+ */
+std::size_t GParameterScan::getNShards() const {
+	return m_nShards;
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the range of parameter combinations scanned by this object
+ */
+std::size_t GParameterScan::getShardIndex() const {
+	return m_shardIndex;
+}
+
 /******************************************************************************/
 /**
  * A custom halt criterion for the optimization, allowing to stop the loop
@@ -991,6 +1139,38 @@ void GParameterScan::addConfigurationOptions_(
 		<< "Indicates whether scans of individual variables should be done randomly" << std::endl
 		<< "(1) or on a grid (0)";
 
+	gpb.registerFileParameter<std::size_t, std::size_t>(
+		"nShards" // The name of the first variable
+		, "shardIndex" // The name of the second variable
+		, 1 // The default value for the first variable
+		, 0 // The default value for the second variable
+		, [this](std::size_t ns, std::size_t si) { this->setShard(ns, si); }
+		, "shard"
+	)
+		<< "The number of equally sized ranges the parameter combinations are split into" << Gem::Common::nextComment()
+		<< "The range of parameter combinations to be scanned by this run (0 to nShards-1)";
+
+	gpb.registerFileParameter<scanSequence>(
+		"scanSequence" // The name of the variable
+		, DEFAULTSCANSEQUENCE // The default value
+		, [this](scanSequence ss) { this->setScanSequence(ss); }
+	)
+		<< "Determines how random scans pick their samples:" << std::endl
+		<< "0: uniform random numbers" << std::endl
+		<< "1: Halton sequence" << std::endl
+		<< "2: Sobol sequence (up to " << Gem::Hap::MAXSOBOLDIMENSIONS << " parameters)";
+
+	gpb.registerFileParameter<bool, Gem::Hap::seed_type>(
+		"scrambleSequence" // The name of the first variable
+		, "scrambleSeed" // The name of the second variable
+		, DEFAULTSCRAMBLESCANSEQUENCE // The default value for the first variable
+		, Gem::Hap::DEFAULTSTARTSEED // The default value for the second variable
+		, [this](bool sc, Gem::Hap::seed_type seed) { this->setScrambleSequence(sc, seed); }
+		, "scrambling"
+	)
+		<< "Indicates whether Halton and Sobol sequences should be scrambled" << Gem::Common::nextComment()
+		<< "The seed used for scrambling; must be the same for all shards of a scan";
+
 	// Override the default value of maxStallIteration, as the parent
 	// default does not make sense for us (we do not need stall iterations)
 	gpb.resetFileParameterDefaults(
@@ -1173,6 +1353,65 @@ bool GParameterScan::getScanRandomly() const {
 	return m_scanRandomly;
 }
 
+/******************************************************************************/
+/**
+ * Specifies how random scans pick their samples. Halton and Sobol sequences
+ * cover the parameter space more evenly than uniform random numbers, so that
+ * fewer evaluations are needed for the same coverage. Like the grid, the points
+ * of these sequences are addressed by the combination index, so that shards may
+ * be scanned independently. The settings have no effect for scans on a grid.
+ */
+void GParameterScan::setScanSequence(scanSequence sequence) {
+	if (sequence > scanSequence::SCANSEQUENCE_LAST) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG,  time_and_place)
+				<< "In GParameterScan::setScanSequence(): Error!" << std::endl
+				<< "Got invalid scan sequence " << sequence << std::endl
+		);
+	}
+
+	m_scanSequence = sequence;
+}
+
+/******************************************************************************/
+/**
+ * Retrieves how random scans pick their samples
+ */
+scanSequence GParameterScan::getScanSequence() const {
+	return m_scanSequence;
+}
+
+/******************************************************************************/
+/**
+ * Specifies whether quasi-random sequences should be scrambled. Scrambling
+ * removes the correlations between the dimensions of Halton sequences and the
+ * alignment of the points, while retaining their even distribution. All shards
+ * of a scan need to use the same seed.
+ *
+ * @param scramble Indicates whether quasi-random sequences should be scrambled
+ * @param seed The seed used for the scrambling
+ */
+void GParameterScan::setScrambleSequence(bool scramble, Gem::Hap::seed_type seed) {
+	m_scrambleSequence = scramble;
+	m_scrambleSeed = seed;
+}
+
+/******************************************************************************/
+/**
+ * Checks whether quasi-random sequences are scrambled
+ */
+bool GParameterScan::getScrambleSequence() const {
+	return m_scrambleSequence;
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the seed used for the scrambling of quasi-random sequences
+ */
+Gem::Hap::seed_type GParameterScan::getScrambleSeed() const {
+	return m_scrambleSeed;
+}
+
 /******************************************************************************/
 /**
  * Does some preparatory work before the optimization starts
@@ -1192,6 +1431,43 @@ void GParameterScan::init() {
 
 	// Copy all parameter objects to the central vector for easier handling
 	this->fillAllParVec();
+
+	// Set up the quasi-random sequence, if requested
+	m_sequence_ptr.reset();
+	if (0 == m_simpleScanItems && m_scanRandomly && not m_all_par_cnt.empty()) {
+		switch (m_scanSequence) {
+			case scanSequence::SCAN_UNIFORMRANDOM:
+				break;
+
+			case scanSequence::SCAN_HALTON:
+				m_sequence_ptr = std::make_shared<Gem::Hap::GHaltonSequence>(m_all_par_cnt.size(), m_scrambleSequence, m_scrambleSeed);
+				break;
+
+			case scanSequence::SCAN_SOBOL:
+				m_sequence_ptr = std::make_shared<Gem::Hap::GSobolSequence>(m_all_par_cnt.size(), m_scrambleSequence, m_scrambleSeed);
+				break;
+
+			default:
+				throw gemfony_exception(
+					g_error_streamer(DO_LOG,  time_and_place)
+						<< "In GParameterScan::init(): Error!" << std::endl
+						<< "Got invalid scan sequence " << m_scanSequence << std::endl
+				);
+		}
+	}
+
+	// Determine the range of parameter combinations to be scanned
+	if (0 == m_simpleScanItems) {
+		std::tie(m_nextCombination, m_endCombination) = this->getShardRange(this->getNCombinations());
+
+		if (m_nextCombination >= m_endCombination) {
+			throw gemfony_exception(
+				g_error_streamer(DO_LOG,  time_and_place)
+					<< "In GParameterScan::init(): Error!" << std::endl
+					<< "Shard " << m_shardIndex << " of " << m_nShards << " holds no parameter combinations" << std::endl
+			);
+		}
+	}
 }
 
 /******************************************************************************/
@@ -1199,6 +1475,9 @@ void GParameterScan::init() {
  * Does any necessary finalization work
  */
 void GParameterScan::finalize() {
+	// The sequence will be set up again in init()
+	m_sequence_ptr.reset();
+
 	// Last action
 	G_OptimizationAlgorithm_Base::finalize();
 }
@@ -1287,6 +1566,97 @@ void GParameterScan::specificTestsNoFailureExpected_GUnitTests_() {
 #ifdef GEM_TESTING
 	// Call the parent class'es function
 	G_OptimizationAlgorithm_Base::specificTestsNoFailureExpected_GUnitTests_();
+
+	//------------------------------------------------------------------------------
+
+	{ // Check that decoding a combination index yields the same parameter set as the sequential enumeration
+		std::shared_ptr<GParameterScan> p_test = this->clone<GParameterScan>();
+
+		BOOST_CHECK_NO_THROW(p_test->setScanRandomly(false));
+		BOOST_CHECK_NO_THROW(p_test->setParameterSpecs("d(0, -1., 1., 3), f(1, 0., 2., 4), i(0, -2, 2), b(0, false, true, 2)"));
+		p_test->clearAllParVec();
+		p_test->fillAllParVec();
+
+		std::size_t nCombinations = p_test->getNCombinations();
+		BOOST_CHECK_MESSAGE(nCombinations == 3*4*5*2, "Got " << nCombinations << " combinations");
+
+		// Enumerate all combinations sequentially
+		std::vector<std::shared_ptr<parSet>> sequential;
+		std::vector<std::size_t> sequentialModes;
+		p_test->resetParameterObjects();
+		while(true) {
+			std::size_t mode = 0;
+			sequential.push_back(p_test->getParameterSet(mode));
+			sequentialModes.push_back(mode);
+			if(not p_test->switchToNextParameterSet()) break;
+		}
+		BOOST_CHECK(sequential.size() == nCombinations);
+
+		// Decode the indices in reverse order, so no state can be carried over from the enumeration
+		for(std::size_t k = sequential.size(); k > 0; k--) {
+			std::size_t mode = 0;
+			std::shared_ptr<parSet> decoded = p_test->getParameterSet(k - 1, mode);
+			BOOST_CHECK(mode == sequentialModes.at(k - 1));
+			BOOST_CHECK_MESSAGE(
+				decoded->bParVec == sequential.at(k - 1)->bParVec
+				&& decoded->iParVec == sequential.at(k - 1)->iParVec
+				&& decoded->fParVec == sequential.at(k - 1)->fParVec
+				&& decoded->dParVec == sequential.at(k - 1)->dParVec
+				, "Decoded parameter set " << k - 1 << " differs from the enumeration:\n" << *decoded << *(sequential.at(k - 1))
+			);
+		}
+
+		// Indices beyond the last combination must be rejected
+		std::size_t mode = 0;
+		BOOST_CHECK_THROW(p_test->getParameterSet(nCombinations, mode), gemfony_exception);
+
+		// Shards must cover all combinations without gaps or overlaps
+		for(std::size_t nShards = 1; nShards <= 7; nShards++) {
+			std::size_t expectedFirst = 0;
+			for(std::size_t shard = 0; shard < nShards; shard++) {
+				BOOST_CHECK_NO_THROW(p_test->setShard(nShards, shard));
+				std::size_t first = 0, last = 0;
+				std::tie(first, last) = p_test->getShardRange(nCombinations);
+				BOOST_CHECK(first == expectedFirst);
+				BOOST_CHECK(last > first);
+				expectedFirst = last;
+			}
+			BOOST_CHECK(expectedFirst == nCombinations);
+		}
+	}
+
+	//------------------------------------------------------------------------------
+
+	{ // Check that combination indices select the points of a quasi-random sequence in random scans
+		std::shared_ptr<GParameterScan> p_test = this->clone<GParameterScan>();
+
+		BOOST_CHECK_NO_THROW(p_test->setScanRandomly(true));
+		BOOST_CHECK_NO_THROW(p_test->setParameterSpecs("d(0, -1., 1., 4), d(1, 0., 4., 2)"));
+		p_test->clearAllParVec();
+		p_test->fillAllParVec();
+		p_test->m_sequence_ptr = std::make_shared<Gem::Hap::GSobolSequence>(2);
+
+		// The first points of the two-dimensional Sobol sequence, skipping the origin
+		const double sobol[7][2] = {
+			{0.5, 0.5}, {0.75, 0.25}, {0.25, 0.75}, {0.375, 0.375}, {0.875, 0.875}, {0.625, 0.125}, {0.125, 0.625}
+		};
+
+		BOOST_CHECK(p_test->getNCombinations() == 8);
+		for(std::size_t k = 0; k < 7; k++) {
+			std::size_t mode = 0;
+			std::shared_ptr<parSet> pS = p_test->getParameterSet(k, mode);
+			BOOST_CHECK(pS->dParVec.size() == 2);
+			double d0 = std::get<0>(pS->dParVec.at(0));
+			double d1 = std::get<0>(pS->dParVec.at(1));
+			BOOST_CHECK_MESSAGE(
+				d0 == -1. + 2. * sobol[k][0] && d1 == 4. * sobol[k][1]
+				, "Point " << k << " is (" << d0 << ", " << d1 << ") instead of (" << -1. + 2. * sobol[k][0] << ", " << 4. * sobol[k][1] << ")"
+			);
+		}
+	}
+
+	//------------------------------------------------------------------------------
+
 #else /* GEM_TESTING */ // If this function is called when GEM_TESTING isn't set, throw
 	Gem::Common::condnotset("GParameterScan::specificTestsNoFailureExpected_GUnitTests", "GEM_TESTING");
 #endif /* GEM_TESTING */
@@ -1300,6 +1670,29 @@ void GParameterScan::specificTestsFailuresExpected_GUnitTests_() {
 #ifdef GEM_TESTING
 	// Call the parent class'es function
 	G_OptimizationAlgorithm_Base::specificTestsFailuresExpected_GUnitTests_();
+
+	//------------------------------------------------------------------------------
+
+	{ // Check that invalid shards are rejected
+		std::shared_ptr<GParameterScan> p_test = this->clone<GParameterScan>();
+
+		BOOST_CHECK_THROW(p_test->setShard(0, 0), gemfony_exception);
+		BOOST_CHECK_THROW(p_test->setShard(3, 3), gemfony_exception);
+	}
+
+	//------------------------------------------------------------------------------
+
+	{ // Check that invalid scan sequences are rejected
+		std::shared_ptr<GParameterScan> p_test = this->clone<GParameterScan>();
+
+		BOOST_CHECK_THROW(
+			p_test->setScanSequence(static_cast<scanSequence>(static_cast<Gem::Common::ENUMBASETYPE>(scanSequence::SCANSEQUENCE_LAST) + 1))
+			, gemfony_exception
+		);
+	}
+
+	//------------------------------------------------------------------------------
+
 #else /* GEM_TESTING */ // If this function is called when GEM_TESTING isn't set, throw
 	Gem::Common::condnotset("GParameterScan::specificTestsNoFailureExpected_GUnitTests", "GEM_TESTING");
 #endif /* GEM_TESTING */
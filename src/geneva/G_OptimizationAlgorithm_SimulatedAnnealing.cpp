@@ -90,6 +90,11 @@ void GSimulatedAnnealing::compare_(
 	compare_t(IDENTITY(m_t, p_load->m_t), token);
 	compare_t(IDENTITY(m_alpha, p_load->m_alpha), token);
 	compare_t(IDENTITY(m_n_threads, p_load->m_n_threads), token);
+	compare_t(IDENTITY(m_use_parallel_tempering, p_load->m_use_parallel_tempering), token);
+	compare_t(IDENTITY(m_pt_temperature_ratio, p_load->m_pt_temperature_ratio), token);
+	compare_t(IDENTITY(m_pt_swap_interval, p_load->m_pt_swap_interval), token);
+	compare_t(IDENTITY(m_pt_swaps_attempted, p_load->m_pt_swaps_attempted), token);
+	compare_t(IDENTITY(m_pt_swaps_accepted, p_load->m_pt_swaps_accepted), token);
 
 	// React on deviations from the expectation
 	token.evaluate();
@@ -104,6 +109,10 @@ void GSimulatedAnnealing::resetToOptimizationStart_() {
 	// Reset the temperature
 	m_t = m_t0;
 
+	// Reset the swap statistics of parallel tempering
+	m_pt_swaps_attempted = 0;
+	m_pt_swaps_accepted = 0;
+
 	// There is no more work to be done here, so we simply call the
 	// function of the parent class
 	G_OptimizationAlgorithm_ParChild::resetToOptimizationStart_();
@@ -165,6 +174,30 @@ void GSimulatedAnnealing::addConfigurationOptions_ (
 	)
 		<< "The degradation strength used in the cooling" << std::endl
 		<< "schedule in simulated annealing;";
+
+	gpb.registerFileParameter<bool>(
+		"useParallelTempering" // The name of the variable
+		, SA_PARALLELTEMPERING // The default value
+		, [this](bool upt) { this->setUseParallelTempering(upt); }
+	)
+		<< "Indicates whether each parent should act as a separate chain" << std::endl
+		<< "at its own temperature (parallel tempering / replica exchange)";
+
+	gpb.registerFileParameter<double>(
+		"ptTemperatureRatio" // The name of the variable
+		, SA_PTTEMPERATURERATIO // The default value
+		, [this](double r) { this->setPTTemperatureRatio(r); }
+	)
+		<< "The ratio between the temperatures of neighboring chains" << std::endl
+		<< "in parallel tempering mode. The first chain runs at temperature t";
+
+	gpb.registerFileParameter<std::uint32_t>(
+		"ptSwapInterval" // The name of the variable
+		, SA_PTSWAPINTERVAL // The default value
+		, [this](std::uint32_t si) { this->setPTSwapInterval(si); }
+	)
+		<< "The number of iterations between attempts to swap the states" << std::endl
+		<< "of neighboring chains in parallel tempering mode";
 }
 
 /******************************************************************************/
@@ -266,6 +299,105 @@ double GSimulatedAnnealing::getT() const {
 	return m_t;
 }
 
+/******************************************************************************/
+/**
+ * Enables or disables the parallel tempering (replica exchange) mode. Each parent
+ * then represents a chain at its own temperature, and the children of an iteration
+ * are divided evenly among the chains. All children are still evaluated together,
+ * so additional evaluation resources let more chains advance at the same time.
+ *
+ * @param useParallelTempering Indicates whether parallel tempering should be used
+ */
+void GSimulatedAnnealing::setUseParallelTempering(bool useParallelTempering) {
+	m_use_parallel_tempering = useParallelTempering;
+}
+
+/******************************************************************************/
+/**
+ * Checks whether the parallel tempering mode is used
+ */
+bool GSimulatedAnnealing::getUseParallelTempering() const {
+	return m_use_parallel_tempering;
+}
+
+/******************************************************************************/
+/**
+ * Sets the ratio between the temperatures of neighboring chains in parallel
+ * tempering mode. Chain i runs at temperature t*ratio^i.
+ *
+ * @param ratio The ratio between the temperatures of neighboring chains
+ */
+void GSimulatedAnnealing::setPTTemperatureRatio(double ratio) {
+	if (ratio <= 1.) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG,  time_and_place)
+				<< "In GSimulatedAnnealing::setPTTemperatureRatio(double):" << std::endl
+				<< "Got invalid temperature ratio " << ratio << " (must be > 1)" << std::endl
+		);
+	}
+
+	m_pt_temperature_ratio = ratio;
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the ratio between the temperatures of neighboring chains in parallel tempering mode
+ */
+double GSimulatedAnnealing::getPTTemperatureRatio() const {
+	return m_pt_temperature_ratio;
+}
+
+/******************************************************************************/
+/**
+ * Sets the number of iterations between swap attempts in parallel tempering mode
+ *
+ * @param swapInterval The number of iterations between swap attempts
+ */
+void GSimulatedAnnealing::setPTSwapInterval(std::uint32_t swapInterval) {
+	if (0 == swapInterval) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG,  time_and_place)
+				<< "In GSimulatedAnnealing::setPTSwapInterval(std::uint32_t):" << std::endl
+				<< "Got invalid swap interval 0" << std::endl
+		);
+	}
+
+	m_pt_swap_interval = swapInterval;
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the number of iterations between swap attempts in parallel tempering mode
+ */
+std::uint32_t GSimulatedAnnealing::getPTSwapInterval() const {
+	return m_pt_swap_interval;
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the current temperature of a given chain in parallel tempering mode.
+ * The temperatures are spaced geometrically, starting with the current temperature
+ * of the annealing schedule for the first chain.
+ *
+ * @param chain The position of the chain (i.e. of its parent)
+ * @return The current temperature of the chain
+ */
+double GSimulatedAnnealing::getChainTemperature(std::size_t chain) const {
+	return m_t * std::pow(m_pt_temperature_ratio, static_cast<double>(chain));
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the share of accepted swaps between chains in parallel tempering mode.
+ * Very low rates indicate that the temperature ratio is too large.
+ *
+ * @return The share of accepted swaps, or 0 if no swaps were attempted yet
+ */
+double GSimulatedAnnealing::getPTSwapAcceptanceRate() const {
+	if (0 == m_pt_swaps_attempted) return 0.;
+	return static_cast<double>(m_pt_swaps_accepted) / static_cast<double>(m_pt_swaps_attempted);
+}
+
 /******************************************************************************/
 /**
   * Emits a name for this class / object
@@ -293,6 +425,11 @@ void GSimulatedAnnealing::load_(const GObject *cp) {
 	m_t = p_load->m_t;
 	m_alpha = p_load->m_alpha;
 	m_n_threads = p_load->m_n_threads;
+	m_use_parallel_tempering = p_load->m_use_parallel_tempering;
+	m_pt_temperature_ratio = p_load->m_pt_temperature_ratio;
+	m_pt_swap_interval = p_load->m_pt_swap_interval;
+	m_pt_swaps_attempted = p_load->m_pt_swaps_attempted;
+	m_pt_swaps_accepted = p_load->m_pt_swaps_accepted;
 }
 
 /******************************************************************************/
@@ -330,6 +467,44 @@ void GSimulatedAnnealing::populationSanityChecks_() const {
 				<< "Requested size of population is too small :" << popSize << " " << this->m_n_parents << std::endl
 		);
 	}
+
+	// In parallel tempering mode, each chain needs at least one child
+	if (m_use_parallel_tempering && popSize - this->m_n_parents < this->m_n_parents) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG,  time_and_place)
+				<< "In GSimulatedAnnealing::populationSanityChecks() :" << std::endl
+				<< "In parallel tempering mode we need at least as many children as parents (chains): "
+				<< popSize - this->m_n_parents << " " << this->m_n_parents << std::endl
+		);
+	}
+}
+
+/******************************************************************************/
+/**
+ * Creates children from parents. In parallel tempering mode, children are
+ * assigned to the chains in turn and start from the current state of their
+ * chain. The chain is stored as the parent id of the child. Otherwise the
+ * recombination of the parent class is used.
+ */
+void GSimulatedAnnealing::recombine() {
+	if (not m_use_parallel_tempering) {
+		G_OptimizationAlgorithm_ParChild::recombine();
+		return;
+	}
+
+	std::size_t np = this->getNParents();
+	std::size_t chain = 0;
+	for (auto it = this->begin() + np; it != this->end(); ++it) {
+		(*it)->GObject::load(this->at(chain));
+		(*it)->GParameterSet::template getPersonalityTraits<GBaseParChildPersonalityTraits>()->setParentId(chain);
+		chain = (chain + 1) % np;
+	}
+
+	// Let children know they are children
+	this->markChildren();
+
+	// Tell individuals about their ids
+	this->markIndividualPositions();
 }
 
 /******************************************************************************/
@@ -493,8 +668,9 @@ void GSimulatedAnnealing::fixAfterJobSubmission() {
 		[iteration](std::shared_ptr <GParameterSet> p) { p->setAssignedIteration(iteration); }
 	);
 
-	// Make sure that parents are at the beginning of the array.
-	sort(
+	// Make sure that parents are at the beginning of the array. The sort needs to
+	// be stable, as parents represent chains in parallel tempering mode.
+	std::stable_sort(
 		this->begin()
 		, this->end()
 		, [](std::shared_ptr<GParameterSet> x, std::shared_ptr<GParameterSet> y) -> bool {
@@ -565,8 +741,12 @@ void GSimulatedAnnealing::fixAfterJobSubmission() {
   * Choose new parents, based on the SA selection scheme.
   */
 void GSimulatedAnnealing::selectBest_() {
-	// Sort according to the "Simulated Annealing" scheme
-	sortSAMode();
+	// Sort according to the "Simulated Annealing" or "Parallel Tempering" scheme
+	if (m_use_parallel_tempering) {
+		sortPTMode();
+	} else {
+		sortSAMode();
+	}
 
 	// Let parents know they are parents
 	this->markParents();
@@ -683,6 +863,84 @@ void GSimulatedAnnealing::sortSAMode() {
 	updateTemperature();
 }
 
+/******************************************************************************/
+/**
+ * Performs the selection of parallel tempering. The best child of each chain
+ * replaces the chain's state according to the simulated annealing criterion at
+ * the temperature of the chain. Then neighboring chains attempt to swap their states.
+ * Parents are not sorted, as their position determines their temperature.
+ */
+void GSimulatedAnnealing::sortPTMode() {
+	std::size_t np = this->getNParents();
+
+	// Find the best child of each chain
+	std::vector<std::shared_ptr<GParameterSet>> bestChildren(np);
+	for (auto it = this->begin() + np; it != this->end(); ++it) {
+		auto traits_ptr = (*it)->GParameterSet::template getPersonalityTraits<GBaseParChildPersonalityTraits>();
+		if (not traits_ptr->parentIdSet()) continue;
+
+		std::size_t chain = traits_ptr->getParentId();
+		if (chain >= np) continue;
+
+		if (not bestChildren[chain] || minOnly_transformed_fitness(*it) < minOnly_transformed_fitness(bestChildren[chain])) {
+			bestChildren[chain] = *it;
+		}
+	}
+
+	// Check for each chain whether its state should be replaced by the best child
+	for (std::size_t chain = 0; chain < np; chain++) {
+		if (not bestChildren[chain]) continue; // All children of this chain were lost
+
+		double pPass = saProb(
+			minOnly_transformed_fitness(this->at(chain))
+			, minOnly_transformed_fitness(bestChildren[chain])
+			, this->getChainTemperature(chain)
+		);
+		if (pPass >= 1.) {
+			this->at(chain)->GObject::load(bestChildren[chain]);
+		} else {
+			double challenge =
+				this->m_uniform_real_distribution(this->m_gr, std::uniform_real_distribution<double>::param_type(0.,1.));
+			if (challenge < pPass) {
+				this->at(chain)->GObject::load(bestChildren[chain]);
+			}
+		}
+	}
+
+	// Let neighboring chains exchange their states
+	if (np > 1 && 0 == this->getIteration() % m_pt_swap_interval) {
+		swapChains();
+	}
+
+	// Make sure the temperature gets updated
+	updateTemperature();
+}
+
+/******************************************************************************/
+/**
+ * Attempts to swap the states of neighboring chains. Even and odd pairs of chains
+ * are tried in alternating swap attempts. A swap between chains i and j is accepted
+ * with the probability min(1, exp((1/T_i - 1/T_j)*(f_i - f_j))), so that better
+ * states tend to move towards lower temperatures.
+ */
+void GSimulatedAnnealing::swapChains() {
+	std::size_t np = this->getNParents();
+	std::size_t first = static_cast<std::size_t>((this->getIteration() / m_pt_swap_interval) % 2);
+
+	for (std::size_t chain = first; chain + 1 < np; chain += 2) {
+		double fColder = minOnly_transformed_fitness(this->at(chain));
+		double fHotter = minOnly_transformed_fitness(this->at(chain + 1));
+		double betaDiff = 1. / this->getChainTemperature(chain) - 1. / this->getChainTemperature(chain + 1);
+		double pSwap = std::exp(betaDiff * (fColder - fHotter));
+
+		m_pt_swaps_attempted++;
+		if (pSwap >= 1. || this->m_uniform_real_distribution(this->m_gr, std::uniform_real_distribution<double>::param_type(0.,1.)) < pSwap) {
+			std::swap(this->m_data_cnt[chain], this->m_data_cnt[chain + 1]);
+			m_pt_swaps_accepted++;
+		}
+	}
+}
+
 /******************************************************************************/
 /**
   * Calculates the simulated annealing probability for a child to replace a parent.
@@ -697,7 +955,24 @@ double GSimulatedAnnealing::saProb(
 	const double &fMinOnlyParent
 	, const double &fMinOnlyChild
 ) {
-	return exp(-(fMinOnlyChild - fMinOnlyParent) / m_t);
+	return saProb(fMinOnlyParent, fMinOnlyChild, m_t);
+}
+
+/******************************************************************************/
+/**
+ * Calculates the probability for a child to replace a parent at a given temperature
+ *
+ * @param fMinOnlyParent The "min only" fitness of the parent
+ * @param fMinOnlyChild The "min only" fitness of the child
+ * @param t The temperature
+ * @return A double value, representing the likelihood for the child to replace the parent
+ */
+double GSimulatedAnnealing::saProb(
+	const double &fMinOnlyParent
+	, const double &fMinOnlyChild
+	, const double &t
+) {
+	return exp(-(fMinOnlyChild - fMinOnlyParent) / t);
 }
 
 /******************************************************************************/
@@ -740,6 +1015,60 @@ void GSimulatedAnnealing::specificTestsNoFailureExpected_GUnitTests_() {
 	G_OptimizationAlgorithm_ParChild::specificTestsNoFailureExpected_GUnitTests_();
 
 	//------------------------------------------------------------------------------
+
+	{ // Check that the chain temperatures are spaced geometrically
+		std::shared_ptr<GSimulatedAnnealing> p_test = this->clone<GSimulatedAnnealing>();
+
+		BOOST_CHECK_NO_THROW(p_test->setPTTemperatureRatio(3.));
+		for(std::size_t chain = 0; chain < 5; chain++) {
+			BOOST_CHECK(std::fabs(p_test->getChainTemperature(chain) - p_test->getT() * std::pow(3., double(chain))) <= 1e-9 * p_test->getChainTemperature(chain));
+		}
+	}
+
+	//------------------------------------------------------------------------------
+
+	{ // Check that the parallel tempering mode runs with a serial executor and keeps one state per chain
+		boost::filesystem::path executorConfig("./GSimulatedAnnealing_ptTest_executor.json");
+
+		const std::size_t NCHAINS = 4;
+		const std::size_t NCHILDREN = 12;
+
+		std::shared_ptr<GSimulatedAnnealing> p_test = this->clone<GSimulatedAnnealing>();
+
+		BOOST_CHECK_NO_THROW(p_test->clear());
+		for(std::size_t i = 0; i < NCHAINS + NCHILDREN; i++) {
+			std::shared_ptr<GParameterSet> ind_ptr(new Gem::Tests::GTestIndividual1());
+			ind_ptr->randomInit(activityMode::ALLPARAMETERS);
+			p_test->push_back(ind_ptr);
+		}
+
+		BOOST_CHECK_NO_THROW(p_test->setPopulationSizes(NCHAINS + NCHILDREN, NCHAINS));
+		BOOST_CHECK_NO_THROW(p_test->setUseParallelTempering(true));
+		BOOST_CHECK_NO_THROW(p_test->setT0(10.));
+		BOOST_CHECK_NO_THROW(p_test->setTDegradationStrength(0.9));
+		BOOST_CHECK_NO_THROW(p_test->setPTTemperatureRatio(4.));
+		p_test->setMaxIteration(20);
+		p_test->registerExecutor(
+			std::shared_ptr<Gem::Courtier::GBaseExecutorT<GParameterSet>>(new Gem::Courtier::GSerialExecutorT<GParameterSet>())
+			, executorConfig
+		);
+
+		BOOST_CHECK_NO_THROW(p_test->optimize());
+
+		BOOST_CHECK(p_test->size() == NCHAINS + NCHILDREN);
+		BOOST_CHECK(p_test->getNParents() == NCHAINS);
+		for(std::size_t i = 0; i < p_test->size(); i++) {
+			BOOST_CHECK(p_test->at(i)->is_processed());
+		}
+
+		// Swaps were attempted in every iteration
+		BOOST_CHECK(p_test->m_pt_swaps_attempted > 0);
+		BOOST_CHECK(p_test->m_pt_swaps_accepted <= p_test->m_pt_swaps_attempted);
+		BOOST_CHECK(p_test->getPTSwapAcceptanceRate() >= 0. && p_test->getPTSwapAcceptanceRate() <= 1.);
+
+		boost::filesystem::remove(executorConfig);
+	}
+
 	//------------------------------------------------------------------------------
 
 #else /* GEM_TESTING */ // If this function is called when GEM_TESTING isn't set, throw
@@ -757,6 +1086,14 @@ void GSimulatedAnnealing::specificTestsFailuresExpected_GUnitTests_() {
 	G_OptimizationAlgorithm_ParChild::specificTestsFailuresExpected_GUnitTests_();
 
 	//------------------------------------------------------------------------------
+
+	{ // Check that invalid parallel tempering settings are rejected
+		std::shared_ptr<GSimulatedAnnealing> p_test = this->clone<GSimulatedAnnealing>();
+
+		BOOST_CHECK_THROW(p_test->setPTTemperatureRatio(1.), gemfony_exception);
+		BOOST_CHECK_THROW(p_test->setPTSwapInterval(0), gemfony_exception);
+	}
+
 	//------------------------------------------------------------------------------
 
 #else /* GEM_TESTING */
@@ -87,6 +87,8 @@ GSwarmAlgorithm::GSwarmAlgorithm(const GSwarmAlgorithm &cp)
 	  , m_update_rule(cp.m_update_rule)
 	  , m_random_fill_up(cp.m_random_fill_up)
 	  , m_repulsion_threshold(cp.m_repulsion_threshold)
+	  , m_use_async_updates(cp.m_use_async_updates)
+	  , m_async_batch_size(cp.m_async_batch_size)
 	  , m_dbl_lower_parameter_boundaries_cnt(cp.m_dbl_lower_parameter_boundaries_cnt)
 	  , m_dbl_upper_parameter_boundaries_cnt(cp.m_dbl_upper_parameter_boundaries_cnt)
 	  , m_dbl_vel_max_cnt(cp.m_dbl_vel_max_cnt)
@@ -143,6 +145,8 @@ void GSwarmAlgorithm::load_(const GObject *cp) {
 	m_update_rule = p_load->m_update_rule;
 	m_random_fill_up = p_load->m_random_fill_up;
 	m_repulsion_threshold = p_load->m_repulsion_threshold;
+	m_use_async_updates = p_load->m_use_async_updates;
+	m_async_batch_size = p_load->m_async_batch_size;
 
 	m_dbl_lower_parameter_boundaries_cnt = p_load->m_dbl_lower_parameter_boundaries_cnt;
 	m_dbl_upper_parameter_boundaries_cnt = p_load->m_dbl_upper_parameter_boundaries_cnt;
@@ -251,6 +255,8 @@ void GSwarmAlgorithm::compare_(
 	compare_t(IDENTITY(m_update_rule, p_load->m_update_rule), token);
 	compare_t(IDENTITY(m_random_fill_up, p_load->m_random_fill_up), token);
 	compare_t(IDENTITY(m_repulsion_threshold, p_load->m_repulsion_threshold), token);
+	compare_t(IDENTITY(m_use_async_updates, p_load->m_use_async_updates), token);
+	compare_t(IDENTITY(m_async_batch_size, p_load->m_async_batch_size), token);
 	compare_t(IDENTITY(m_dbl_lower_parameter_boundaries_cnt, p_load->m_dbl_lower_parameter_boundaries_cnt), token);
 	compare_t(IDENTITY(m_dbl_upper_parameter_boundaries_cnt, p_load->m_dbl_upper_parameter_boundaries_cnt), token);
 	compare_t(IDENTITY(m_dbl_vel_max_cnt, p_load->m_dbl_vel_max_cnt), token);
@@ -280,7 +286,9 @@ void GSwarmAlgorithm::resetToOptimizationStart_() {
 	m_global_best_ptr.reset(); // The globally best individual
 
 	m_neighborhood_bests_cnt = std::vector<std::shared_ptr<GParameterSet>>(m_n_neighborhoods); // The collection of best individuals from each neighborhood
-	m_velocities_cnt = std::vector<std::shared_ptr<GParameterSet>>(); // Holds velocities, as calculated in the previous iteration
+	m_velocities_cnt.clear(); // Holds velocities, as calculated in the previous iteration
+	m_dbl_neighborhood_best_values_cnt.clear(); // Holds the parameter values of the neighborhood bests
+	m_dbl_global_best_values_cnt.clear(); // Holds the parameter values of the globally best individual
 
 	m_dbl_lower_parameter_boundaries_cnt.clear(); // Holds lower boundaries of double parameters
 	m_dbl_upper_parameter_boundaries_cnt.clear(); // Holds upper boundaries of double parameters
@@ -587,6 +595,22 @@ void GSwarmAlgorithm::addConfigurationOptions_(
 	)
 		<< "The number of stalls as of which the algorithm switches to repulsive mode" << std::endl
 		<< "Set this to 0 in order to disable this feature";
+
+	gpb.registerFileParameter<bool>(
+		"useAsyncUpdates" // The name of the variable
+		, DEFAULTSWARMASYNCUPDATES // The default value
+		, [this](bool ua) { this->setUseAsyncUpdates(ua); }
+	)
+		<< "Specifies whether particles should be moved and evaluated in batches," << std::endl
+		<< "each using the personal, neighborhood and global bests found by" << std::endl
+		<< "the batches that have already returned in the same iteration";
+
+	gpb.registerFileParameter<std::size_t>(
+		"asyncBatchSize" // The name of the variable
+		, DEFAULTSWARMASYNCBATCHSIZE // The default value
+		, [this](std::size_t bs) { this->setAsyncBatchSize(bs); }
+	)
+		<< "The number of particles submitted together in asynchronous mode";
 }
 
 /******************************************************************************/
@@ -630,13 +654,14 @@ void GSwarmAlgorithm::init() {
 		m_dbl_vel_max_cnt.push_back(l * (m_dbl_upper_parameter_boundaries_cnt[i] - m_dbl_lower_parameter_boundaries_cnt[i]));
 	}
 
-	// Make sure the m_velocities_cnt vector is really empty
-	m_velocities_cnt.clear();
+	// Randomly initialize the velocities. They are stored as one row of parameter values per particle
+	const std::size_t nPars = m_dbl_vel_max_cnt.size();
+	m_velocities_cnt.resize(this->size() * nPars);
 
-	// Create copies of our individuals in the m_velocities_cnt vector.
+#ifdef DEBUG
+	// Check that the number of parameters of each individual equals those in the velocity boundaries
 	std::size_t pos = 0;
 	for(const auto& ind_ptr: *this) {
-#ifdef DEBUG
 		if(not ind_ptr) {
 			throw gemfony_exception(
 				g_error_streamer(DO_LOG,  time_and_place)
@@ -644,46 +669,27 @@ void GSwarmAlgorithm::init() {
 					<< "Found empty std::shared_ptr in position " << pos << std::endl
 			);
 		}
-#endif /* DEBUG */
-
-		// Create a copy of the current individual. Note that, if you happen
-		// to have assigned anything else than a GParameterSet derivative to
-		// the swarm, then the following line will throw in DEBUG mode or return
-		// undefined results in RELEASE mode
-		std::shared_ptr<GParameterSet> p(ind_ptr->clone<GParameterSet>());
 
-		// Extract the parameter vector
-		std::vector<double> velVec;
-		p->streamline(velVec, activityMode::ACTIVEONLY);
-
-#ifdef DEBUG
-		// Check that the number of parameters equals those in the velocity boundaries
-		if(velVec.size() != m_dbl_lower_parameter_boundaries_cnt.size() || velVec.size() != m_dbl_vel_max_cnt.size()) {
+		ind_ptr->streamline(m_dbl_ind_values_cnt, activityMode::ACTIVEONLY);
+		if(m_dbl_ind_values_cnt.size() != nPars) {
 			throw gemfony_exception(
 				g_error_streamer(DO_LOG,  time_and_place)
 					<< "In GSwarmAlgorithm::init(): Error! (2)" << std::endl
-					<< "Found invalid sizes: " << velVec.size()
-					<< " / " << m_dbl_lower_parameter_boundaries_cnt.size() << std::endl
-					<< " / " << m_dbl_vel_max_cnt.size() << std::endl
+					<< "Found invalid sizes: " << m_dbl_ind_values_cnt.size()
+					<< " / " << nPars << std::endl
 			);
 		}
+
+		pos++;
+	}
 #endif /* DEBUG */
 
-		// Randomly initialize the velocities
-		for (std::size_t i = 0; i < velVec.size(); i++) {
+	for (std::size_t p = 0; p < this->size(); p++) {
+		for (std::size_t i = 0; i < nPars; i++) {
 			double range = m_dbl_vel_max_cnt[i];
-			velVec[i] =
+			m_velocities_cnt[p*nPars + i] =
 				G_OptimizationAlgorithm_Base::m_uniform_real_distribution(m_gr, std::uniform_real_distribution<double>::param_type(-range,range));
 		}
-
-		// Load the array into the velocity object
-		p->assignValueVector<double>(velVec, activityMode::ACTIVEONLY);
-		p->mark_as_due_for_processing(); // Catch cases where a value is calculated for the velocity individual
-
-		// Add the initialized velocity to the array.
-		m_velocities_cnt.push_back(p);
-
-		pos++;
 	}
 
 	// Make sure m_neighborhood_bests_cnt has the correct size
@@ -700,9 +706,10 @@ void GSwarmAlgorithm::init() {
  * Does any necessary finalization work
  */
 void GSwarmAlgorithm::finalize() {
-	// Remove remaining velocity individuals. The std::shared_ptr<GParameterSet>s
-	// will take care of deleting the GParameterSet objects.
+	// Remove remaining velocities and cached parameter values
 	m_velocities_cnt.clear();
+	m_dbl_neighborhood_best_values_cnt.clear();
+	m_dbl_global_best_values_cnt.clear();
 
 	// Last action
 	G_OptimizationAlgorithm_Base::finalize();
@@ -737,11 +744,16 @@ void GSwarmAlgorithm::actOnStalls_() {
 std::tuple<double, double> GSwarmAlgorithm::cycleLogic_() {
 	std::tuple<double, double> bestIndividualFitness;
 
-	// First update the positions and neighborhood ids
-	updatePositions();
+	if(m_use_async_updates && afterFirstIteration()) {
+		// Move and evaluate the particles batch by batch
+		runAsyncUpdates();
+	} else {
+		// First update the positions and neighborhood ids
+		updatePositions();
 
-	// Now update each individual's fitness
-	runFitnessCalculation_();
+		// Now update each individual's fitness
+		runFitnessCalculation_();
+	}
 
 	// Search for the personal, neighborhood and globally best individuals and
 	// update the lists of best solutions, if necessary.
@@ -927,6 +939,11 @@ void GSwarmAlgorithm::updatePositions() {
 	}
 #endif /* DEBUG */
 
+	// Extract the parameter values of the neighborhood and global bests once for all particles
+	if (afterFirstIteration()) {
+		updateBestValues();
+	}
+
 	// First update all positions
 	for (std::size_t n = 0; n < m_n_neighborhoods; n++) {
 #ifdef DEBUG
@@ -969,7 +986,7 @@ void GSwarmAlgorithm::updatePositions() {
 				 not (*current)->getPersonalityTraits<GSwarmAlgorithm_PersonalityTraits>()->checkNoPositionUpdateAndReset()) {
 				// Update the swarm positions:
 				updateIndividualPositions(
-					n, (*current), m_neighborhood_bests_cnt[n], m_global_best_ptr, m_velocities_cnt[neighborhood_offset], std::make_tuple(
+					n, (*current), neighborhood_offset, std::make_tuple(
 						getCPersonal(), getCNeighborhood(), getCGlobal(), getCVelocity()
 					)
 				);
@@ -980,24 +997,114 @@ void GSwarmAlgorithm::updatePositions() {
 	}
 }
 
+/******************************************************************************/
+/**
+ * Moves and evaluates the particles in batches of m_async_batch_size. Each batch is
+ * moved using the personal, neighborhood and global bests found by the batches that
+ * have already returned in this iteration, so that improvements propagate through the
+ * swarm without waiting for the slowest evaluation of the iteration. Particles that
+ * did not return or had errors are replaced by their copies from the last iteration.
+ * The population keeps its nominal size, so adjustNeighborhoods() has nothing to repair.
+ */
+void GSwarmAlgorithm::runAsyncUpdates() {
+	auto m = this->at(0)->getMaxMode(); // We assume that the maxMode is the same for all individuals
+
+#ifdef DEBUG
+	if(this->size() != m_n_neighborhoods*m_default_n_neighborhood_members) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG,  time_and_place)
+				<< "In GSwarmAlgorithm::runAsyncUpdates(): Error!" << std::endl
+				<< "The population has an incorrect size of " << this->size() << ", expected " << m_n_neighborhoods*m_default_n_neighborhood_members << std::endl
+		);
+	}
+#endif /* DEBUG */
+
+	// Keep copies of the last iteration's individuals, so we can replace missing returns
+	m_last_iteration_individuals_cnt.clear();
+	for(const auto& ind_ptr: *this) {
+		m_last_iteration_individuals_cnt.push_back(ind_ptr->clone<GParameterSet>());
+	}
+
+	// Update the neighborhood ids
+	for(std::size_t pos = 0; pos < this->size(); pos++) {
+		this->at(pos)->getPersonalityTraits<GSwarmAlgorithm_PersonalityTraits>()->setNeighborhood(pos / m_default_n_neighborhood_members);
+	}
+
+	updateBestValues();
+
+	for(std::size_t first = 0; first < this->size(); first += m_async_batch_size) {
+		std::size_t last = (std::min)(first + m_async_batch_size, this->size());
+
+		// Move the particles of this batch, using the latest bests
+		for(std::size_t pos = first; pos < last; pos++) {
+			std::size_t n = pos / m_default_n_neighborhood_members;
+			if(not this->at(pos)->getPersonalityTraits<GSwarmAlgorithm_PersonalityTraits>()->checkNoPositionUpdateAndReset()) {
+				updateIndividualPositions(
+					n, this->at(pos), pos, std::make_tuple(
+						getCPersonal(), getCNeighborhood(), getCGlobal(), getCVelocity()
+					)
+				);
+			}
+		}
+
+		// Only the current batch is submitted. The executor counts the submissions itself,
+		// so that late arrivals from earlier batches are recognized as old work items.
+		setProcessingFlag(this->m_data_cnt, std::make_tuple(first, last));
+		this->workOn(
+			m_data_cnt
+			, false // do not resubmit unprocessed items
+			, "GSwarmAlgorithm::runAsyncUpdates()"
+			, false // do not use the iteration counter of the algorithm
+		);
+
+		// Late arrivals belong to particles that have since been moved again -- we do not want them
+		this->getOldWorkItems().clear();
+
+		// Propagate the results of this batch to the personal, neighborhood and global bests
+		bool bestsChanged = false;
+		for(std::size_t pos = first; pos < last; pos++) {
+			auto ind_ptr = this->at(pos);
+			if(not ind_ptr->is_processed() || ind_ptr->has_errors()) {
+				ind_ptr->GObject::load(m_last_iteration_individuals_cnt.at(pos));
+				continue;
+			}
+
+			updatePersonalBestIfBetter(ind_ptr);
+
+			std::size_t n = pos / m_default_n_neighborhood_members;
+			if(isBetter(ind_ptr->transformed_fitness(0), m_neighborhood_bests_cnt.at(n)->transformed_fitness(0), m)) {
+				m_neighborhood_bests_cnt.at(n)->GObject::load(ind_ptr);
+				bestsChanged = true;
+			}
+			if(isBetter(ind_ptr->transformed_fitness(0), m_global_best_ptr->transformed_fitness(0), m)) {
+				m_global_best_ptr->GObject::load(ind_ptr);
+				bestsChanged = true;
+			}
+		}
+
+		if(bestsChanged) {
+			updateBestValues();
+		}
+	}
+}
+
 /******************************************************************************/
 /**
  * Update the individual's positions. Note that we use a std::tuple as an argument,
- * so that we do not have to pass too many parameters.
+ * so that we do not have to pass too many parameters. The velocity, the attraction
+ * towards the personal, neighborhood and global bests and the pruning of the velocity
+ * are calculated in a single pass over the parameters, reading the bests from the
+ * values extracted by updateBestValues().
  *
  * @param neighborhood The neighborhood that has been assigned to the individual
  * @param ind The individual whose position should be updated
- * @param neighborhood_best_tmp The best data set of the individual's neighborhood
- * @param global_best_tmp The globally best individual so far
- * @param velocity A velocity vector
+ * @param pos The position of the individual's velocity in m_velocities_cnt
  * @param constants A std::tuple holding the various constants needed for the position update
  */
 void GSwarmAlgorithm::updateIndividualPositions(
 	const std::size_t &neighborhood
 	, std::shared_ptr <GParameterSet> ind
-	, std::shared_ptr <GParameterSet> neighborhood_best
-	, std::shared_ptr <GParameterSet> global_best
-	, std::shared_ptr <GParameterSet> velocity
+	, const std::size_t &pos
 	, std::tuple<double, double, double, double> constants
 ) {
 	// Extract the constants from the tuple
@@ -1020,7 +1127,6 @@ void GSwarmAlgorithm::updateIndividualPositions(
 	// Extract the personal best
 	std::shared_ptr <GParameterSet> personal_best = ind->getPersonalityTraits<GSwarmAlgorithm_PersonalityTraits>()->getPersonalBest();
 
-	// Further error checks
 #ifdef DEBUG
 	if(not personal_best) {
 		throw gemfony_exception(
@@ -1029,155 +1135,140 @@ void GSwarmAlgorithm::updateIndividualPositions(
 				<< "Found empty individual \"personal_best\"" << std::endl
 		);
 	}
+#endif /* DEBUG */
 
-	if(not neighborhood_best) {
-		throw gemfony_exception(
-			g_error_streamer(DO_LOG,  time_and_place)
-				<< "In GSwarmAlgorithm::updateIndividualPositions():" << std::endl
-				<< "Found empty individual \"neighborhood_best\"" << std::endl
-		);
-	}
+	// Extract the vectors for the individual and the personal best
+	ind->streamline(m_dbl_ind_values_cnt, activityMode::ACTIVEONLY);
+	personal_best->streamline(m_dbl_personal_best_values_cnt, activityMode::ACTIVEONLY);
 
-	if(not global_best) {
-		throw gemfony_exception(
-			g_error_streamer(DO_LOG,  time_and_place)
-				<< "In GSwarmAlgorithm::updateIndividualPositions():" << std::endl
-				<< "Found empty individual \"global_best\"" << std::endl
-		);
-	}
+	const std::size_t nPars = m_dbl_vel_max_cnt.size();
 
-	if(not velocity) {
+#ifdef DEBUG
+	if(
+		m_dbl_ind_values_cnt.size() != nPars
+		|| m_dbl_personal_best_values_cnt.size() != nPars
+		|| m_dbl_neighborhood_best_values_cnt.size() < (neighborhood + 1)*nPars
+		|| m_dbl_global_best_values_cnt.size() != nPars
+		|| m_velocities_cnt.size() < (pos + 1)*nPars
+	) {
 		throw gemfony_exception(
 			g_error_streamer(DO_LOG,  time_and_place)
-				<< "In GSwarmAlgorithm::updateIndividualPositions():" << std::endl
-				<< "Found empty individual \"velocity\"" << std::endl
+				<< "In GSwarmAlgorithm::updateIndividualPositions(): Error!" << std::endl
+				<< "Found invalid vector sizes: " << m_dbl_ind_values_cnt.size() << " / " << m_dbl_personal_best_values_cnt.size()
+				<< " / " << m_dbl_neighborhood_best_values_cnt.size() << " / " << m_dbl_global_best_values_cnt.size()
+				<< " / " << m_velocities_cnt.size() << " for " << nPars << " parameters" << std::endl
 		);
 	}
-
 #endif /* DEBUG */
 
-	// Extract the vectors for the individual, the personal, neighborhood and global bests,
-	// as well as the velocity
-	std::vector<double> indVec, personalBestVec, nbhBestVec, glbBestVec, velVec;
-	ind->streamline(indVec, activityMode::ACTIVEONLY);
-	personal_best->streamline(personalBestVec, activityMode::ACTIVEONLY);
-	neighborhood_best->streamline(nbhBestVec, activityMode::ACTIVEONLY);
-	global_best->streamline(glbBestVec, activityMode::ACTIVEONLY);
-	velocity->streamline(velVec, activityMode::ACTIVEONLY);
-
-	// Subtract the individual vector from the personal, neighborhood and global bests
-	Gem::Common::subtractVec<double>(personalBestVec, indVec);
-	Gem::Common::subtractVec<double>(nbhBestVec, indVec);
-	Gem::Common::subtractVec<double>(glbBestVec, indVec);
-
-	switch (m_update_rule) {
-		case updateRule::SWARM_UPDATERULE_CLASSIC:
-			// Multiply each floating point value with a random fp number in the range [0,1[, times a constant
-			for (std::size_t i = 0; i < personalBestVec.size(); i++) {
-				personalBestVec[i] *= (cPersonal * G_OptimizationAlgorithm_Base::m_uniform_real_distribution(m_gr, std::uniform_real_distribution<double>::param_type(0.,1.)));
-				nbhBestVec[i] *= (cNeighborhood * G_OptimizationAlgorithm_Base::m_uniform_real_distribution(m_gr, std::uniform_real_distribution<double>::param_type(0.,1.)));
-				glbBestVec[i] *= (cGlobal * G_OptimizationAlgorithm_Base::m_uniform_real_distribution(m_gr, std::uniform_real_distribution<double>::param_type(0.,1.)));
-			}
-			break;
-
-		case updateRule::SWARM_UPDATERULE_LINEAR:
-			// Multiply each position with the same random floating point number times a constant
-			Gem::Common::multVecConst<double>(personalBestVec, cPersonal * G_OptimizationAlgorithm_Base::m_uniform_real_distribution(m_gr, std::uniform_real_distribution<double>::param_type(0.,1.)));
-			Gem::Common::multVecConst<double>(nbhBestVec, cNeighborhood * G_OptimizationAlgorithm_Base::m_uniform_real_distribution(m_gr, std::uniform_real_distribution<double>::param_type(0.,1.)));
-			Gem::Common::multVecConst<double>(glbBestVec, cGlobal * G_OptimizationAlgorithm_Base::m_uniform_real_distribution(m_gr, std::uniform_real_distribution<double>::param_type(0.,1.)));
-			break;
-	}
-
-	// Scale the velocity
-	Gem::Common::multVecConst<double>(velVec, cVelocity);
-
-	// Add the personal and neighborhood parameters to the velocity
-	Gem::Common::addVec<double>(velVec, personalBestVec);
-	Gem::Common::addVec<double>(velVec, nbhBestVec);
+	double *indVec = m_dbl_ind_values_cnt.data();
+	const double *personalBestVec = m_dbl_personal_best_values_cnt.data();
+	const double *nbhBestVec = m_dbl_neighborhood_best_values_cnt.data() + neighborhood*nPars;
+	const double *glbBestVec = m_dbl_global_best_values_cnt.data();
+	double *velVec = m_velocities_cnt.data() + pos*nPars;
 
 	// Adding a velocity component towards the global best only
 	// makes sense if there is more than one neighborhood
-	if (getNNeighborhoods() > 1) {
-		Gem::Common::addVec<double>(velVec, glbBestVec);
+	const double useGlobal = (getNNeighborhoods() > 1) ? 1. : 0.;
+
+	// The linear update rule multiplies all positions with the same random number
+	double fPersonal = 0., fNeighborhood = 0., fGlobal = 0.;
+	if (updateRule::SWARM_UPDATERULE_LINEAR == m_update_rule) {
+		fPersonal = cPersonal * G_OptimizationAlgorithm_Base::m_uniform_real_distribution(m_gr, std::uniform_real_distribution<double>::param_type(0.,1.));
+		fNeighborhood = cNeighborhood * G_OptimizationAlgorithm_Base::m_uniform_real_distribution(m_gr, std::uniform_real_distribution<double>::param_type(0.,1.));
+		fGlobal = cGlobal * G_OptimizationAlgorithm_Base::m_uniform_real_distribution(m_gr, std::uniform_real_distribution<double>::param_type(0.,1.));
 	}
 
-	// Prune the velocity vector so that we can
-	// be sure it is inside of the allowed range
-	pruneVelocity(velVec);
+	// Calculate the new velocity and find the parameter that exceeds the allowed range by the largest percentage
+	double maxPercentage = 1.;
+	for (std::size_t i = 0; i < nPars; i++) {
+		if (updateRule::SWARM_UPDATERULE_CLASSIC == m_update_rule) {
+			// Multiply each floating point value with a random fp number in the range [0,1[, times a constant
+			fPersonal = cPersonal * G_OptimizationAlgorithm_Base::m_uniform_real_distribution(m_gr, std::uniform_real_distribution<double>::param_type(0.,1.));
+			fNeighborhood = cNeighborhood * G_OptimizationAlgorithm_Base::m_uniform_real_distribution(m_gr, std::uniform_real_distribution<double>::param_type(0.,1.));
+			fGlobal = cGlobal * G_OptimizationAlgorithm_Base::m_uniform_real_distribution(m_gr, std::uniform_real_distribution<double>::param_type(0.,1.));
+		}
+
+		velVec[i] =
+			cVelocity * velVec[i]
+			+ fPersonal * (personalBestVec[i] - indVec[i])
+			+ fNeighborhood * (nbhBestVec[i] - indVec[i])
+			+ useGlobal * fGlobal * (glbBestVec[i] - indVec[i]);
+
+#ifdef DEBUG
+		if(m_dbl_vel_max_cnt[i] <= 0.) {
+			throw gemfony_exception(
+				g_error_streamer(DO_LOG,  time_and_place)
+					<< "In GSwarmAlgorithm::updateIndividualPositions(): Error!" << std::endl
+					<< "Found invalid max value: " << m_dbl_vel_max_cnt[i] << std::endl
+			);
+		}
+#endif /* DEBUG */
+
+		double currentPercentage = Gem::Common::gfabs(velVec[i]) / m_dbl_vel_max_cnt[i];
+		if (currentPercentage > maxPercentage) {
+			maxPercentage = currentPercentage;
+		}
+	}
 
 	// Add or subtract the velocity parameters to the individual's parameters, depending on
 	// the number of stalls and the value of the m_repulsion_threshold variable. This allows
 	// the algorithm to escape local optima, if m_repulsion_threshold is > 0.
-	if (0 < m_repulsion_threshold && this->getStallCounter() >= m_repulsion_threshold) {
-		Gem::Common::subtractVec<double>(indVec, velVec); // repulsion -- walk away from best known individuals
-	} else {
-		Gem::Common::addVec<double>(indVec, velVec); // attraction - walk towards best known individuals
+	const double direction = (0 < m_repulsion_threshold && this->getStallCounter() >= m_repulsion_threshold)
+		? -1. // repulsion -- walk away from best known individuals
+		: 1.; // attraction - walk towards best known individuals
+
+	// Scale the velocity back into the allowed range (maxPercentage is 1 if no parameter
+	// exceeded it) and move the individual
+	for (std::size_t i = 0; i < nPars; i++) {
+		velVec[i] /= maxPercentage;
+		indVec[i] += direction * velVec[i];
 	}
 
-	// Update the velocity individual
-	velocity->assignValueVector<double>(velVec, activityMode::ACTIVEONLY);
-
 	// Update the candidate solution
-	ind->assignValueVector<double>(indVec, activityMode::ACTIVEONLY);
+	ind->assignValueVector<double>(m_dbl_ind_values_cnt, activityMode::ACTIVEONLY);
 }
 
 /******************************************************************************/
 /**
- * Adjusts the velocity vector so that its parameters don't exceed the allowed value range.
- *
- * @param velVec the velocity vector to be adjusted
+ * Extracts the parameter values of the neighborhood and global bests, so that
+ * updateIndividualPositions() does not need to extract them for every particle.
+ * This needs to be called whenever one of the bests has changed.
  */
-void GSwarmAlgorithm::pruneVelocity(std::vector<double> &velVec) {
-#ifdef DEBUG
-	if(velVec.size() != m_dbl_vel_max_cnt.size()) {
-		throw gemfony_exception(
-			g_error_streamer(DO_LOG,  time_and_place)
-				<< "In GSwarmAlgorithm::pruneVelocity(): Error!" << std::endl
-				<< "Found invalid vector sizes: " << velVec.size() << " / " << m_dbl_vel_max_cnt.size() << std::endl
-		);
-	}
+void GSwarmAlgorithm::updateBestValues() {
+	const std::size_t nPars = m_dbl_vel_max_cnt.size();
 
-#endif
-
-	// Find the parameter that exceeds the allowed range by the largest percentage
-	double currentPercentage = 0.;
-	double maxPercentage = 0.;
-	bool overflowFound = false;
-	for (std::size_t i = 0; i < velVec.size(); i++) {
+	m_dbl_neighborhood_best_values_cnt.resize(m_n_neighborhoods * nPars);
+	for (std::size_t n = 0; n < m_n_neighborhoods; n++) {
 #ifdef DEBUG
-		if(m_dbl_vel_max_cnt[i] <= 0.) {
+		if(not m_neighborhood_bests_cnt.at(n)) {
 			throw gemfony_exception(
 				g_error_streamer(DO_LOG,  time_and_place)
-					<< "In GSwarmAlgorithm::pruneVelocity(): Error!" << std::endl
-					<< "Found invalid max value: " << m_dbl_vel_max_cnt[i] << std::endl
+					<< "In GSwarmAlgorithm::updateBestValues():" << std::endl
+					<< "m_neighborhood_bests_cnt[" << n << "] is empty." << std::endl
 			);
 		}
 #endif /* DEBUG */
 
-		if (Gem::Common::gfabs(velVec[i]) > m_dbl_vel_max_cnt[i]) {
-			overflowFound = true;
-			currentPercentage = Gem::Common::gfabs(velVec[i]) / m_dbl_vel_max_cnt[i];
-			if (currentPercentage > maxPercentage) {
-				maxPercentage = currentPercentage;
-			}
-		}
+		m_neighborhood_bests_cnt[n]->streamline(m_dbl_personal_best_values_cnt, activityMode::ACTIVEONLY);
+		std::copy(
+			m_dbl_personal_best_values_cnt.begin()
+			, m_dbl_personal_best_values_cnt.end()
+			, m_dbl_neighborhood_best_values_cnt.begin() + n*nPars
+		);
 	}
 
-	if (overflowFound) {
-		// Scale all velocity entries by maxPercentage
-		for (std::size_t i = 0; i < velVec.size(); i++) {
 #ifdef DEBUG
-			if(maxPercentage <= 0.) {
-				throw gemfony_exception(
-					g_error_streamer(DO_LOG,  time_and_place)
-						<< "In GSwarmAlgorithm::pruneVelocity(): Error!" << std::endl
-						<< "Invalid maxPercentage: " << maxPercentage << std::endl
-				);
-			}
-#endif
-			velVec[i] /= maxPercentage;
-		}
+	if(not m_global_best_ptr) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG,  time_and_place)
+				<< "In GSwarmAlgorithm::updateBestValues():" << std::endl
+				<< "m_global_best_ptr is empty." << std::endl
+		);
 	}
+#endif /* DEBUG */
+
+	m_global_best_ptr->streamline(m_dbl_global_best_values_cnt, activityMode::ACTIVEONLY);
 }
 
 /******************************************************************************/
@@ -1703,6 +1794,56 @@ std::uint32_t GSwarmAlgorithm::getRepulsionThreshold() const {
 	return m_repulsion_threshold;
 }
 
+/******************************************************************************/
+/**
+ * Allows to switch asynchronous position updates on or off. In asynchronous mode,
+ * particles are moved and evaluated in batches, each batch using the bests found
+ * by the batches that have already returned.
+ *
+ * @param useAsyncUpdates Indicates whether asynchronous position updates should be used
+ */
+void GSwarmAlgorithm::setUseAsyncUpdates(bool useAsyncUpdates) {
+	m_use_async_updates = useAsyncUpdates;
+}
+
+/******************************************************************************/
+/**
+ * Checks whether asynchronous position updates are used
+ *
+ * @return A boolean indicating whether asynchronous position updates are used
+ */
+bool GSwarmAlgorithm::getUseAsyncUpdates() const {
+	return m_use_async_updates;
+}
+
+/******************************************************************************/
+/**
+ * Sets the number of particles evaluated together in asynchronous mode
+ *
+ * @param asyncBatchSize The number of particles in each batch
+ */
+void GSwarmAlgorithm::setAsyncBatchSize(std::size_t asyncBatchSize) {
+	if(0 == asyncBatchSize) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG,  time_and_place)
+				<< "In GSwarmAlgorithm::setAsyncBatchSize(): Error!" << std::endl
+				<< "The batch size must be at least 1" << std::endl
+		);
+	}
+
+	m_async_batch_size = asyncBatchSize;
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the number of particles evaluated together in asynchronous mode
+ *
+ * @return The number of particles in each batch
+ */
+std::size_t GSwarmAlgorithm::getAsyncBatchSize() const {
+	return m_async_batch_size;
+}
+
 /******************************************************************************/
 /**
  * All individuals automatically added to a neighborhood will have equal value
@@ -1769,6 +1910,43 @@ void GSwarmAlgorithm::specificTestsNoFailureExpected_GUnitTests_() {
 	// Call the parent class'es function
 	G_OptimizationAlgorithm_Base::specificTestsNoFailureExpected_GUnitTests_();
 
+	//------------------------------------------------------------------------------
+
+	{ // Check the asynchronous update mode
+		std::shared_ptr<GSwarmAlgorithm> p_test = this->clone<GSwarmAlgorithm>();
+		boost::filesystem::path executorConfig("./GSwarmAlgorithm_asyncTest_executor.json");
+
+		BOOST_CHECK_NO_THROW(p_test->clear());
+		for (std::size_t i = 0; i < 20; i++) {
+			std::shared_ptr<GParameterSet> ind_ptr(new Gem::Tests::GTestIndividual1());
+			ind_ptr->randomInit(activityMode::ALLPARAMETERS);
+			p_test->push_back(ind_ptr);
+		}
+
+		p_test->setSwarmSizes(4, 5);
+		p_test->setUseAsyncUpdates(true);
+		BOOST_CHECK_NO_THROW(p_test->setAsyncBatchSize(3));
+		BOOST_CHECK(p_test->getUseAsyncUpdates());
+		BOOST_CHECK(p_test->getAsyncBatchSize() == 3);
+		p_test->setMaxIteration(10);
+		p_test->registerExecutor(
+			std::shared_ptr<Gem::Courtier::GBaseExecutorT<GParameterSet>>(new Gem::Courtier::GSerialExecutorT<GParameterSet>())
+			, executorConfig
+		);
+
+		BOOST_CHECK_NO_THROW(p_test->optimize());
+
+		// The swarm must keep its nominal size, and all particles must have been processed
+		BOOST_CHECK(p_test->size() == 20);
+		for (std::size_t i = 0; i < p_test->size(); i++) {
+			BOOST_CHECK(p_test->at(i)->is_processed());
+		}
+
+		boost::filesystem::remove(executorConfig);
+	}
+
+	//------------------------------------------------------------------------------
+
 #else /* GEM_TESTING */ // If this function is called when GEM_TESTING isn't set, throw
 	Gem::Common::condnotset("GSwarmAlgorithm::specificTestsNoFailureExpected_GUnitTests", "GEM_TESTING");
 #endif /* GEM_TESTING */
@@ -486,6 +486,12 @@ Go2 const * const Go2::optimize_(std::uint32_t) {
 	// Loop over all algorithms
 	m_sorted = false;
 	for (const auto& alg_ptr: m_algorithms_cnt) {
+		// Run concurrent copies of the algorithm, if requested
+		if(m_n_islands > 1) {
+			this->optimizeIslands_(alg_ptr);
+			continue;
+		}
+
 		// Add the pluggable optimization monitors to the algorithm
 		for(auto const & pm_ptr: m_pluggable_monitors_cnt) {
 			alg_ptr->registerPluggableOM(pm_ptr);
@@ -535,6 +541,182 @@ Go2 const * const Go2::optimize_(std::uint32_t) {
 	return this;
 }
 
+/******************************************************************************/
+/**
+ * Runs m_n_islands copies of an algorithm concurrently, each in its own thread
+ * and with its own executor. Brokered executors thus each enrol their own buffer
+ * port with the shared broker. The start population is distributed over the
+ * islands, which fill it up to the algorithm's population size as usual. Every
+ * m_migration_interval iterations the best individuals of each island migrate
+ * according to m_migration_topology. Islands do not wait for each other.
+ * Afterwards the (best) individuals of all islands are stored in this object.
+ *
+ * @param alg_ptr The algorithm to be run on each island
+ */
+void Go2::optimizeIslands_(std::shared_ptr<GOABase> alg_ptr) {
+	// Collect the individuals registered with the algorithm or with this object
+	std::vector<std::shared_ptr<GParameterSet>> startPopulation;
+	for (const auto& ind_ptr: *alg_ptr) {
+		startPopulation.push_back(ind_ptr);
+	}
+	for (const auto& ind_ptr: *this) {
+		startPopulation.push_back(ind_ptr);
+	}
+	alg_ptr->clear();
+	this->clear();
+
+	if(startPopulation.empty()) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG,  time_and_place)
+				<< "In Go2::optimizeIslands_(): Error!" << std::endl
+				<< "No individuals available for the islands" << std::endl
+		);
+	}
+
+	// Create the islands and distribute the start population
+	std::vector<std::shared_ptr<GOABase>> islands_cnt;
+	for(std::size_t i=0; i<m_n_islands; i++) {
+		islands_cnt.push_back(alg_ptr->clone<GOABase>());
+	}
+
+	for(std::size_t pos=0; pos<startPopulation.size(); pos++) {
+		islands_cnt.at(pos % m_n_islands)->push_back(startPopulation.at(pos));
+	}
+
+	m_island_mailboxes_cnt.clear();
+	m_island_mailboxes_cnt.resize(m_n_islands);
+
+	for(std::size_t i=0; i<m_n_islands; i++) {
+		auto& island_ptr = islands_cnt.at(i);
+
+		// Islands without individuals start from a copy of the first one
+		// which will be randomly initialized when the population is filled up
+		if(island_ptr->empty()) {
+			island_ptr->push_back(startPopulation.front()->clone<GParameterSet>());
+		}
+
+		// Pluggable optimization monitors are not thread-safe, so only the first island is monitored
+		if(0 == i) {
+			for(auto const & pm_ptr: m_pluggable_monitors_cnt) {
+				island_ptr->registerPluggableOM(pm_ptr);
+			}
+		}
+
+		island_ptr->registerMigrationHook(
+			[this, i](GOABase& island) { this->migrate_(i, island); }
+		);
+	}
+
+	// Run all islands concurrently. Exceptions are passed on once all islands have terminated
+	std::vector<std::exception_ptr> exceptions_cnt(m_n_islands);
+	Gem::Common::GThreadGroup tg;
+	for(std::size_t i=0; i<m_n_islands; i++) {
+		std::shared_ptr<GOABase> island_ptr = islands_cnt.at(i);
+		std::uint32_t offset = m_iterations_consumed;
+		tg.create_thread(
+			[island_ptr, offset, i, &exceptions_cnt]() {
+				try {
+					island_ptr->optimize(offset);
+				} catch(...) {
+					exceptions_cnt.at(i) = std::current_exception();
+				}
+			}
+		);
+	}
+	tg.join_all();
+
+	for(auto const & e_ptr: exceptions_cnt) {
+		if(e_ptr) std::rethrow_exception(e_ptr);
+	}
+
+	// Unload the individuals from all islands and store them in this object
+	std::uint32_t lastIteration = m_iterations_consumed;
+	for(auto const & island_ptr: islands_cnt) {
+		lastIteration = (std::max)(lastIteration, island_ptr->getIteration());
+
+		if(m_copyBestIndividualsOnly) {
+			for (const auto &best_ind_ptr: island_ptr->getBestGlobalIndividuals<GParameterSet>()) {
+				this->push_back(best_ind_ptr);
+			}
+		} else { // copy all individuals
+			for (const auto &ind_ptr: *island_ptr) {
+				this->push_back(ind_ptr);
+			}
+		}
+
+		island_ptr->clear();
+		island_ptr->resetPluggableOM();
+		island_ptr->resetMigrationHook();
+	}
+
+	// Make sure we start with the correct iteration in the next algorithm
+	m_iterations_consumed = lastIteration;
+	m_island_mailboxes_cnt.clear();
+}
+
+/******************************************************************************/
+/**
+ * Called by each island at the end of every iteration. Every m_migration_interval
+ * iterations copies of the island's best individuals are sent to its neighbours,
+ * and individuals received from other islands are offered to the island. Islands
+ * lagging behind only keep the most recent immigrants.
+ *
+ * @param island The id of the calling island
+ * @param island_alg The algorithm running on the calling island
+ */
+void Go2::migrate_(std::size_t island, GOABase & island_alg) {
+	std::uint32_t nIterations = island_alg.getIteration() - m_iterations_consumed;
+	if(0 == m_migration_interval || 0 == nIterations || 0 != nIterations % m_migration_interval) {
+		return;
+	}
+
+	// Determine the destinations of our emigrants
+	std::vector<std::size_t> destinations;
+	switch(m_migration_topology) {
+		case migrationTopology::MIGRATION_RING:
+			destinations.push_back((island + 1) % m_n_islands);
+			break;
+
+		case migrationTopology::MIGRATION_FULL:
+			for(std::size_t i=0; i<m_n_islands; i++) {
+				if(i != island) destinations.push_back(i);
+			}
+			break;
+
+		case migrationTopology::MIGRATION_RANDOM:
+		{
+			Gem::Hap::GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMPROXY> gr;
+			std::uniform_int_distribution<std::size_t> uniform_int(0, m_n_islands - 2);
+			std::size_t destination = uniform_int(gr);
+			if(destination >= island) destination++; // Skip the sending island
+			destinations.push_back(destination);
+		}
+			break;
+	}
+
+	std::vector<std::shared_ptr<GParameterSet>> emigrants = island_alg.getEmigrants(m_n_migrants);
+	std::vector<std::shared_ptr<GParameterSet>> immigrants;
+
+	{ // Access to the mailboxes needs to be synchronized
+		std::unique_lock<std::mutex> mailbox_lock(m_island_mailboxes_mutex);
+
+		for(auto const & destination: destinations) {
+			auto& mailbox = m_island_mailboxes_cnt.at(destination);
+			mailbox.insert(mailbox.end(), emigrants.begin(), emigrants.end());
+
+			std::size_t maxMailboxSize = m_n_migrants * (m_n_islands - 1);
+			if(mailbox.size() > maxMailboxSize) {
+				mailbox.erase(mailbox.begin(), mailbox.end() - maxMailboxSize);
+			}
+		}
+
+		immigrants.swap(m_island_mailboxes_cnt.at(island));
+	}
+
+	// Immigrants are copied into the population, so they may be shared between islands
+	island_alg.integrateImmigrants(immigrants);
+}
+
 /******************************************************************************/
 /**
  * Retrieves the best individual found. This function returns a base pointer.
@@ -674,6 +856,119 @@ void Go2::addConfigurationOptions(
 	)
 		<< "Indicates whether only the best individuals should be copied when" << std::endl
 		<< "switching from one optimization algorithm to the next";
+
+	gpb.registerFileParameter<std::size_t>(
+		"nIslands"
+		, GO2_DEF_NISLANDS
+		, [this](std::size_t nIslands) { this->setNIslands(nIslands); }
+	)
+		<< "The number of copies of each algorithm running concurrently" << std::endl
+		<< "on parts of the population. 1 disables the island mode";
+
+	gpb.registerFileParameter<std::uint32_t>(
+		"migrationInterval"
+		, GO2_DEF_MIGRATIONINTERVAL
+		, [this](std::uint32_t migrationInterval) { this->setMigrationInterval(migrationInterval); }
+	)
+		<< "The number of iterations between two migrations of individuals" << std::endl
+		<< "between islands. 0 disables migration";
+
+	gpb.registerFileParameter<std::size_t>(
+		"nMigrants"
+		, GO2_DEF_NMIGRANTS
+		, [this](std::size_t nMigrants) { this->setNMigrants(nMigrants); }
+	)
+		<< "The number of best individuals sent by an island in each migration";
+
+	gpb.registerFileParameter<migrationTopology>(
+		"migrationTopology"
+		, GO2_DEF_MIGRATIONTOPOLOGY
+		, [this](migrationTopology mt) { this->setMigrationTopology(mt); }
+	)
+		<< "The paths along which individuals migrate:" << std::endl
+		<< "0: ring -- to the next island" << std::endl
+		<< "1: fully connected -- to all other islands" << std::endl
+		<< "2: random -- to a randomly chosen island";
+}
+
+/******************************************************************************/
+/**
+ * Sets the number of concurrently running copies of each algorithm
+ *
+ * @param nIslands The number of islands; 1 disables the island mode
+ */
+void Go2::setNIslands(std::size_t nIslands) {
+	if(0 == nIslands) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG,  time_and_place)
+				<< "In Go2::setNIslands(): Error!" << std::endl
+				<< "The number of islands must be at least 1" << std::endl
+		);
+	}
+
+	m_n_islands = nIslands;
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the number of concurrently running copies of each algorithm
+ */
+std::size_t Go2::getNIslands() const {
+	return m_n_islands;
+}
+
+/******************************************************************************/
+/**
+ * Sets the number of iterations between two migrations
+ *
+ * @param migrationInterval The number of iterations between two migrations; 0 disables migration
+ */
+void Go2::setMigrationInterval(std::uint32_t migrationInterval) {
+	m_migration_interval = migrationInterval;
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the number of iterations between two migrations
+ */
+std::uint32_t Go2::getMigrationInterval() const {
+	return m_migration_interval;
+}
+
+/******************************************************************************/
+/**
+ * Sets the number of individuals sent by an island in each migration
+ *
+ * @param nMigrants The number of individuals sent by an island in each migration
+ */
+void Go2::setNMigrants(std::size_t nMigrants) {
+	m_n_migrants = nMigrants;
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the number of individuals sent by an island in each migration
+ */
+std::size_t Go2::getNMigrants() const {
+	return m_n_migrants;
+}
+
+/******************************************************************************/
+/**
+ * Sets the topology along which individuals migrate
+ *
+ * @param mt The topology along which individuals migrate
+ */
+void Go2::setMigrationTopology(migrationTopology mt) {
+	m_migration_topology = mt;
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the topology along which individuals migrate
+ */
+migrationTopology Go2::getMigrationTopology() const {
+	return m_migration_topology;
 }
 
 /******************************************************************************/
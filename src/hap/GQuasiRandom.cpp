@@ -0,0 +1,283 @@
+/********************************************************************************
+ *
+ * This file is part of the Geneva library collection. The following license
+ * applies to this file:
+ *
+ * ------------------------------------------------------------------------------
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * ------------------------------------------------------------------------------
+ *
+ * Note that other files in the Geneva library collection may use a different
+ * license. Please see the licensing information in each file.
+ *
+ ********************************************************************************
+ *
+ * Geneva was started by Dr. Rüdiger Berlich and was later maintained together
+ * with Dr. Ariel Garcia under the auspices of Gemfony scientific. For further
+ * information on Gemfony scientific, see http://www.gemfomy.eu .
+ *
+ * The majority of files in Geneva was released under the Apache license v2.0
+ * in February 2020.
+ *
+ * See the NOTICE file in the top-level directory of the Geneva library
+ * collection for a list of contributors and copyright information.
+ *
+ ********************************************************************************/
+
+#include "hap/GQuasiRandom.hpp"
+
+namespace Gem {
+namespace Hap {
+
+/******************************************************************************/
+/**
+ * Direction number data of Joe and Kuo for dimensions 2 to MAXSOBOLDIMENSIONS
+ * (file "new-joe-kuo-6.21201"). Each entry holds the degree s of the primitive
+ * polynomial, its coefficients a and the s initial direction numbers m_i.
+ * Unused initial direction numbers are 0. The first dimension is special-cased.
+ */
+namespace {
+
+struct sobolInitData {
+	std::uint32_t s;
+	std::uint32_t a;
+	std::uint32_t m[7];
+};
+
+const sobolInitData SOBOLINITDATA[MAXSOBOLDIMENSIONS - 1] = {
+	{1,  0, {1}}
+	, {2,  1, {1, 3}}
+	, {3,  1, {1, 3, 1}}
+	, {3,  2, {1, 1, 1}}
+	, {4,  1, {1, 1, 3, 3}}
+	, {4,  4, {1, 3, 5, 13}}
+	, {5,  2, {1, 1, 5, 5, 17}}
+	, {5,  4, {1, 1, 5, 5, 5}}
+	, {5,  7, {1, 1, 7, 11, 19}}
+	, {5, 11, {1, 1, 5, 1, 1}}
+	, {5, 13, {1, 1, 1, 3, 11}}
+	, {5, 14, {1, 3, 5, 5, 31}}
+	, {6,  1, {1, 3, 3, 9, 7, 49}}
+	, {6, 13, {1, 1, 1, 15, 21, 21}}
+	, {6, 16, {1, 3, 1, 13, 27, 49}}
+	, {6, 19, {1, 1, 1, 15, 7, 5}}
+	, {6, 22, {1, 3, 1, 15, 13, 25}}
+	, {6, 25, {1, 1, 5, 5, 19, 61}}
+	, {7,  1, {1, 3, 7, 11, 23, 15, 103}}
+	, {7,  4, {1, 3, 7, 13, 13, 15, 69}}
+};
+
+} /* anonymous namespace */
+
+/******************************************************************************/
+////////////////////////////////////////////////////////////////////////////////
+/******************************************************************************/
+/**
+ * Initialization with the number of dimensions. The n-th prime number is used
+ * as the base of dimension n.
+ *
+ * @param nDimensions The number of dimensions of the sequence
+ * @param scramble Indicates whether the digits should be randomly permuted
+ * @param seed The seed used to create the digit permutations
+ */
+GHaltonSequence::GHaltonSequence(
+	std::size_t nDimensions
+	, bool scramble
+	, seed_type seed
+) {
+	if (0 == nDimensions) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG, time_and_place)
+				<< "In GHaltonSequence::GHaltonSequence(): Error!" << std::endl
+				<< "Got invalid number of dimensions 0" << std::endl
+		);
+	}
+
+	// Find the first nDimensions prime numbers
+	std::uint64_t candidate = 2;
+	while (m_bases.size() < nDimensions) {
+		bool isPrime = true;
+		for (auto base: m_bases) {
+			if (base * base > candidate) break;
+			if (0 == candidate % base) {
+				isPrime = false;
+				break;
+			}
+		}
+		if (isPrime) m_bases.push_back(candidate);
+		++candidate;
+	}
+
+	// Set up the digit permutations. The digit 0 always maps onto itself, so
+	// that the (infinitely many) leading zeros of an index do not contribute.
+	mersenne_twister mt(seed);
+	for (auto base: m_bases) {
+		std::vector<std::uint64_t> permutation(base);
+		for (std::uint64_t d = 0; d < base; d++) permutation.at(d) = d;
+		if (scramble) std::shuffle(permutation.begin() + 1, permutation.end(), mt);
+		m_permutations.push_back(permutation);
+	}
+}
+
+/******************************************************************************/
+/**
+ * Retrieves coordinate dim of the point with the given index, i.e. the
+ * (possibly scrambled) radical inverse of the index in the base of this dimension.
+ * Index 0 maps onto the origin.
+ *
+ * @param index The index of the point
+ * @param dim The dimension of the coordinate
+ * @return The coordinate in the range [0,1)
+ */
+double GHaltonSequence::value(std::uint64_t index, std::size_t dim) const {
+	std::uint64_t base = this->getBase(dim);
+	const std::vector<std::uint64_t>& permutation = m_permutations[dim];
+
+	double factor = 1. / static_cast<double>(base);
+	double result = 0.;
+	while (index > 0) {
+		result += factor * static_cast<double>(permutation[index % base]);
+		index /= base;
+		factor /= static_cast<double>(base);
+	}
+
+	// Rounding may lead to 1 for very large indices
+	return result < 1. ? result : std::nextafter(1., 0.);
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the number of dimensions of the sequence
+ */
+std::size_t GHaltonSequence::getNDimensions() const {
+	return m_bases.size();
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the base used for a given dimension
+ */
+std::uint64_t GHaltonSequence::getBase(std::size_t dim) const {
+	if (dim >= m_bases.size()) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG, time_and_place)
+				<< "In GHaltonSequence::getBase(): Error!" << std::endl
+				<< "Invalid dimension " << dim << " for a sequence of " << m_bases.size() << " dimensions" << std::endl
+		);
+	}
+
+	return m_bases[dim];
+}
+
+/******************************************************************************/
+////////////////////////////////////////////////////////////////////////////////
+/******************************************************************************/
+/**
+ * Initialization with the number of dimensions. The direction numbers are
+ * calculated from the Joe/Kuo initialization data.
+ *
+ * @param nDimensions The number of dimensions of the sequence
+ * @param scramble Indicates whether a random digital shift should be applied
+ * @param seed The seed used to create the digital shifts
+ */
+GSobolSequence::GSobolSequence(
+	std::size_t nDimensions
+	, bool scramble
+	, seed_type seed
+)
+	: m_nDimensions(nDimensions)
+	, m_directions(nDimensions, std::vector<std::uint32_t>(SOBOLNBITS, 0))
+	, m_shifts(nDimensions, 0)
+{
+	if (0 == nDimensions || nDimensions > MAXSOBOLDIMENSIONS) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG, time_and_place)
+				<< "In GSobolSequence::GSobolSequence(): Error!" << std::endl
+				<< "Got invalid number of dimensions " << nDimensions << std::endl
+				<< "Allowed range is [1, " << MAXSOBOLDIMENSIONS << "]" << std::endl
+		);
+	}
+
+	// The first dimension is the van der Corput sequence in base 2
+	for (std::size_t k = 0; k < SOBOLNBITS; k++) {
+		m_directions[0][k] = std::uint32_t(1) << (SOBOLNBITS - 1 - k);
+	}
+
+	// The remaining dimensions are calculated from the recurrence of their primitive polynomial
+	for (std::size_t dim = 1; dim < nDimensions; dim++) {
+		const sobolInitData& data = SOBOLINITDATA[dim - 1];
+		std::vector<std::uint32_t>& v = m_directions[dim];
+
+		for (std::size_t k = 0; k < SOBOLNBITS; k++) {
+			if (k < data.s) {
+				v[k] = data.m[k] << (SOBOLNBITS - 1 - k);
+			} else {
+				v[k] = v[k - data.s] ^ (v[k - data.s] >> data.s);
+				for (std::size_t i = 1; i < data.s; i++) {
+					if ((data.a >> (data.s - 1 - i)) & 1) v[k] ^= v[k - i];
+				}
+			}
+		}
+	}
+
+	if (scramble) {
+		mersenne_twister mt(seed);
+		std::uniform_int_distribution<std::uint32_t> uniform_shift;
+		for (auto& shift: m_shifts) shift = uniform_shift(mt);
+	}
+}
+
+/******************************************************************************/
+/**
+ * Retrieves coordinate dim of the point with the given index. The index is
+ * converted to Gray code, so that the points are produced in the same order
+ * as by the usual sequential generators. Index 0 maps onto the origin in the
+ * unscrambled case.
+ *
+ * @param index The index of the point
+ * @param dim The dimension of the coordinate
+ * @return The coordinate in the range [0,1)
+ */
+double GSobolSequence::value(std::uint64_t index, std::size_t dim) const {
+	if (dim >= m_nDimensions || index >= (std::uint64_t(1) << SOBOLNBITS)) {
+		throw gemfony_exception(
+			g_error_streamer(DO_LOG, time_and_place)
+				<< "In GSobolSequence::value(): Error!" << std::endl
+				<< "Invalid index " << index << " or dimension " << dim << std::endl
+		);
+	}
+
+	const std::vector<std::uint32_t>& v = m_directions[dim];
+
+	std::uint32_t x = 0;
+	std::uint64_t gray = index ^ (index >> 1);
+	for (std::size_t k = 0; gray != 0; k++, gray >>= 1) {
+		if (gray & 1) x ^= v[k];
+	}
+	x ^= m_shifts[dim];
+
+	return std::ldexp(static_cast<double>(x), -static_cast<int>(SOBOLNBITS));
+}
+
+/******************************************************************************/
+/**
+ * Retrieves the number of dimensions of the sequence
+ */
+std::size_t GSobolSequence::getNDimensions() const {
+	return m_nDimensions;
+}
+
+/******************************************************************************/
+
+} /* namespace Hap */
+} /* namespace Gem */
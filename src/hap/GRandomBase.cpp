@@ -66,6 +66,32 @@ GRandomBase::result_type GRandomBase::operator()() {
 	return this->int_random();
 }
 
+/******************************************************************************/
+/**
+ * Fills an array with raw random items. This is meant for bulk consumers, which
+ * would otherwise pay for a virtual call per random number.
+ *
+ * @param first The start of the array to be filled
+ * @param n The number of random items to be produced
+ */
+void GRandomBase::fill(GRandomBase::result_type *first, std::size_t n) {
+	this->int_random_n(first, n);
+}
+
+/******************************************************************************/
+/**
+ * Fills an array with raw random items. This default implementation simply
+ * calls int_random() repeatedly. Derived classes may provide faster versions.
+ *
+ * @param first The start of the array to be filled
+ * @param n The number of random items to be produced
+ */
+void GRandomBase::int_random_n(GRandomBase::result_type *first, std::size_t n) {
+	for(std::size_t i=0; i<n; i++) {
+		first[i] = this->int_random();
+	}
+}
+
 /******************************************************************************/
 
 } /* namespace Hap */
@@ -36,21 +36,46 @@
 
 #include "hap/GRandomT.hpp"
 
+namespace {
+	std::atomic<std::uint64_t> g_counter_random_stream{0};
+}
+
 namespace Gem {
 namespace Hap {
 
 /******************************************************************************/
+/**
+ * Retrieves the process-wide key of counter-based random number streams. The
+ * key is assembled from two seeds of the global seed manager on first use, so
+ * that different runs use different random numbers.
+ */
+std::uint64_t getCounterRandomKey() {
+	static const std::uint64_t key
+		= (static_cast<std::uint64_t>(GRANDOMFACTORY->getSeed()) << 32)
+		  ^ static_cast<std::uint64_t>(GRANDOMFACTORY->getSeed());
+	return key;
+}
 
-// thread_local Gem::Hap::GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMPROXY> GRANDOM_TLS;
+/******************************************************************************/
+/**
+ * Retrieves a new, unique id for a counter-based random number stream. This
+ * amounts to an atomic increment and is thus cheap enough to be called for
+ * every new object.
+ */
+std::uint64_t getNewCounterRandomStream() {
+	return g_counter_random_stream.fetch_add(1);
+}
 
+/******************************************************************************/
 /**
- * Gives access to a thread-local copy of the GRandomT proxy
+ * Gives access to a counter-based random number generator private to the
+ * calling thread. This is useful for code that needs random numbers, but
+ * should not hold a generator of its own.
  */
-/*
-GRandomT<RANDFLAVOURS::RANDOMPROXY>& randomProxy() {
-	return GRANDOM_TLS;
+GRandomT<RANDFLAVOURS::RANDOMCOUNTER>& threadLocalRandom() {
+	thread_local GRandomT<RANDFLAVOURS::RANDOMCOUNTER> gr_tls;
+	return gr_tls;
 }
-*/
 
 /******************************************************************************/
 
@@ -40,11 +40,80 @@
  ********************************************************************************/
 
 #include <iostream>
+#include <random>
+#include <chrono>
+#include <vector>
 
 #include "common/GCanvas.hpp"
 
 using namespace Gem::Common;
 
+/******************************************************************************/
+/**
+ * Measures the number of triangles per second that can be added to a canvas,
+ * as well as the number of canvas differences per second, both for the
+ * vectorized and the scalar reference implementation
+ */
+void benchmark(std::size_t xDim, std::size_t yDim, std::size_t nTriangles) {
+	std::mt19937 rng(42);
+	std::uniform_real_distribution<float> uniform(0.f, 1.f);
+
+	std::vector<t_circle> triangles(nTriangles);
+	for(auto& t: triangles) {
+		t.middle = coord2D(uniform(rng), uniform(rng));
+		t.radius = 0.25f*uniform(rng);
+		t.angle1 = 0.3f*uniform(rng);
+		t.angle2 = 0.35f + 0.3f*uniform(rng);
+		t.angle3 = 0.7f + 0.29f*uniform(rng);
+		t.r = uniform(rng);
+		t.g = uniform(rng);
+		t.b = uniform(rng);
+		t.a = uniform(rng);
+	}
+
+	auto dim = std::make_tuple(xDim, yDim);
+	GCanvas8 planar(dim, std::make_tuple(0.f, 0.f, 0.f));
+	GCanvas8 scalar(dim, std::make_tuple(0.f, 0.f, 0.f));
+	GCanvas8 background(dim, std::make_tuple(0.f, 0.f, 0.f));
+
+	auto t0 = std::chrono::steady_clock::now();
+	planar.addTriangles(triangles);
+	auto t1 = std::chrono::steady_clock::now();
+	for(auto const& t: triangles) {
+		// Same conversion as in addTriangle(t_circle)
+		t_cart t_c;
+		t_c.tr_one = coord2D(t.middle.x + t.radius * gcos(t.angle1 * 2.0f * boost::math::constants::pi<float>()), t.middle.y + t.radius * gsin(t.angle1 * 2.0f * boost::math::constants::pi<float>()));
+		t_c.tr_two = coord2D(t.middle.x + t.radius * gcos(t.angle2 * 2.0f * boost::math::constants::pi<float>()), t.middle.y + t.radius * gsin(t.angle2 * 2.0f * boost::math::constants::pi<float>()));
+		t_c.tr_three = coord2D(t.middle.x + t.radius * gcos(t.angle3 * 2.0f * boost::math::constants::pi<float>()), t.middle.y + t.radius * gsin(t.angle3 * 2.0f * boost::math::constants::pi<float>()));
+		t_c.r = t.r; t_c.g = t.g; t_c.b = t.b; t_c.a = t.a;
+		scalar.addTriangleScalar(t_c);
+	}
+	auto t2 = std::chrono::steady_clock::now();
+
+	const std::size_t nDiffs = 100;
+	float sum = 0.f;
+	for(std::size_t i=0; i<nDiffs; i++) sum += planar.diff(background);
+	auto t3 = std::chrono::steady_clock::now();
+	for(std::size_t i=0; i<nDiffs; i++) sum += planar.diff(background, std::thread::hardware_concurrency());
+	auto t4 = std::chrono::steady_clock::now();
+	for(std::size_t i=0; i<nDiffs; i++) sum += planar.diffScalar(background);
+	auto t5 = std::chrono::steady_clock::now();
+
+	std::chrono::duration<double> d_planar = t1 - t0, d_scalar = t2 - t1;
+	std::chrono::duration<double> d_diff = t3 - t2, d_diff_mt = t4 - t3, d_diff_scalar = t5 - t4;
+
+	std::cout
+		<< "Canvas " << xDim << "x" << yDim << ", " << nTriangles << " triangles:" << std::endl
+		<< "  addTriangle():       " << double(nTriangles)/d_planar.count() << " triangles/s" << std::endl
+		<< "  addTriangleScalar(): " << double(nTriangles)/d_scalar.count() << " triangles/s" << std::endl
+		<< "  diff():              " << double(nDiffs)/d_diff.count() << " differences/s" << std::endl
+		<< "  diff() threaded:     " << double(nDiffs)/d_diff_mt.count() << " differences/s" << std::endl
+		<< "  diffScalar():        " << double(nDiffs)/d_diff_scalar.count() << " differences/s" << std::endl
+		<< "  Deviation between both rasterizations: " << planar.diffScalar(scalar) << " (checksum " << sum << ")" << std::endl;
+}
+
+/******************************************************************************/
+
 int main(int argc, char**argv) {
 	GCanvas<8> gc, gc2;
 
@@ -82,5 +151,8 @@ int main(int argc, char**argv) {
 	// Finally save the picture to disk
 	gc.toFile(bf::path("./pictures/result.ppm"));
 
+	// Compare the vectorized and scalar implementations
+	benchmark(400, 300, 1000);
+
 	return 0;
 }
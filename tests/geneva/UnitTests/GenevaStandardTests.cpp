@@ -76,11 +76,27 @@ using namespace boost::unit_test;
 #include "geneva-individuals/GFunctionIndividual.hpp"
 #include "geneva-individuals/GDelayIndividual.hpp"
 #include "geneva-individuals/GExternalEvaluatorIndividual.hpp"
+#include "geneva-individuals/GNeuralNetworkIndividual.hpp"
 
 #include "geneva/tests/Geneva_tests.hpp"
 
 using namespace Gem::Geneva;
 
+/*************************************************************************************************/
+/**
+ * GNeuralNetworkIndividual hides GObject::load() and reads its training data through a global
+ * store, so it does not take part in the standard tests. We only run its specific tests.
+ */
+void GNeuralNetworkIndividual_no_failure_expected() {
+	std::string networkDataFile = "./GenevaStandardTests_networkData.xml";
+	GNeuralNetworkIndividual::createHyperCubeNetworkData({2, 4, 1}, 100, 0.5)->saveToDisk(networkDataFile);
+	Gem::Common::GNNOptStore::Instance(0)->setOnce("trainingDataFile", networkDataFile);
+
+	std::shared_ptr<GNeuralNetworkIndividual> p;
+	BOOST_REQUIRE_NO_THROW(p = TFactory_GUnitTests<GNeuralNetworkIndividual>());
+	BOOST_CHECK_NO_THROW(p->specificTestsNoFailureExpected_GUnitTests());
+}
+
 /*************************************************************************************************/
 /**
  * This test suite checks as much as possible of the functionality provided by Geneva classes.
@@ -166,6 +182,8 @@ public:
 
 		add( BOOST_TEST_CASE_TEMPLATE( StandardTests_no_failure_expected, individual_types ) );
 		add( BOOST_TEST_CASE_TEMPLATE( StandardTests_failures_expected, individual_types ) );
+
+		add( BOOST_TEST_CASE( &GNeuralNetworkIndividual_no_failure_expected ) );
 	}
 
     G_API_GENEVA ~GenevaStandardTestSuite() {
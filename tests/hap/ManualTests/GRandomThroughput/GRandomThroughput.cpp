@@ -46,6 +46,9 @@
 #include <vector>
 #include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <string>
+#include <tuple>
 
 // Boost header files go here
 
@@ -54,6 +57,75 @@
 #include "hap/GRandomDistributionsT.hpp"
 #include "common/GParserBuilder.hpp"
 
+/******************************************************************************/
+/**
+ * The ways of producing random numbers that are being compared
+ */
+enum class productionMode {
+	SCALARUNIFORM // One number at a time through std::uniform_real_distribution
+	, BULKUNIFORM // Entire packages through fill_uniform_real()
+	, SCALARNORMAL // One number at a time through std::normal_distribution
+	, BULKNORMAL // Entire packages through fill_normal()
+};
+
+/******************************************************************************/
+/**
+ * Measures the throughput of a given random number generator in double
+ * random numbers per second
+ */
+double measureThroughput(
+	Gem::Hap::GRandomBase& gr
+	, productionMode mode
+	, std::uint32_t packageSize
+	, std::uint32_t nCycles
+	, double lowerBoundary
+	, double upperBoundary
+) {
+	// Storage and production of random numbers
+	std::vector<double> payload(packageSize);
+	std::uniform_real_distribution<double> uniform_real(lowerBoundary, upperBoundary);
+	std::normal_distribution<double> normal(0., 1.);
+	double checksum = 0.;
+
+	// Run the measurement loop
+	std::chrono::system_clock::time_point startTime = std::chrono::system_clock::now();
+	for(std::uint32_t c=0; c<nCycles; c++) {
+		switch(mode) {
+			case productionMode::SCALARUNIFORM:
+				for(auto& p: payload) {
+					p = uniform_real(gr);
+				}
+				break;
+
+			case productionMode::BULKUNIFORM:
+				Gem::Hap::fill_uniform_real<double>(gr, payload, lowerBoundary, upperBoundary);
+				break;
+
+			case productionMode::SCALARNORMAL:
+				for(auto& p: payload) {
+					p = normal(gr);
+				}
+				break;
+
+			case productionMode::BULKNORMAL:
+				Gem::Hap::fill_normal<double>(gr, payload, 0., 1.);
+				break;
+		}
+
+		// Make sure the payload is actually used
+		checksum += payload.front() + payload.back();
+	}
+	std::chrono::system_clock::time_point endTime = std::chrono::system_clock::now();
+	std::chrono::duration<double> duration = endTime - startTime;
+
+	if(std::isnan(checksum)) {
+		std::cout << "Warning: Found invalid random numbers" << std::endl;
+	}
+
+	return double(nCycles)*double(packageSize)/duration.count();
+}
+
+/******************************************************************************/
 
 int main(int argc, char **argv) {
 	std::uint16_t nProducerThreads = 4;
@@ -112,27 +184,29 @@ int main(int argc, char **argv) {
 	// Configure the random number factory
 	GRANDOMFACTORY->setNProducerThreads(nProducerThreads);
 
-	// Retrieve a random number proxy
-	Gem::Hap::GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMPROXY> gr;
-
-	// Storage and production of random numbers
-	std::vector<double> payload(packageSize);
-	std::uniform_real_distribution<double> uniform_real(lowerBoundary, upperBoundary);
-
-	// Run the measurement loop
-	std::chrono::system_clock::time_point startTime = std::chrono::system_clock::now();
-	for(std::uint32_t c=0; c<nCycles; c++) {
-		for(auto& p: payload) {
-			p = uniform_real(gr);
-		}
-		std::sort(payload.begin(), payload.end());
-		// assert(is_sorted(payload.begin(), payload.end()));
+	// Retrieve a random number proxy, fed by the random number factory
+	Gem::Hap::GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMPROXY> gr_proxy;
+	// Retrieve a counter-based generator, which does not need the factory's producer threads
+	Gem::Hap::GRandomT<Gem::Hap::RANDFLAVOURS::RANDOMCOUNTER> gr_counter;
+
+	std::vector<std::tuple<std::string, Gem::Hap::GRandomBase *>> generators{
+		std::make_tuple(std::string("RANDOMPROXY"), &gr_proxy)
+		, std::make_tuple(std::string("RANDOMCOUNTER"), &gr_counter)
+	};
+
+	for(auto const& g: generators) {
+		double scalarUniform = measureThroughput(*std::get<1>(g), productionMode::SCALARUNIFORM, packageSize, nCycles, lowerBoundary, upperBoundary);
+		double bulkUniform = measureThroughput(*std::get<1>(g), productionMode::BULKUNIFORM, packageSize, nCycles, lowerBoundary, upperBoundary);
+		double scalarNormal = measureThroughput(*std::get<1>(g), productionMode::SCALARNORMAL, packageSize, nCycles, lowerBoundary, upperBoundary);
+		double bulkNormal = measureThroughput(*std::get<1>(g), productionMode::BULKNORMAL, packageSize, nCycles, lowerBoundary, upperBoundary);
+
+		// Let the audience know
+		std::cout
+			<< std::get<0>(g) << ":" << std::endl
+			<< "  uniform, scalar: " << scalarUniform << " double random numbers/s (equivalent to " << 8.*scalarUniform/(1024*1024) << " MB/s)" << std::endl
+			<< "  uniform, bulk:   " << bulkUniform << " double random numbers/s (equivalent to " << 8.*bulkUniform/(1024*1024) << " MB/s)" << std::endl
+			<< "  normal, scalar:  " << scalarNormal << " double random numbers/s (equivalent to " << 8.*scalarNormal/(1024*1024) << " MB/s)" << std::endl
+			<< "  normal, bulk:    " << bulkNormal << " double random numbers/s (equivalent to " << 8.*bulkNormal/(1024*1024) << " MB/s)" << std::endl
+			<< "  speedup bulk/scalar: uniform " << bulkUniform/scalarUniform << ", normal " << bulkNormal/scalarNormal << std::endl;
 	}
-	std::chrono::system_clock::time_point endTime = std::chrono::system_clock::now();
-	std::chrono::duration<double> duration = endTime - startTime;
-
-	// Let the audience know
-	double throughput=double(nCycles*packageSize)/duration.count();
-	double megabytes=8.*throughput/(1024*1024);
-	std::cout << "Achieved a throughput of " << throughput << " double random numbers/s (equivalent to " << megabytes << " MB/s)" << std::endl;
 }